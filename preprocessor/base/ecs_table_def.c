@@ -1501,26 +1501,11 @@ ecs_table_def__decompose_cel(ecs_table_t  **table_def_fac,
                              ecs_table_t   *table_def_cel)
 {
   size_t      nbr_cel;
-  size_t      nbr_def;
   size_t      nbr_fac;
   size_t      nbr_fac_old;
-  size_t      nbr_val_cel;
   size_t      nbr_val_fac;
   size_t      nbr_val_fac_old;
-  size_t      ind_pos_cel;
-  size_t      ind_pos_loc;
-  size_t      ind_pos_sui;
-  size_t      nbr_pos_loc;
-  ecs_int_t   num_def;
-  ecs_int_t   marqueur_fin;
-
-  size_t      isom;
   size_t      icel;
-  int         idef;
-  size_t      cpt_fac;
-  int         ifac;
-
-  ecs_int_t   typ_geo_cel;        /* Type géométrique élément en cours */
 
   ecs_int_t typ_geo_base[9] = {ECS_ELT_TYP_NUL,
                                ECS_ELT_TYP_NUL,
@@ -1534,6 +1519,7 @@ ecs_table_def__decompose_cel(ecs_table_t  **table_def_fac,
 
   ecs_size_t   *def_cel_fac_pos = NULL;
   ecs_int_t    *def_cel_fac_val = NULL;
+  ecs_size_t   *def_cel_val_idx = NULL;
 
   /*xxxxxxxxxxxxxxxxxxxxxxxxxxx Instructions xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx*/
 
@@ -1545,12 +1531,6 @@ ecs_table_def__decompose_cel(ecs_table_t  **table_def_fac,
 
   ecs_table__regle_en_pos(table_def_cel);
 
-  /* Construction, pour les cellules, des tables principaux */
-  /*--------------------------------------------------------*/
-
-  /* Boucle de comptage pour l'allocation des sous-éléments */
-  /*--------------------------------------------------------*/
-
   if (*table_def_fac != NULL) {
     nbr_fac_old = (*table_def_fac)->nbr;
     nbr_val_fac_old = ecs_table__ret_val_nbr(*table_def_fac);
@@ -1560,82 +1540,87 @@ ecs_table_def__decompose_cel(ecs_table_t  **table_def_fac,
     nbr_val_fac_old = 0;
   }
 
-  nbr_fac     = 0;
-  nbr_val_fac = 0;
-  nbr_def     = 0;
+  /* Boucle de comptage des faces et sommets de faces de chaque cellule */
+  /*--------------------------------------------------------------------*/
 
-  for (icel = 0; icel < nbr_cel; icel++ ) {
+  /* Les comptages par cellule sont indépendants, et permettent de
+     connaître par somme préfixe la position des faces de chaque
+     cellule, de sorte que la décomposition peut ensuite être réalisée
+     par plusieurs threads avec un résultat identique au cas séquentiel */
 
-    ind_pos_cel = table_def_cel->pos[icel] - 1;
+  ECS_MALLOC(def_cel_fac_pos, nbr_cel + 1, ecs_size_t);
+  ECS_MALLOC(def_cel_val_idx, nbr_cel + 1, ecs_size_t);
+
+  def_cel_fac_pos[0] = 1;
+  def_cel_val_idx[0] = 0;
+
+# pragma omp parallel for if (nbr_cel > ECS_THR_MIN)
+  for (icel = 0; icel < nbr_cel; icel++) {
 
-    nbr_val_cel = table_def_cel->pos[icel + 1] - 1 - ind_pos_cel;
+    size_t ind_pos_cel = table_def_cel->pos[icel] - 1;
+    size_t ind_pos_sui = table_def_cel->pos[icel + 1] - 1;
+    size_t nbr_val_cel = ind_pos_sui - ind_pos_cel;
+
+    size_t n_fac = 0, n_val = 0;
 
     /* Traitement des cellules "classiques" */
-    /*--------------------------------------*/
 
     if (nbr_val_cel < 9) {
 
-      typ_geo_cel = typ_geo_base[nbr_val_cel];
-
-      /* Boucle sur les sous-éléments définissant la cellulle */
+      ecs_int_t typ_geo_cel = typ_geo_base[nbr_val_cel];
 
+      int ifac;
       for (ifac = 0;
            ifac < ecs_fic_elt_typ_liste_c[typ_geo_cel].nbr_sous_elt;
-           ifac++ ) {
-
+           ifac++) {
         const ecs_sous_elt_t  * sous_elt
           = &(ecs_fic_elt_typ_liste_c[typ_geo_cel].sous_elt[ifac]);
-
-        nbr_fac++;
-
-        for (idef = 0;
-             idef < (ecs_fic_elt_typ_liste_c[sous_elt->elt_typ]).nbr_som;
-             idef++);
-
-        nbr_val_fac += idef;
-
+        n_val += (ecs_fic_elt_typ_liste_c[sous_elt->elt_typ]).nbr_som;
       }
+      n_fac = ifac;
 
     }
 
     /* Traitement des éléments de type "polyèdre" */
-    /*--------------------------------------------*/
 
     else {
 
-      ind_pos_sui = table_def_cel->pos[icel + 1] - 1;
-      nbr_pos_loc = ind_pos_sui - ind_pos_cel;
-
       /* Convention : définition nodale cellule->sommets avec numéros de
          premiers sommets répétés en fin de liste pour marquer la fin
          de chaque face */
 
-      marqueur_fin = -1;
-
-      for (isom = ind_pos_cel; isom < ind_pos_sui; isom++) {
+      ecs_int_t marqueur_fin = -1;
 
+      for (size_t isom = ind_pos_cel; isom < ind_pos_sui; isom++) {
         if (table_def_cel->val[isom] != marqueur_fin) {
-          nbr_val_fac += 1;
+          n_val += 1;
           if (marqueur_fin == -1)
             marqueur_fin = table_def_cel->val[isom];
         }
         else {
           marqueur_fin = -1;
-          nbr_fac += 1;
+          n_fac += 1;
         }
-
       }
 
     }
 
+    def_cel_fac_pos[icel + 1] = n_fac;
+    def_cel_val_idx[icel + 1] = n_val;
+
   } /* Fin de la boucle de comptage sur les cellules */
 
+  for (icel = 0; icel < nbr_cel; icel++) {
+    def_cel_fac_pos[icel + 1] += def_cel_fac_pos[icel];
+    def_cel_val_idx[icel + 1] += def_cel_val_idx[icel];
+  }
+
   /* Allocation et initialisation pour les faces  */
   /*  des tableaux associés aux définitions       */
   /*----------------------------------------------*/
 
-  nbr_fac += nbr_fac_old;
-  nbr_val_fac += nbr_val_fac_old;
+  nbr_fac = nbr_fac_old + def_cel_fac_pos[nbr_cel] - 1;
+  nbr_val_fac = nbr_val_fac_old + def_cel_val_idx[nbr_cel];
 
   if (*table_def_fac != NULL) {
     ecs_table__regle_en_pos(*table_def_fac);
@@ -1649,133 +1634,99 @@ ecs_table_def__decompose_cel(ecs_table_t  **table_def_fac,
     (*table_def_fac)->pos[0] = 1;
   }
 
-  ECS_MALLOC(def_cel_fac_pos, nbr_cel + 1, ecs_size_t);
   ECS_MALLOC(def_cel_fac_val, nbr_fac - nbr_fac_old, ecs_int_t);
 
-  def_cel_fac_pos[0] = 1;
-
   /*=======================================*/
   /* Boucle sur les cellules à transformer */
   /*=======================================*/
 
-  cpt_fac = nbr_fac_old;
-  nbr_def = nbr_val_fac_old;
+  {
+    ecs_size_t  *fac_pos = (*table_def_fac)->pos;
+    ecs_int_t   *fac_val = (*table_def_fac)->val;
 
-  for (icel = 0; icel < nbr_cel; icel++ ) {
+#   pragma omp parallel for if (nbr_cel > ECS_THR_MIN)
+    for (icel = 0; icel < nbr_cel; icel++) {
 
-    ind_pos_cel = table_def_cel->pos[icel] - 1;
+      size_t ind_pos_cel = table_def_cel->pos[icel] - 1;
+      size_t nbr_val_cel = table_def_cel->pos[icel + 1] - 1 - ind_pos_cel;
 
-    nbr_val_cel = table_def_cel->pos[icel + 1] - 1 - ind_pos_cel;
+      size_t cpt_fac = nbr_fac_old + def_cel_fac_pos[icel] - 1;
+      size_t nbr_def = nbr_val_fac_old + def_cel_val_idx[icel];
 
-    /*--------------------------------------*/
-    /* Traitement des éléments "classiques" */
-    /*--------------------------------------*/
+      /* Traitement des éléments "classiques" */
+      /*--------------------------------------*/
 
-    if (nbr_val_cel < 9) {
+      if (nbr_val_cel < 9) {
 
-      typ_geo_cel = typ_geo_base[nbr_val_cel];
+        ecs_int_t typ_geo_cel = typ_geo_base[nbr_val_cel];
 
-      /* Boucle sur les faces définissant la cellulle */
-      /*==============================================*/
+        /* Boucle sur les faces définissant la cellule */
 
-      for (ifac = 0;
-           ifac < ecs_fic_elt_typ_liste_c[typ_geo_cel].nbr_sous_elt;
-           ifac++ ) {
+        for (int ifac = 0;
+             ifac < ecs_fic_elt_typ_liste_c[typ_geo_cel].nbr_sous_elt;
+             ifac++) {
 
-        const ecs_sous_elt_t  * sous_elt
-          = &(ecs_fic_elt_typ_liste_c[typ_geo_cel].sous_elt[ifac]);
-
-        /* Boucle sur les sommets définissant la face */
-        /*--------------------------------------------*/
-
-        for (idef = 0;
-             idef < (ecs_fic_elt_typ_liste_c[sous_elt->elt_typ]).nbr_som;
-             idef++) {
+          const ecs_sous_elt_t  * sous_elt
+            = &(ecs_fic_elt_typ_liste_c[typ_geo_cel].sous_elt[ifac]);
 
           /* Définition de la face en fonction des sommets */
 
-          num_def = sous_elt->som[idef];
-
-          (*table_def_fac)->val[nbr_def++]
-            = table_def_cel->val[ind_pos_cel + num_def - 1];
-
-        }
-
-        /* Position de la face dans sa définition en fonction des sommets */
-        /*----------------------------------------------------------------*/
-
-        (*table_def_fac)->pos[cpt_fac + 1]
-          = (*table_def_fac)->pos[cpt_fac] + idef;
-
-        /* Détermination de la cellule en fonction des faces */
-        /*---------------------------------------------------*/
-
-        def_cel_fac_val[cpt_fac - nbr_fac_old] = cpt_fac + 1;
-
-        cpt_fac++;
-
-      } /* Fin de la boucle sur les faces d'une cellule */
-
-    }
-
-
-    /*--------------------------------------------*/
-    /* Traitement des éléments de type "polyèdre" */
-    /*--------------------------------------------*/
-
-    else {
-
-      /* Boucle sur les faces définissant le polyèdre */
-      /*==============================================*/
-
-      ifac = 0;
-      marqueur_fin = -1;
-
-      nbr_pos_loc = table_def_cel->pos[icel + 1] - 1 - ind_pos_cel;
-
-      for (ind_pos_loc = 0; ind_pos_loc < nbr_pos_loc; ind_pos_loc++) {
-
-        /* Définition de la face en fonction des sommets */
+          for (int idef = 0;
+               idef < (ecs_fic_elt_typ_liste_c[sous_elt->elt_typ]).nbr_som;
+               idef++) {
+            ecs_int_t num_def = sous_elt->som[idef];
+            fac_val[nbr_def++] = table_def_cel->val[ind_pos_cel + num_def - 1];
+          }
 
-        if (table_def_cel->val[ind_pos_cel + ind_pos_loc] != marqueur_fin) {
+          /* Position de la face et définition de la cellule */
 
-          (*table_def_fac)->val[nbr_def++]
-            = table_def_cel->val[ind_pos_cel + ind_pos_loc];
+          fac_pos[cpt_fac + 1] = nbr_def + 1;
+          def_cel_fac_val[cpt_fac - nbr_fac_old] = cpt_fac + 1;
 
-          if (marqueur_fin == -1)
-            marqueur_fin = table_def_cel->val[ind_pos_cel + ind_pos_loc];
+          cpt_fac++;
 
         }
 
-        /* Position de la face dans sa définition en fonction des sommets */
+      }
 
-        else {
+      /* Traitement des éléments de type "polyèdre" */
+      /*--------------------------------------------*/
 
-          (*table_def_fac)->pos[cpt_fac + 1] = nbr_def + 1;
+      else {
 
-          marqueur_fin = -1;
+        ecs_int_t marqueur_fin = -1;
 
-          def_cel_fac_val[cpt_fac - nbr_fac_old] = cpt_fac + 1;
+        for (size_t ind_pos_loc = 0;
+             ind_pos_loc < nbr_val_cel;
+             ind_pos_loc++) {
 
-          /* Incrémentation du nombre de faces */
+          ecs_int_t num_som = table_def_cel->val[ind_pos_cel + ind_pos_loc];
 
-          ifac++;
-          cpt_fac++;
+          /* Définition de la face en fonction des sommets */
 
-        }
+          if (num_som != marqueur_fin) {
+            fac_val[nbr_def++] = num_som;
+            if (marqueur_fin == -1)
+              marqueur_fin = num_som;
+          }
 
-      } /* Fin de la boucle sur les faces du polyèdre */
+          /* Position de la face et définition de la cellule */
 
-    }
+          else {
+            fac_pos[cpt_fac + 1] = nbr_def + 1;
+            marqueur_fin = -1;
+            def_cel_fac_val[cpt_fac - nbr_fac_old] = cpt_fac + 1;
+            cpt_fac++;
+          }
 
-    /* A ce point, on a : ifac
-       = ecs_fic_elt_typ_liste_c[table_typ_geo_cel->val[icel]].nbr_sous_elt
-       pour des éléments classiques, et ifac est égal au nombre de faces pour
-       des éléments polyédriques. */
+        } /* Fin de la boucle sur les faces du polyèdre */
 
-    def_cel_fac_pos[icel + 1] = def_cel_fac_pos[icel] + ifac;
+      }
+
+    } /* Fin de la boucle sur les éléments */
+  }
 
-  } /* Fin de la boucle sur les éléments */
+  ECS_FREE(def_cel_val_idx);
 
   /* Mise à jour de la table */
   /*-------------------------*/
@@ -1800,31 +1751,22 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
                         ecs_tab_int_t  *signe_elt)
 {
   size_t           cpt_sup_fin;
-  size_t           ind_cmp;
   size_t           ind_inf;
-  size_t           ind_loc_sup;
-  size_t           ind_loc_cmp;
   size_t           ind_pos;
-  size_t           ind_pos_loc;
   size_t           ind_sup;
   size_t           nbr_sup_ini;
   size_t           nbr_inf;
   ecs_int_t        num_inf;
-  ecs_int_t        num_inf_loc;
   ecs_int_t        num_inf_min;
-  ecs_int_t        num_inf_min_cmp;
-  size_t           pos_cmp;
   size_t           pos_cpt;
   size_t           pos_sup;
-  int              sgn;
-
-  size_t           ind_pos_sup[3];
-  size_t           ind_pos_cmp[3];
 
   ecs_tab_int_t    cpt_ref_inf;
 
   ecs_size_t      *pos_recherche = NULL;
   ecs_int_t       *val_recherche = NULL;
+  size_t          *pos_min = NULL;
+  ecs_int_t       *sgn_elt = NULL;
 
   ecs_tab_int_t    tab_transf;    /* Tableau de transformation */
 
@@ -1840,9 +1782,6 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
   tab_transf.nbr = 0;
   tab_transf.val = NULL;
 
-  if (table_def == NULL)
-    return tab_transf;
-
   if (table_def == NULL)
     return tab_transf;
 
@@ -1855,16 +1794,41 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
   if (signe_elt != NULL) {
     signe_elt->nbr = nbr_sup_ini;
     ECS_MALLOC(signe_elt->val, nbr_sup_ini, ecs_int_t);
+    sgn_elt = signe_elt->val;
+  }
+  else
+    ECS_MALLOC(sgn_elt, nbr_sup_ini, ecs_int_t);
+
+  /* Position de l'élément de l'entité inférieure de plus petit numéro
+     pour chaque élément de l'entité supérieure */
+
+  ECS_MALLOC(pos_min, nbr_sup_ini, size_t);
+
+# pragma omp parallel for if (nbr_sup_ini > ECS_THR_MIN)
+  for (ind_sup = 0; ind_sup < nbr_sup_ini; ind_sup++) {
+
+    size_t ind_pos_loc = table_def->pos[ind_sup] - 1;
+    size_t ind_pos_fin = table_def->pos[ind_sup + 1] - 1;
+
+    pos_min[ind_sup] = ind_pos_loc;
+
+    ecs_int_t num_inf_min_loc = ECS_ABS(table_def->val[ind_pos_loc]);
+    while (++ind_pos_loc < ind_pos_fin) {
+      ecs_int_t num_inf_loc = ECS_ABS(table_def->val[ind_pos_loc]);
+      if (num_inf_loc < num_inf_min_loc) {
+        num_inf_min_loc = num_inf_loc;
+        pos_min[ind_sup] = ind_pos_loc;
+      }
+    }
+
   }
 
   /* Comptage du nombre de sous-entités */
 
   nbr_inf = 0;
 
-  for (ind_sup = 0;
-       ind_sup < table_def->pos[nbr_sup_ini] - 1;
-       ind_sup++) {
-    num_inf = table_def->val[ind_sup];
+  for (ind_pos = 0; ind_pos < table_def->pos[nbr_sup_ini] - 1; ind_pos++) {
+    num_inf = table_def->val[ind_pos];
     if ((size_t)(ECS_ABS(num_inf)) > nbr_inf)
       nbr_inf = ECS_ABS(num_inf);
   }
@@ -1872,6 +1836,11 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
   /* Construction du tableau de recherche des sous-entités */
   /*-------------------------------------------------------*/
 
+  /* Les éléments de l'entité supérieure sont répartis dans des listes
+     indexées par leur élément de l'entité inférieure de plus petit numéro,
+     qui jouent le rôle de table de hachage ; dans chaque liste, les
+     éléments sont rangés par numéro croissant */
+
   ECS_MALLOC(pos_recherche, nbr_inf + 1, ecs_size_t);
   ECS_MALLOC(val_recherche, table_def->nbr, ecs_int_t);
 
@@ -1884,14 +1853,7 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
 
   for (ind_sup = 0; ind_sup < table_def->nbr; ind_sup++) {
 
-    ind_pos_loc = table_def->pos[ind_sup] - 1;
-
-    num_inf_min = ECS_ABS(table_def->val[ind_pos_loc]);
-    while (++ind_pos_loc < table_def->pos[ind_sup + 1] -1) {
-      num_inf_loc = ECS_ABS(table_def->val[ind_pos_loc]);
-      if (num_inf_loc < num_inf_min)
-        num_inf_min = num_inf_loc;
-    }
+    num_inf_min = ECS_ABS(table_def->val[pos_min[ind_sup]]);
 
     assert(num_inf_min > 0 && (size_t)num_inf_min <= nbr_inf);
 
@@ -1915,17 +1877,7 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
 
   for (ind_sup = 0; ind_sup < table_def->nbr; ind_sup++) {
 
-    ind_pos_loc = table_def->pos[ind_sup] - 1;
-
-    num_inf_min = ECS_ABS(table_def->val[ind_pos_loc]);
-    while (ind_pos_loc < table_def->pos[ind_sup + 1] -1) {
-      num_inf_loc = ECS_ABS(table_def->val[ind_pos_loc]);
-      ind_pos_loc++;
-      if (num_inf_loc < num_inf_min)
-        num_inf_min = num_inf_loc;
-    }
-
-    ind_inf = num_inf_min - 1;
+    ind_inf = ECS_ABS(table_def->val[pos_min[ind_sup]]) - 1;
 
     ind_pos =   pos_recherche[ind_inf] - 1
               + cpt_ref_inf.val[ind_inf];
@@ -1946,43 +1898,27 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
 
   tab_transf = ecs_tab_int__cree(nbr_sup_ini);
 
-  for (ind_sup = 0; ind_sup < nbr_sup_ini; ind_sup++)
-    tab_transf.val[ind_sup] = ind_sup;
-
-
   /* Boucle principale de recherche sur les éléments supérieurs */
   /*------------------------------------------------------------*/
 
   /*
-    Le premier élément ne peut pas être fusionné avec un élément précédent,
-    la boucle commence donc au deuxième
+    Pour chaque élément, on recherche le premier élément de numéro
+    inférieur ayant la même définition ; les recherches étant
+    indépendantes, elles peuvent être réparties sur plusieurs threads.
+    Le premier élément ne peut pas être fusionné avec un élément
+    précédent.
   */
 
-  tab_transf.val[0] = 0;
-
-  if (signe_elt != NULL)
-    signe_elt->val[0] = 1;
+# pragma omp parallel for if (nbr_sup_ini > ECS_THR_MIN)
+  for (ind_sup = 0; ind_sup < nbr_sup_ini; ind_sup++) {
 
-  cpt_sup_fin       = 1;
-
-  for (ind_sup = 1; ind_sup < table_def->nbr; ind_sup++) {
-
-    /* Recherche élement entité inférieure de plus petit numéro référencé */
+    size_t ind_pos_sup[3], ind_pos_cmp[3];
+    size_t ind_cmp = ind_sup;
+    int sgn = 0;
 
     ind_pos_sup[0] = table_def->pos[ind_sup    ] - 1; /* début */
     ind_pos_sup[1] = table_def->pos[ind_sup + 1] - 1; /* fin */
-    ind_pos_sup[2] = table_def->pos[ind_sup    ] - 1; /* plus petit */
-
-    ind_pos_loc = ind_pos_sup[0];
-
-    num_inf_min = ECS_ABS(table_def->val[ind_pos_loc]);
-    while (++ind_pos_loc < ind_pos_sup[1]) {
-      num_inf_loc = ECS_ABS(table_def->val[ind_pos_loc]);
-      if (num_inf_loc < num_inf_min) {
-        num_inf_min    = num_inf_loc;
-        ind_pos_sup[2] = ind_pos_loc;
-      }
-    }
+    ind_pos_sup[2] = pos_min[ind_sup];                /* plus petit */
 
     /*
       On cherche des éléments de l'entité courante de plus petit numéro que
@@ -1990,88 +1926,82 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
       (recherche de candidats pour la fusion)
     */
 
-    ind_inf = num_inf_min - 1;
-    sgn     = 0;
+    size_t ind_inf_loc = ECS_ABS(table_def->val[ind_pos_sup[2]]) - 1;
 
-    for (pos_cmp = pos_recherche[ind_inf]     - 1;
-         pos_cmp < pos_recherche[ind_inf + 1] - 1;
+    for (size_t pos_cmp = pos_recherche[ind_inf_loc]     - 1;
+         pos_cmp < pos_recherche[ind_inf_loc + 1] - 1;
          pos_cmp++) {
 
       ind_cmp = val_recherche[pos_cmp] - 1;
 
-      /* Repérage point de départ pour comparaison */
-
-      if (ind_cmp < ind_sup) {
+      /* Les candidats étant rangés par numéro croissant, on s'arrête
+         au premier candidat de numéro supérieur ou égal */
 
-        ind_pos_cmp[0] = table_def->pos[ind_cmp    ] - 1; /* début */
-        ind_pos_cmp[1] = table_def->pos[ind_cmp + 1] - 1; /* fin */
-        ind_pos_cmp[2] = table_def->pos[ind_cmp    ] - 1; /* plus petit */
+      if (ind_cmp >= ind_sup) {
+        ind_cmp = ind_sup;
+        break;
+      }
 
-        assert(ind_pos_cmp[1] > ind_pos_cmp[0]);
+      ind_pos_cmp[0] = table_def->pos[ind_cmp    ] - 1; /* début */
+      ind_pos_cmp[1] = table_def->pos[ind_cmp + 1] - 1; /* fin */
+      ind_pos_cmp[2] = pos_min[ind_cmp];                /* plus petit */
 
-        ind_pos_cmp[1] = table_def->pos[ind_cmp + 1] - 1;  /* fin */
+      assert(ind_pos_cmp[1] > ind_pos_cmp[0]);
 
-        ind_pos_loc = ind_pos_cmp[0];
+      /* Des définitions de tailles différentes ne peuvent être confondues
+         (le parcours cyclique ci-dessous s'arrêterait au plus tôt) */
 
-        num_inf_min_cmp = ECS_ABS(table_def->val[ind_pos_loc]);
-        while ((++ind_pos_loc) < ind_pos_cmp[1]) {
-          num_inf_loc = ECS_ABS(table_def->val[ind_pos_loc]);
-          if (num_inf_loc < num_inf_min_cmp) {
-            num_inf_min_cmp = num_inf_loc;
-            ind_pos_cmp[2]  = ind_pos_loc;
-          }
-        }
+      if (   ind_pos_cmp[1] - ind_pos_cmp[0]
+          != ind_pos_sup[1] - ind_pos_sup[0])
+        continue;
 
-        /* Comparaison des définitions */
+      /* Comparaison des définitions */
 
-        for (sgn = 1; sgn > -2; sgn -= 2) {
+      for (sgn = 1; sgn > -2; sgn -= 2) {
 
-          ind_loc_sup = ind_pos_sup[2];
-          ind_loc_cmp = ind_pos_cmp[2];
+        size_t ind_loc_sup = ind_pos_sup[2];
+        size_t ind_loc_cmp = ind_pos_cmp[2];
 
-          do {
+        do {
 
-            ind_loc_sup++;
-            if (ind_loc_sup == ind_pos_sup[1])
-              ind_loc_sup = ind_pos_sup[0];
+          ind_loc_sup++;
+          if (ind_loc_sup == ind_pos_sup[1])
+            ind_loc_sup = ind_pos_sup[0];
 
-            ind_loc_cmp += sgn;
-            if (ind_loc_cmp == ind_pos_cmp[1])
-              ind_loc_cmp = ind_pos_cmp[0];
-            else if (   ind_loc_cmp < ind_pos_cmp[0]
-                     || ind_loc_cmp > ind_pos_cmp[1])
-              ind_loc_cmp = ind_pos_cmp[1] - 1;
+          ind_loc_cmp += sgn;
+          if (ind_loc_cmp == ind_pos_cmp[1])
+            ind_loc_cmp = ind_pos_cmp[0];
+          else if (   ind_loc_cmp < ind_pos_cmp[0]
+                   || ind_loc_cmp > ind_pos_cmp[1])
+            ind_loc_cmp = ind_pos_cmp[1] - 1;
 
-          } while (   (   ECS_ABS(table_def->val[ind_loc_sup])
-                       == ECS_ABS(table_def->val[ind_loc_cmp]))
-                   && ind_loc_sup != ind_pos_sup[2]
-                   && ind_loc_cmp != ind_pos_cmp[2]);
+        } while (   (   ECS_ABS(table_def->val[ind_loc_sup])
+                     == ECS_ABS(table_def->val[ind_loc_cmp]))
+                 && ind_loc_sup != ind_pos_sup[2]
+                 && ind_loc_cmp != ind_pos_cmp[2]);
 
-          if (   ind_loc_sup == ind_pos_sup[2]
-              && ind_loc_cmp == ind_pos_cmp[2])
-            break; /* Sortie boucle sur signe parcours (1, -1, -3) */
+        if (   ind_loc_sup == ind_pos_sup[2]
+            && ind_loc_cmp == ind_pos_cmp[2])
+          break; /* Sortie boucle sur signe parcours (1, -1, -3) */
 
-        }
+      }
 
-        /*
-          Si sgn =  1, les entités sont confondues, de même sens;
-          Si sgn = -1, elles sont confondues, de sens inverse;
-          Sinon, elles ne sont pas confondues
-        */
+      /*
+        Si sgn =  1, les entités sont confondues, de même sens;
+        Si sgn = -1, elles sont confondues, de sens inverse;
+        Sinon, elles ne sont pas confondues
+      */
 
-        if (sgn == 1 || sgn == -1)
-          break; /* Sortie boucle sur pos_cmp pour recherche de candidats */
+      if (sgn == 1 || sgn == -1)
+        break; /* Sortie boucle sur pos_cmp pour recherche de candidats */
 
-      } /* Fin de la comparaison référence/candidat (if ind_cmp < ind_sup) */
+      ind_cmp = ind_sup;
 
     } /* Fin boucle sur pos_cmp recherche de candidats */
 
-
     /* Si on a trouvé une entité à fusionner */
 
-    if (sgn == 1 || sgn == -1) {
-
-      assert(pos_cmp < pos_recherche[ind_inf + 1] - 1);
+    if (ind_cmp < ind_sup) {
 
       if (sgn == 1 && (ind_pos_cmp[1] - ind_pos_cmp[0] == 2)) {
 
@@ -2087,26 +2017,35 @@ ecs_table_def__fusionne(ecs_table_t    *table_def,
 
       }
 
-      tab_transf.val[ind_sup] = tab_transf.val[ind_cmp];
-
-      if (signe_elt != NULL)
-        signe_elt->val[ind_sup] = sgn;
+      sgn_elt[ind_sup] = sgn;
 
     }
-    else {
+    else
+      sgn_elt[ind_sup] = 1;
 
-      tab_transf.val[ind_sup] = cpt_sup_fin++;
+    tab_transf.val[ind_sup] = ind_cmp;
 
-      if (signe_elt != NULL)
-        signe_elt->val[ind_sup] = 1;
+  } /* Fin boucle sur les éléments de l'entité supérieure (que l'on fusionne) */
 
-    }
+  /* Numérotation des éléments conservés, dans l'ordre de leur première
+     apparition ; l'élément avec lequel un élément est fusionné
+     est de numéro inférieur, donc déjà renuméroté */
 
+  cpt_sup_fin = 0;
 
-  } /* Fin boucle sur les éléments de l'entité supérieure (que l'on fusionne) */
+  for (ind_sup = 0; ind_sup < nbr_sup_ini; ind_sup++) {
+    if ((size_t)(tab_transf.val[ind_sup]) == ind_sup)
+      tab_transf.val[ind_sup] = cpt_sup_fin++;
+    else
+      tab_transf.val[ind_sup] = tab_transf.val[tab_transf.val[ind_sup]];
+  }
+
+  if (signe_elt == NULL)
+    ECS_FREE(sgn_elt);
 
   /* Libération du tableau de recherche */
 
+  ECS_FREE(pos_min);
   ECS_FREE(pos_recherche);
   ECS_FREE(val_recherche);
 
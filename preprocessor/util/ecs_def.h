@@ -204,6 +204,10 @@ typedef enum {
 
 #define ECS_STR_SIZE       80
 
+/* Minimum number of elements for a loop to be run on multiple threads */
+
+#define ECS_THR_MIN       128
+
 #define ECS_PAS_NUL         0
 #define ECS_PAS_UNITE       1
 
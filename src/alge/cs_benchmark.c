@@ -30,6 +30,7 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -76,16 +77,25 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_block_dist.h"
+#include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_matrix.h"
 #include "cs_matrix_assembler.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_tuning.h"
+#include "cs_multigrid.h"
+#include "cs_parall.h"
+#include "cs_part_to_block.h"
+#include "cs_restart.h"
+#include "cs_sles_it.h"
 #include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
@@ -113,6 +123,24 @@ BEGIN_C_DECLS
  * Local Structure Definitions
  *============================================================================*/
 
+/* Benchmark result, for machine-readable output */
+
+typedef struct {
+
+  char          category[16];   /* Benchmark category */
+  char          name[64];       /* Operation name */
+
+  long          n_runs;         /* Number of runs */
+  double        wt[3];          /* Mean, minimum, and maximum wall-clock
+                                   time per run over ranks */
+  double        rate;           /* Global rate, or 0 */
+  const char   *rate_unit;      /* Rate unit */
+
+  int           n_iter;         /* Number of iterations, or -1 */
+  double        residue;        /* Final residue, or -1 */
+
+} cs_benchmark_result_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -131,14 +159,147 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
      {N_("Block y <- A.x"),
       N_("Block y <- (A-D).x")}};
 
+/* Recorded results */
+
+static int                     _n_results = 0;
+static int                     _n_results_max = 0;
+static cs_benchmark_result_t  *_results = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Record a benchmark result.
+ *
+ * parameters:
+ *   category  <-- benchmark category
+ *   name      <-- operation name
+ *   n_runs    <-- number of runs
+ *   wt        <-- mean, minimum, and maximum wall-clock time per run
+ *   rate      <-- global rate, or 0
+ *   rate_unit <-- rate unit
+ *
+ * returns:
+ *   pointer to recorded result
+ *----------------------------------------------------------------------------*/
+
+static cs_benchmark_result_t *
+_add_result(const char    *category,
+            const char    *name,
+            long           n_runs,
+            const double   wt[3],
+            double         rate,
+            const char    *rate_unit)
+{
+  if (_n_results >= _n_results_max) {
+    _n_results_max = CS_MAX(_n_results_max*2, 16);
+    BFT_REALLOC(_results, _n_results_max, cs_benchmark_result_t);
+  }
+
+  cs_benchmark_result_t *r = _results + _n_results;
+  _n_results += 1;
+
+  strncpy(r->category, category, 15);
+  r->category[15] = '\0';
+  strncpy(r->name, name, 63);
+  r->name[63] = '\0';
+
+  r->n_runs = n_runs;
+  for (int i = 0; i < 3; i++)
+    r->wt[i] = wt[i];
+  r->rate = rate;
+  r->rate_unit = rate_unit;
+
+  r->n_iter = -1;
+  r->residue = -1;
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------
+ * Write recorded results to "benchmark.csv" and "benchmark.json" files
+ * (on rank 0 only).
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_results(void)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  FILE *f = fopen("benchmark.csv", "w");
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), "benchmark.csv");
+
+  fprintf(f, "category,name,n_runs,time_mean,time_min,time_max,"
+          "rate,rate_unit,n_iter,residue\n");
+
+  for (int i = 0; i < _n_results; i++) {
+    const cs_benchmark_result_t *r = _results + i;
+    fprintf(f, "\"%s\",\"%s\",%ld,%.6e,%.6e,%.6e,%.6e,\"%s\",%d,%.6e\n",
+            r->category, r->name, r->n_runs, r->wt[0], r->wt[1], r->wt[2],
+            r->rate, r->rate_unit, r->n_iter, r->residue);
+  }
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file: \"%s\""), "benchmark.csv");
+
+  f = fopen("benchmark.json", "w");
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), "benchmark.json");
+
+  fprintf(f,
+          "{\n"
+          "  \"version\": \"%s\",\n"
+          "  \"n_ranks\": %d,\n"
+          "  \"n_threads\": %d,\n"
+          "  \"n_g_cells\": %llu,\n"
+          "  \"n_g_i_faces\": %llu,\n"
+          "  \"n_g_b_faces\": %llu,\n"
+          "  \"results\": [",
+          CS_APP_VERSION, cs_glob_n_ranks, cs_glob_n_threads,
+          (unsigned long long)(m->n_g_cells),
+          (unsigned long long)(m->n_g_i_faces),
+          (unsigned long long)(m->n_g_b_faces));
+
+  for (int i = 0; i < _n_results; i++) {
+    const cs_benchmark_result_t *r = _results + i;
+    fprintf(f,
+            "%s\n    {\"category\": \"%s\", \"name\": \"%s\", "
+            "\"n_runs\": %ld,\n"
+            "     \"time_mean\": %.6e, \"time_min\": %.6e, "
+            "\"time_max\": %.6e,\n"
+            "     \"rate\": %.6e, \"rate_unit\": \"%s\", "
+            "\"n_iter\": %d, \"residue\": %.6e}",
+            (i > 0) ? "," : "",
+            r->category, r->name, r->n_runs, r->wt[0], r->wt[1], r->wt[2],
+            r->rate, r->rate_unit, r->n_iter, r->residue);
+  }
+
+  fprintf(f, "\n  ]\n}\n");
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file: \"%s\""), "benchmark.json");
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Benchmark results written to \"benchmark.csv\" "
+                  "and \"benchmark.json\".\n"));
+}
+
 /*----------------------------------------------------------------------------
  * Count number of operations.
  *
  * parameters:
+ *   category     <-- benchmark category (for recorded results)
+ *   name         <-- operation name (for recorded results)
  *   n_runs       <-- Local number of runs
  *   n_ops        <-- Local number of operations
  *   n_ops_single <-- Single-processor equivalent number of operations
@@ -147,19 +308,24 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
  *----------------------------------------------------------------------------*/
 
 static void
-_print_stats(long    n_runs,
-             long    n_ops,
-             long    n_ops_single,
-             double  wt)
+_print_stats(const char  *category,
+             const char  *name,
+             long         n_runs,
+             long         n_ops,
+             long         n_ops_single,
+             double       wt)
 {
   double fm = 1.0 * n_runs / (1.e9 * (CS_MAX(wt, 1)));
 
-  if (cs_glob_n_ranks == 1)
+  if (cs_glob_n_ranks == 1) {
     cs_log_printf(CS_LOG_PERFORMANCE,
                   _("  N ops:       %12ld\n"
                     "  Wall clock:  %12.5e\n"
                     "  GFLOPS:      %12.5e\n"),
                   n_ops, wt/n_runs, n_ops*fm);
+    double r_wt[3] = {wt/n_runs, wt/n_runs, wt/n_runs};
+    _add_result(category, name, n_runs, r_wt, n_ops*fm, "GFLOPS");
+  }
 
 #if defined(HAVE_MPI)
 
@@ -216,6 +382,9 @@ _print_stats(long    n_runs,
          glob_sum[0]/cs_glob_n_ranks, glob_min[0], glob_max[0],
          glob_sum[1]/cs_glob_n_ranks, glob_min[1], glob_max[1],
          n_ops_tot*fmg, n_ops_single*fmg);
+
+    double r_wt[3] = {glob_sum[0]/cs_glob_n_ranks, glob_min[0], glob_max[0]};
+    _add_result(category, name, n_runs, r_wt, n_ops_tot*fmg, "GFLOPS");
   }
 
 #endif
@@ -223,6 +392,90 @@ _print_stats(long    n_runs,
   cs_log_printf_flush(CS_LOG_PERFORMANCE);
 }
 
+/*----------------------------------------------------------------------------
+ * Print and record timing statistics for operations with no associated
+ * floating-point operation count.
+ *
+ * parameters:
+ *   category <-- benchmark category (for recorded results)
+ *   name     <-- operation name (for recorded results)
+ *   n_runs   <-- local number of runs
+ *   n_bytes  <-- local number of bytes exchanged or written per run,
+ *                or 0 if not applicable
+ *   wt       <-- wall-clock time
+ *
+ * returns:
+ *   pointer to recorded result
+ *----------------------------------------------------------------------------*/
+
+static cs_benchmark_result_t *
+_print_time_stats(const char  *category,
+                  const char  *name,
+                  long         n_runs,
+                  double       n_bytes,
+                  double       wt)
+{
+  double r_wt[3] = {wt/n_runs, wt/n_runs, wt/n_runs};
+  double g_bytes = n_bytes;
+
+  cs_parall_sum(1, CS_DOUBLE, r_wt);
+  cs_parall_min(1, CS_DOUBLE, r_wt + 1);
+  cs_parall_max(1, CS_DOUBLE, r_wt + 2);
+  cs_parall_sum(1, CS_DOUBLE, &g_bytes);
+
+  r_wt[0] /= cs_glob_n_ranks;
+
+  double rate = (r_wt[2] > 0) ? g_bytes / (1.e6 * r_wt[2]) : 0;
+
+  if (cs_glob_n_ranks == 1)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Wall clock:  %12.5e\n"),
+                  r_wt[0]);
+  else
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("               Mean         Min          Max\n"
+                    "  Wall clock:  %12.5e %12.5e %12.5e\n"),
+                  r_wt[0], r_wt[1], r_wt[2]);
+
+  if (g_bytes > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  MB/s:        %12.5e\n"),
+                  rate);
+
+  cs_log_printf_flush(CS_LOG_PERFORMANCE);
+
+  return _add_result(category, name, n_runs, r_wt, rate,
+                     (g_bytes > 0) ? "MB/s" : "");
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the number of runs of a timed loop must be increased.
+ *
+ * The decision is based on the maximum elapsed time over all ranks, so
+ * that it is the same on all ranks (timed operations may involve collective
+ * communication, and ranks may start a given test at different times).
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure
+ *   wt0       <-- start wall-clock time
+ *   wt1       <-- current wall-clock time
+ *
+ * returns:
+ *   true if more runs are needed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_measure_more(double  t_measure,
+              double  wt0,
+              double  wt1)
+{
+  double t_elapsed = wt1 - wt0;
+
+  cs_parall_max(1, CS_DOUBLE, &t_elapsed);
+
+  return (t_elapsed < t_measure) ? true : false;
+}
+
 /*----------------------------------------------------------------------------
  * Measure matrix.vector product related performance.
  *
@@ -262,6 +515,7 @@ _matrix_vector_test(double                 t_measure,
   double wt0, wt1;
   int    run_id, n_runs;
   long   n_ops, n_ops_glob;
+  char   name[64];
 
   double test_sum = 0.0;
   cs_matrix_structure_t *ms = NULL;
@@ -320,7 +574,7 @@ _matrix_vector_test(double                 t_measure,
 #endif
     }
     wt1 = cs_timer_wtime();
-    if (wt1 - wt0 < t_measure)
+    if (_measure_more(t_measure, wt0, wt1))
       n_runs *= 2;
   }
 
@@ -339,7 +593,11 @@ _matrix_vector_test(double                 t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  snprintf(name, 63, "A.x%s (%s)",
+           (sym_coeffs) ? " symm coeffs" : "", cs_matrix_type_name[m_type]);
+  name[63] = '\0';
+
+  _print_stats("spmv", name, n_runs, n_ops, n_ops_glob, wt1 - wt0);
 
   /* Local timing in parallel mode */
 
@@ -366,7 +624,7 @@ _matrix_vector_test(double                 t_measure,
         run_id++;
       }
       wt1 = cs_timer_wtime();
-      if (wt1 - wt0 < t_measure)
+      if (_measure_more(t_measure, wt0, wt1))
         n_runs *= 2;
     }
 
@@ -379,7 +637,11 @@ _matrix_vector_test(double                 t_measure,
                   _("  (calls: %d;  test sum: %12.5f)\n"),
                   n_runs, test_sum);
 
-    _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+    snprintf(name, 63, "local A.x%s (%s)",
+             (sym_coeffs) ? " symm coeffs" : "", cs_matrix_type_name[m_type]);
+    name[63] = '\0';
+
+    _print_stats("spmv", name, n_runs, n_ops, n_ops_glob, wt1 - wt0);
 
   }
 
@@ -417,7 +679,7 @@ _matrix_vector_test(double                 t_measure,
       run_id++;
     }
     wt1 = cs_timer_wtime();
-    if (wt1 - wt0 < t_measure)
+    if (_measure_more(t_measure, wt0, wt1))
       n_runs *= 2;
   }
 
@@ -431,7 +693,11 @@ _matrix_vector_test(double                 t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  snprintf(name, 63, "(A-D).x%s (%s)",
+           (sym_coeffs) ? " symm coeffs" : "", cs_matrix_type_name[m_type]);
+  name[63] = '\0';
+
+  _print_stats("spmv", name, n_runs, n_ops, n_ops_glob, wt1 - wt0);
 
   cs_matrix_destroy(&m);
   cs_matrix_structure_destroy(&ms);
@@ -647,7 +913,7 @@ _sub_matrix_vector_test(double               t_measure,
       run_id++;
     }
     wt1 = cs_timer_wtime();
-    if (wt1 - wt0 < t_measure)
+    if (_measure_more(t_measure, wt0, wt1))
       n_runs *= 2;
   }
 
@@ -660,7 +926,8 @@ _sub_matrix_vector_test(double               t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_stats("spmv", "native exdiag variant 0",
+               n_runs, n_ops, n_ops_glob, wt1 - wt0);
 
   for (jj = 0; jj < n_cells_ext; jj++)
     y[jj] = 0.0;
@@ -684,7 +951,7 @@ _sub_matrix_vector_test(double               t_measure,
       run_id++;
     }
     wt1 = cs_timer_wtime();
-    if (wt1 - wt0 < t_measure)
+    if (_measure_more(t_measure, wt0, wt1))
       n_runs *= 2;
   }
 
@@ -697,7 +964,8 @@ _sub_matrix_vector_test(double               t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_stats("spmv", "native exdiag variant 1",
+               n_runs, n_ops, n_ops_glob, wt1 - wt0);
 
   /* Matrix.vector product, contribute to faces only */
 
@@ -729,7 +997,7 @@ _sub_matrix_vector_test(double               t_measure,
       run_id++;
     }
     wt1 = cs_timer_wtime();
-    if (wt1 - wt0 < t_measure)
+    if (_measure_more(t_measure, wt0, wt1))
       n_runs *= 2;
   }
 
@@ -744,7 +1012,8 @@ _sub_matrix_vector_test(double               t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_stats("spmv", "native face values only",
+               n_runs, n_ops, n_ops_glob, wt1 - wt0);
 
 }
 
@@ -1148,6 +1417,661 @@ _matrix_check_asmb(cs_lnum_t              n_rows,
   BFT_FREE(da);
 }
 
+/*----------------------------------------------------------------------------
+ * Measure halo synchronization performance.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   m         <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_test(double            t_measure,
+           const cs_mesh_t  *m)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  char   name[64];
+
+  const cs_halo_t *halo = m->halo;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const char *halo_type_name[] = {N_("standard"), N_("extended")};
+
+  if (halo == NULL)
+    return;
+
+  cs_real_t *x = NULL;
+  BFT_MALLOC(x, n_cells_ext*3, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext*3; ii++)
+    x[ii] = 1.0;
+
+  int n_halo_types = (m->halo_type == CS_HALO_EXTENDED) ? 2 : 1;
+
+  for (int stride = 1; stride < 4; stride += 2) {
+
+    for (int t_id = 0; t_id < n_halo_types; t_id++) {
+
+      cs_halo_type_t halo_type = (t_id == 0) ?
+        CS_HALO_STANDARD : CS_HALO_EXTENDED;
+
+      wt0 = cs_timer_wtime(), wt1 = wt0;
+      if (t_measure > 0)
+        n_runs = 8;
+      else
+        n_runs = 1;
+      run_id = 0;
+      while (run_id < n_runs) {
+        while (run_id < n_runs) {
+          if (stride == 1)
+            cs_halo_sync_var(halo, halo_type, x);
+          else
+            cs_halo_sync_var_strided(halo, halo_type, x, stride);
+          run_id++;
+        }
+        wt1 = cs_timer_wtime();
+        if (_measure_more(t_measure, wt0, wt1))
+          n_runs *= 2;
+      }
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n"
+                      "Halo synchronization (%s, stride %d)\n"
+                      "--------------------\n"),
+                    _(halo_type_name[t_id]), stride);
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  (calls: %d)\n"),
+                    n_runs);
+
+      snprintf(name, 63, "%s, stride %d", halo_type_name[t_id], stride);
+      name[63] = '\0';
+
+      double n_bytes = halo->n_send_elts[t_id] * stride * sizeof(cs_real_t);
+
+      _print_time_stats("halo", name, n_runs, n_bytes, wt1 - wt0);
+
+    }
+
+  }
+
+  BFT_FREE(x);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute convection-diffusion type fluxes using an interior face loop.
+ *
+ * parameters:
+ *   reconstruct <-- use gradient-based reconstruction and centered
+ *                   convection if true, upwind convection if false
+ *   m           <-- pointer to mesh structure
+ *   mq          <-- pointer to mesh quantities structure
+ *   i_massflux  <-- interior face mass flux
+ *   i_visc      <-- interior face diffusion coefficient
+ *   pvar        <-- cell values
+ *   grad        <-- cell gradient
+ *   rhs         <-> right-hand side
+ *----------------------------------------------------------------------------*/
+
+static void
+_conv_diff_faces(bool                         reconstruct,
+                 const cs_mesh_t             *m,
+                 const cs_mesh_quantities_t  *mq,
+                 const cs_real_t             *restrict i_massflux,
+                 const cs_real_t             *restrict i_visc,
+                 const cs_real_t             *restrict pvar,
+                 const cs_real_3_t           *restrict grad,
+                 cs_real_t                   *restrict rhs)
+{
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)mq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)mq->djjpf;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t flux;
+
+        if (reconstruct) {
+          cs_real_t pip = pvar[ii]
+                        + cs_math_3_dot_product(grad[ii], diipf[face_id]);
+          cs_real_t pjp = pvar[jj]
+                        + cs_math_3_dot_product(grad[jj], djjpf[face_id]);
+          flux =   0.5*(pip + pjp)*i_massflux[face_id]
+                 + i_visc[face_id]*(pip - pjp);
+        }
+        else
+          flux =   CS_MAX(i_massflux[face_id], 0.)*pvar[ii]
+                 + CS_MIN(i_massflux[face_id], 0.)*pvar[jj]
+                 + i_visc[face_id]*(pvar[ii] - pvar[jj]);
+
+        rhs[ii] -= flux;
+        rhs[jj] += flux;
+
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Measure convection-diffusion face loop performance.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   m         <-- pointer to mesh structure
+ *   mq        <-- pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_face_loop_test(double                       t_measure,
+                const cs_mesh_t             *m,
+                const cs_mesh_quantities_t  *mq)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *i_face_normal = (const cs_real_3_t *)mq->i_face_normal;
+
+  const char *variant_name[] = {N_("upwind"), N_("reconstructed")};
+
+  /* Fluxes from a uniform velocity field and linear variable */
+
+  cs_real_t *pvar, *rhs, *i_massflux, *i_visc;
+  cs_real_3_t *grad;
+
+  BFT_MALLOC(pvar, n_cells_ext, cs_real_t);
+  BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
+  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++) {
+    pvar[ii] = cell_cen[ii][0];
+    grad[ii][0] = 1.;
+    grad[ii][1] = 0.;
+    grad[ii][2] = 0.;
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    i_massflux[face_id] = i_face_normal[face_id][0];
+    i_visc[face_id] = mq->i_face_surf[face_id] / mq->i_dist[face_id];
+  }
+
+  for (int v_id = 0; v_id < 2; v_id++) {
+
+    /* upwind: 2 products, 2 min/max, 1 difference and 1 product for
+       diffusion, 2 sums, 2 updates; reconstructed: 2 extra dot products
+       (5 operations each), 2 sums, and 2 extra operations for centered
+       convection */
+
+    int face_ops = (v_id == 0) ? 10 : 24;
+
+    n_ops = n_i_faces*face_ops;
+
+    if (cs_glob_n_ranks == 1)
+      n_ops_glob = n_ops;
+    else
+      n_ops_glob = m->n_g_i_faces*face_ops;
+
+    double test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+          rhs[ii] = 0.;
+        _conv_diff_faces((v_id == 1), m, mq, i_massflux, i_visc, pvar,
+                         (const cs_real_3_t *)grad, rhs);
+        test_sum += rhs[n_cells-1]*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (_measure_more(t_measure, wt0, wt1))
+        n_runs *= 2;
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Convection-diffusion face loop (%s)\n"
+                    "------------------------------\n"),
+                  _(variant_name[v_id]));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d;  test sum: %12.5f)\n"),
+                  n_runs, test_sum);
+
+    _print_stats("face_loop", variant_name[v_id],
+                 n_runs, n_ops, n_ops_glob, wt1 - wt0);
+
+  }
+
+  BFT_FREE(i_visc);
+  BFT_FREE(i_massflux);
+  BFT_FREE(grad);
+  BFT_FREE(rhs);
+  BFT_FREE(pvar);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure scalar gradient reconstruction performance.
+ *
+ * Geometric quantities required by both iterative and least-squares
+ * gradients are computed first, as they depend on the computation options.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   m         <-- pointer to mesh structure
+ *   mq        <-> pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_test(double                 t_measure,
+               const cs_mesh_t       *m,
+               cs_mesh_quantities_t  *mq)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  char   var_name[32];
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const cs_gradient_type_t gradient_type[] = {CS_GRADIENT_ITER,
+                                              CS_GRADIENT_LSQ};
+
+  cs_mesh_quantities_set_cocg_options(-1);
+  cs_mesh_quantities_compute(m, mq);
+
+  cs_gradient_initialize();
+
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+
+  cs_real_t *var, *bc_coeff_a, *bc_coeff_b;
+  cs_real_3_t *grad;
+
+  BFT_MALLOC(var, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(bc_coeff_a, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeff_b, n_b_faces, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+    var[ii] = cell_cen[ii][0] + 2.*cell_cen[ii][1] + 3.*cell_cen[ii][2];
+
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+    bc_coeff_a[face_id] = 0.;
+    bc_coeff_b[face_id] = 1.;
+  }
+
+  for (int g_id = 0; g_id < 2; g_id++) {
+
+    cs_gradient_type_t g_type = gradient_type[g_id];
+
+    snprintf(var_name, 31, "benchmark_%s", cs_gradient_type_name[g_type]);
+    var_name[31] = '\0';
+
+    double test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        cs_gradient_scalar(var_name,
+                           g_type,
+                           CS_HALO_STANDARD,
+                           1,        /* inc */
+                           true,     /* recompute_cocg */
+                           100,      /* n_r_sweeps */
+                           0,        /* tr_dim */
+                           0,        /* hyd_p_flag */
+                           1,        /* w_stride */
+                           0,        /* verbosity */
+                           -1,       /* clip_mode */
+                           1e-5,     /* epsilon */
+                           0.,       /* extrap */
+                           1.5,      /* clip_coeff */
+                           NULL,     /* f_ext */
+                           bc_coeff_a,
+                           bc_coeff_b,
+                           var,
+                           NULL,     /* c_weight */
+                           NULL,     /* cpl */
+                           grad);
+        test_sum += grad[n_cells-1][0]*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (_measure_more(t_measure, wt0, wt1))
+        n_runs *= 2;
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Scalar gradient (%s)\n"
+                    "---------------\n"),
+                  _(cs_gradient_type_name[g_type]));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d;  test sum: %12.5f)\n"),
+                  n_runs, test_sum);
+
+    _print_time_stats("gradient", cs_gradient_type_name[g_type],
+                      n_runs, 0, wt1 - wt0);
+
+  }
+
+  BFT_FREE(bc_coeff_b);
+  BFT_FREE(bc_coeff_a);
+  BFT_FREE(grad);
+  BFT_FREE(var);
+
+  cs_gradient_finalize();
+}
+
+/*----------------------------------------------------------------------------
+ * Measure linear solver performance.
+ *
+ * A symmetric diffusion (Laplacian) system with Dirichlet boundary
+ * conditions is solved with each iterative solver type and multigrid.
+ * Each run includes the solver setup and resolution.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   m         <-- pointer to mesh structure
+ *   mq        <-- pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_test(double                       t_measure,
+           const cs_mesh_t             *m,
+           const cs_mesh_quantities_t  *mq)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(m->i_face_cells);
+
+  cs_real_t *da, *xa, *rhs, *vx;
+
+  BFT_MALLOC(da, n_cells_ext, cs_real_t);
+  BFT_MALLOC(xa, n_i_faces, cs_real_t);
+  BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
+  BFT_MALLOC(vx, n_cells_ext, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+    da[ii] = 0.;
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    xa[face_id] = - mq->i_face_surf[face_id] / mq->i_dist[face_id];
+    da[i_face_cells[face_id][0]] -= xa[face_id];
+    da[i_face_cells[face_id][1]] -= xa[face_id];
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+    da[m->b_face_cells[face_id]]
+      += mq->b_face_surf[face_id] / mq->b_dist[face_id];
+
+  /* Slight diagonal dominance so that the matrix is also definite
+     with periodicity only */
+
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    da[ii] *= (1. + 1.e-6);
+    rhs[ii] = mq->cell_vol[ii];
+  }
+
+  double r_norm = sqrt(cs_gdot(n_cells, rhs, rhs));
+
+  cs_matrix_t *a = cs_matrix_msr(true, NULL, NULL);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_i_faces, i_face_cells, da, xa);
+
+  for (int s_id = 0; s_id < CS_SLES_N_IT_TYPES + 1; s_id++) {
+
+    const char *s_name = NULL;
+    void *context = NULL;
+
+    if (s_id < CS_SLES_N_IT_TYPES) {
+      s_name = cs_sles_it_type_name[s_id];
+      context = cs_sles_it_create(s_id, 0, 1000, false);
+    }
+    else {
+      s_name = N_("Multigrid");
+      context = cs_multigrid_create();
+    }
+
+    int n_iter = 0;
+    double residue = -1;
+
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      while (run_id < n_runs) {
+        for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+          vx[ii] = 0.;
+        if (s_id < CS_SLES_N_IT_TYPES) {
+          cs_sles_it_setup(context, "benchmark", a, 0);
+          cs_sles_it_solve(context, "benchmark", a, 0,
+                           CS_HALO_ROTATION_COPY,
+                           1e-8, r_norm, &n_iter, &residue,
+                           rhs, vx, 0, NULL);
+          cs_sles_it_free(context);
+        }
+        else {
+          cs_multigrid_setup(context, "benchmark", a, 0);
+          cs_multigrid_solve(context, "benchmark", a, 0,
+                             CS_HALO_ROTATION_COPY,
+                             1e-8, r_norm, &n_iter, &residue,
+                             rhs, vx, 0, NULL);
+          cs_multigrid_free(context);
+        }
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (_measure_more(t_measure, wt0, wt1))
+        n_runs *= 2;
+    }
+
+    if (s_id < CS_SLES_N_IT_TYPES)
+      cs_sles_it_destroy(&context);
+    else
+      cs_multigrid_destroy(&context);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Linear solver (%s)\n"
+                    "-------------\n"),
+                  _(s_name));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d;  iterations: %d;  residue: %12.5e)\n"),
+                  n_runs, n_iter, residue);
+
+    cs_benchmark_result_t *r
+      = _print_time_stats("sles", s_name, n_runs, 0, wt1 - wt0);
+
+    r->n_iter = n_iter;
+    r->residue = residue;
+
+  }
+
+  cs_matrix_release_coefficients(a);
+
+  cs_multigrid_finalize();
+
+  BFT_FREE(vx);
+  BFT_FREE(rhs);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure part to block distribution and restart I/O performance.
+ *
+ * A cell-based vector array is distributed, then written to and read
+ * from a restart file in the "benchmark" directory.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   m         <-- pointer to mesh structure
+ *   mq        <-- pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_io_test(double                       t_measure,
+         const cs_mesh_t             *m,
+         const cs_mesh_quantities_t  *mq)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const double n_bytes = n_cells * 3 * sizeof(cs_real_t);
+
+  cs_real_t *vals = NULL;
+
+#if defined(HAVE_MPI)
+
+  /* Part to block distribution */
+
+  if (cs_glob_n_ranks > 1 && m->global_cell_num != NULL) {
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          1,
+                                                          0,
+                                                          m->n_g_cells);
+
+    cs_lnum_t n_block_ents = bi.gnum_range[1] - bi.gnum_range[0];
+    BFT_MALLOC(vals, n_block_ents*3, cs_real_t);
+
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      while (run_id < n_runs) {
+        cs_part_to_block_t *d
+          = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                            bi,
+                                            n_cells,
+                                            m->global_cell_num);
+        cs_part_to_block_copy_array(d, CS_REAL_TYPE, 3, mq->cell_cen, vals);
+        cs_part_to_block_destroy(&d);
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (_measure_more(t_measure, wt0, wt1))
+        n_runs *= 2;
+    }
+
+    BFT_FREE(vals);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Part to block distribution (cells, stride 3)\n"
+                    "--------------------------\n"));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d)\n"),
+                  n_runs);
+
+    _print_time_stats("io", "part to block", n_runs, n_bytes, wt1 - wt0);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Restart write, then read */
+
+  BFT_MALLOC(vals, n_cells*3, cs_real_t);
+
+  for (int mode = CS_RESTART_MODE_WRITE; mode > -1; mode--) {
+
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 4;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      while (run_id < n_runs) {
+        cs_restart_t *r = cs_restart_create("benchmark", "benchmark", mode);
+        if (mode == CS_RESTART_MODE_WRITE)
+          cs_restart_write_section(r, "cell_cen", CS_MESH_LOCATION_CELLS,
+                                   3, CS_TYPE_cs_real_t, mq->cell_cen);
+        else
+          cs_restart_read_section(r, "cell_cen", CS_MESH_LOCATION_CELLS,
+                                  3, CS_TYPE_cs_real_t, vals);
+        cs_restart_destroy(&r);
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (_measure_more(t_measure, wt0, wt1))
+        n_runs *= 2;
+    }
+
+    const char *op_name = (mode == CS_RESTART_MODE_WRITE) ?
+      N_("restart write") : N_("restart read");
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Cell-based restart file %s\n"
+                    "-----------------------\n"),
+                  (mode == CS_RESTART_MODE_WRITE) ? _("write") : _("read"));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d)\n"),
+                  n_runs);
+
+    _print_time_stats("io", op_name, n_runs, n_bytes, wt1 - wt0);
+
+  }
+
+  BFT_FREE(vals);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1157,13 +2081,20 @@ _matrix_check_asmb(cs_lnum_t              n_rows,
 /*----------------------------------------------------------------------------
  * Run simple benchmarks.
  *
+ * In extended mode, halo synchronization, convection-diffusion face loops,
+ * gradient reconstruction, linear solvers, and I/O operations are also
+ * timed, and results are written to "benchmark.csv" and "benchmark.json"
+ * files for regression tracking.
+ *
  * parameters:
  *   mpi_trace_mode <-- indicates if timing mode (0) or MPI trace-friendly
  *                      mode (1) is to be used
+ *   extended       <-- indicates if extended benchmarks are run
  *----------------------------------------------------------------------------*/
 
 void
-cs_benchmark(int  mpi_trace_mode)
+cs_benchmark(int   mpi_trace_mode,
+             bool  extended)
 {
   /* Local variable definitions */
   /*----------------------------*/
@@ -1316,6 +2247,34 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  /* Extended benchmarks */
+  /*---------------------*/
+
+  if (extended) {
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Extended benchmarks\n"
+                    "===================\n"));
+
+    _halo_test(t_measure, mesh);
+
+    _face_loop_test(t_measure, mesh, mesh_v);
+
+    _gradient_test(t_measure, mesh, cs_glob_mesh_quantities);
+
+    _sles_test(t_measure, mesh, mesh_v);
+
+    _io_test(t_measure, mesh, mesh_v);
+
+    _write_results();
+
+  }
+
+  BFT_FREE(_results);
+  _n_results = 0;
+  _n_results_max = 0;
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
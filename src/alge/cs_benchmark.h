@@ -52,13 +52,20 @@ BEGIN_C_DECLS
 /*----------------------------------------------------------------------------
  * Run simple benchmarks.
  *
+ * In extended mode, halo synchronization, convection-diffusion face loops,
+ * gradient reconstruction, linear solvers, and I/O operations are also
+ * timed, and results are written to "benchmark.csv" and "benchmark.json"
+ * files for regression tracking.
+ *
  * parameters:
  *   mpi_trace_mode  --> indicates if timing mode (0) or MPI trace-friendly
  *                       mode (1) is to be used
+ *   extended        --> indicates if extended benchmarks are run
  *----------------------------------------------------------------------------*/
 
 void
-cs_benchmark(int  mpi_trace_mode);
+cs_benchmark(int   mpi_trace_mode,
+             bool  extended);
 
 /*----------------------------------------------------------------------------*/
 
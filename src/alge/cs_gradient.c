@@ -62,6 +62,7 @@
 #include "cs_ext_neighborhood.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
+#include "cs_parall.h"
 #include "cs_prototypes.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
@@ -143,6 +144,11 @@ const char *cs_gradient_type_name[]
 
 static int _gradient_stat_id = -1;
 
+/* Reduced precision least-squares cocg check statistics */
+
+static double _cocg_lsq_r_max_diff = 0.;
+static double _cocg_lsq_r_max_ref = 0.;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -181,6 +187,31 @@ _thread_range(cs_lnum_t   n,
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Add the elapsed time since a given start to the current thread's time
+ * for the gradients timer statistic.
+ *
+ * This is intended to be called at the end of the work of a thread
+ * in the main threaded loops, so as to measure thread imbalance.
+ *
+ * parameters:
+ *   t0 <-- timer value at start of the thread's work
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_add_thread_time(const cs_timer_t  *t0)
+{
+  if (_gradient_stat_id > -1) {
+    cs_timer_t t1 = cs_timer_time();
+#if defined(HAVE_OPENMP)
+    int t_id = omp_get_thread_num();
+#else
+    int t_id = 0;
+#endif
+    cs_timer_stats_add_thread_diff(_gradient_stat_id, t_id, t0, &t1);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Factorize dense p*p symmetric matrices.
  * Only the lower triangular part is stored and the factorization is performed
@@ -500,6 +531,26 @@ _l2_norm_3(cs_lnum_t              n_elts,
   return (sqrt(s[0]) + sqrt(s[1]) + sqrt(s[2]));
 }
 
+/*----------------------------------------------------------------------------
+ * Multiply a vector by a symmetric 3x3 matrix stored in reduced precision
+ * (see cs_mesh_quantities_sym_33_to_r).
+ *
+ * parameters:
+ *   m_r <-- reduced precision matrix
+ *   v   <-- vector
+ *   mv  --> matrix-vector product
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_sym_33_r_3_product(const float      m_r[6],
+                    const cs_real_t  v[3],
+                    cs_real_t        mv[3])
+{
+  mv[0] = m_r[0]*v[0] + m_r[3]*v[1] + m_r[5]*v[2];
+  mv[1] = m_r[3]*v[0] + m_r[1]*v[1] + m_r[4]*v[2];
+  mv[2] = m_r[5]*v[0] + m_r[4]*v[1] + m_r[2]*v[2];
+}
+
 /*----------------------------------------------------------------------------
  * Update R.H.S. for lsq gradient taking into account the weight coefficients.
  *
@@ -845,6 +896,55 @@ _sync_scalar_gradient_halo(const cs_mesh_t  *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Synchronize halos for several scalar arrays in a single exchange.
+ *
+ * Values of local cells are interlaced in a work array which is
+ * synchronized, and ghost cell values are then copied back.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   halo_type      <-- halo type (extended or not)
+ *   n_vars         <-- number of arrays
+ *   var            <-> arrays to synchronize
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_scalars_multi(const cs_mesh_t  *m,
+                    cs_halo_type_t    halo_type,
+                    int               n_vars,
+                    cs_real_t        *var[])
+{
+  if (m->halo == NULL)
+    return;
+
+  if (n_vars == 1) {
+    cs_halo_sync_var(m->halo, halo_type, var[0]);
+    return;
+  }
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  cs_real_t *w;
+  BFT_MALLOC(w, n_cells_ext*n_vars, cs_real_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int k = 0; k < n_vars; k++)
+      w[i*n_vars + k] = var[k][i];
+  }
+
+  cs_halo_sync_var_strided(m->halo, halo_type, w, n_vars);
+
+  for (cs_lnum_t i = n_cells; i < n_cells_ext; i++) {
+    for (int k = 0; k < n_vars; k++)
+      var[k][i] = w[i*n_vars + k];
+  }
+
+  BFT_FREE(w);
+}
+
 /*----------------------------------------------------------------------------
  * Clip the gradient of a scalar if necessary. This function deals with
  * the standard or extended neighborhood.
@@ -2318,6 +2418,169 @@ _iterative_scalar_gradient_old(const cs_mesh_t             *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Recompute the cocg of boundary cells for the scalar least-squares
+ * gradient when reduced precision storage is used.
+ *
+ * Boundary rows are computed once in full precision, then copied to
+ * the full precision cocg (if present, i.e. with precision checks) and
+ * converted to the reduced precision cocg, so both always match.
+ *
+ * parameters:
+ *   m        <-- pointer to associated mesh structure
+ *   fvq      <-- pointer to associated finite volume quantities
+ *   cpl      <-- structure associated with internal coupling, or NULL
+ *   extrap   <-- gradient extrapolation coefficient
+ *   coefbp   <-- B.C. coefficients for boundary face normals
+ *   cocgb    <-- saved boundary cell cocg (interior faces contribution)
+ *   cocg     <-> full precision cocg, or NULL
+ *   cocg_r   <-> reduced precision cocg
+ *----------------------------------------------------------------------------*/
+
+static void
+_recompute_b_cocg_lsq_r(const cs_mesh_t               *m,
+                        const cs_mesh_quantities_t    *fvq,
+                        const cs_internal_coupling_t  *cpl,
+                        cs_real_t                      extrap,
+                        const cs_real_t                coefbp[],
+                        const cs_real_33_t            *cocgb,
+                        cs_real_33_t                  *cocg,
+                        float                         *cocg_r)
+{
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_int_t *isympa = fvq->b_sym_flag;
+
+  const bool  *coupled_faces = (cpl == NULL) ?
+    NULL : (const bool *)cpl->coupled_faces;
+
+  cs_lnum_t *b_cell_id = NULL;
+  cs_real_33_t *b_cocg = NULL;
+
+  BFT_MALLOC(b_cell_id, m->n_cells, cs_lnum_t);
+  BFT_MALLOC(b_cocg, n_b_cells, cs_real_33_t);
+
+# pragma omp parallel for if (n_b_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+    b_cell_id[m->b_cells[ii]] = ii;
+    for (int ll = 0; ll < 3; ll++) {
+      for (int mm = 0; mm < 3; mm++)
+        b_cocg[ii][ll][mm] = cocgb[ii][ll][mm];
+    }
+  }
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        if (cpl != NULL && coupled_faces[face_id])
+          continue;
+
+        const cs_lnum_t b_id = b_cell_id[b_face_cells[face_id]];
+
+        cs_real_t extrab = 1. - isympa[face_id]*extrap*coefbp[face_id];
+        cs_real_t umcbdd = extrab * (1. - coefbp[face_id]) / b_dist[face_id];
+        cs_real_t udbfs = extrab / b_face_surf[face_id];
+        cs_real_3_t dddij;
+
+        for (int ll = 0; ll < 3; ll++)
+          dddij[ll] =   udbfs * b_face_normal[face_id][ll]
+                      + umcbdd * diipb[face_id][ll];
+
+        for (int ll = 0; ll < 3; ll++) {
+          for (int mm = 0; mm < 3; mm++)
+            b_cocg[b_id][ll][mm] += dddij[ll]*dddij[mm];
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+# pragma omp parallel for if (n_b_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+    const cs_lnum_t cell_id = m->b_cells[ii];
+    cs_math_33_inv_cramer_sym_in_place(b_cocg[ii]);
+    if (cocg != NULL) {
+      for (int ll = 0; ll < 3; ll++) {
+        for (int mm = 0; mm < 3; mm++)
+          cocg[cell_id][ll][mm] = b_cocg[ii][ll][mm];
+      }
+    }
+    cs_mesh_quantities_sym_33_to_r((const cs_real_t (*)[3])b_cocg[ii],
+                                   cocg_r + 6*cell_id);
+  }
+
+  BFT_FREE(b_cocg);
+  BFT_FREE(b_cell_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare a scalar least-squares gradient with the one obtained using the
+ * reduced precision cocg, and update associated statistics.
+ *
+ * parameters:
+ *   n_cells    <-- number of cells
+ *   hyd_p_flag <-- flag for hydrostatic pressure
+ *   cocg_r     <-- reduced precision cocg
+ *   f_ext      <-- exterior force generating pressure
+ *   rhsv       <-- gradient right-hand side
+ *   grad       <-- reference gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_cocg_lsq_r(cs_lnum_t                     n_cells,
+                  int                           hyd_p_flag,
+                  const float                  *cocg_r,
+                  const cs_real_3_t             f_ext[],
+                  const cs_real_4_t   *restrict rhsv,
+                  const cs_real_3_t   *restrict grad)
+{
+  double max_diff = 0., max_ref = 0.;
+
+# pragma omp parallel for reduction(max:max_diff, max_ref) \
+  if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    cs_real_3_t g_r;
+    _sym_33_r_3_product(cocg_r + 6*cell_id, rhsv[cell_id], g_r);
+    for (int ll = 0; ll < 3; ll++) {
+      if (hyd_p_flag == 1)
+        g_r[ll] += f_ext[cell_id][ll];
+      double d = fabs(g_r[ll] - grad[cell_id][ll]);
+      double r = fabs(grad[cell_id][ll]);
+      if (d > max_diff)
+        max_diff = d;
+      if (r > max_ref)
+        max_ref = r;
+    }
+  }
+
+  if (max_diff > _cocg_lsq_r_max_diff)
+    _cocg_lsq_r_max_diff = max_diff;
+  if (max_ref > _cocg_lsq_r_max_ref)
+    _cocg_lsq_r_max_ref = max_ref;
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1).
@@ -2414,6 +2677,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   cs_real_33_t   *restrict cocg = fvq->cocg_lsq;
   cs_real_33_t   *restrict _cocg = NULL;
   cs_real_33_t   *restrict _cocgb = NULL;
+  float          *restrict cocg_r = fvq->cocg_lsq_r;
 
   cs_lnum_t  cell_id, face_id, ii, jj, ll, mm;
   int        g_id, t_id;
@@ -2446,6 +2710,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
                                          _cocg);
        cocg = _cocg;
        cocgb = _cocgb;
+       cocg_r = NULL;
        recompute_cocg = true;
      }
    }
@@ -2477,7 +2742,11 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   /* Compute cocg and save contribution at boundaries */
 
-  if (recompute_cocg) {
+  if (recompute_cocg && cocg_r != NULL)
+    _recompute_b_cocg_lsq_r(m, fvq, cpl, extrap, coefbp,
+                            (const cs_real_33_t *)cocgb, cocg, cocg_r);
+
+  else if (recompute_cocg) {
 
     /* Recompute cocg at boundaries, using saved cocgb */
 
@@ -2557,6 +2826,8 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 #     pragma omp parallel for private(face_id, ii, jj, ll, pfac, dc, fctb)
       for (t_id = 0; t_id < n_i_threads; t_id++) {
 
+        cs_timer_t t0 = cs_timer_time();
+
         for (face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
              face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
              face_id++) {
@@ -2617,6 +2888,8 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
         } /* loop on faces */
 
+        _add_thread_time(&t0);
+
       } /* loop on threads */
 
     } /* loop on thread groups */
@@ -2849,7 +3122,19 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   /* Compute gradient */
   /*------------------*/
 
-  if (hyd_p_flag == 1) {
+  if (cocg == NULL) {
+
+#   pragma omp parallel for
+    for (cell_id = 0; cell_id < n_cells; cell_id++) {
+      _sym_33_r_3_product(cocg_r + 6*cell_id, rhsv[cell_id], grad[cell_id]);
+      if (hyd_p_flag == 1) {
+        for (ll = 0; ll < 3; ll++)
+          grad[cell_id][ll] += f_ext[cell_id][ll];
+      }
+    }
+
+  }
+  else if (hyd_p_flag == 1) {
 
 #   pragma omp parallel for
     for (cell_id = 0; cell_id < n_cells; cell_id++) {
@@ -2885,6 +3170,13 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   }
 
+  /* Compare with reduced precision cocg if both are available */
+
+  if (cocg != NULL && cocg_r != NULL)
+    _check_cocg_lsq_r(n_cells, hyd_p_flag, cocg_r, f_ext,
+                      (const cs_real_4_t *)rhsv,
+                      (const cs_real_3_t *)grad);
+
   /* Synchronize halos */
 
   _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
@@ -2897,6 +3189,332 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
    }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalars using least-squares
+ * reconstruction for non-orthogonal meshes (nswrgp > 1), in a single
+ * sweep over faces.
+ *
+ * This is equivalent to successive calls to _lsq_scalar_gradient without
+ * hydrostatic pressure, weighting or internal coupling, but geometric
+ * quantities are loaded only once for all variables.
+ *
+ * As the boundary contribution to cocg depends on each variable's
+ * boundary conditions, cocg is recomputed for boundary cells separately
+ * for each variable; the values matching the last variable are saved,
+ * as with successive calls.
+ *
+ * Values and gradients are interlaced: value k of cell i is pvar[i*n_vars
+ * + k], and its gradient is grad[i*n_vars + k].
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   n_vars         <-- number of variables
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   extrap         <-- gradient extrapolation coefficient
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *                      (for each variable)
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *                      (for each variable)
+ *   pvar           <-- interlaced variables (synchronized)
+ *   grad           --> interlaced gradients (on local cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t                *m,
+                           cs_mesh_quantities_t           *fvq,
+                           cs_halo_type_t                  halo_type,
+                           bool                            recompute_cocg,
+                           int                             n_vars,
+                           cs_real_t                       inc,
+                           cs_real_t                       extrap,
+                           const cs_real_t                *coefap[],
+                           const cs_real_t                *coefbp[],
+                           const cs_real_t       *restrict pvar,
+                           cs_real_3_t           *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_int_t *isympa = fvq->b_sym_flag;
+
+  cs_real_33_t   *restrict cocgb = fvq->cocgb_s_lsq;
+  cs_real_33_t   *restrict cocg = fvq->cocg_lsq;
+  float          *restrict cocg_r = fvq->cocg_lsq_r;
+
+  /* Per-variable cocg for boundary cells, if recomputed */
+
+  cs_lnum_t *b_cell_id = NULL;
+  cs_real_33_t *b_cocg = NULL;
+
+  if (recompute_cocg) {
+
+    BFT_MALLOC(b_cell_id, n_cells, cs_lnum_t);
+    BFT_MALLOC(b_cocg, n_b_cells*n_vars, cs_real_33_t);
+
+#   pragma omp parallel for if (n_b_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      b_cell_id[m->b_cells[ii]] = ii;
+      for (int k = 0; k < n_vars; k++) {
+        for (int ll = 0; ll < 3; ll++) {
+          for (int mm = 0; mm < 3; mm++)
+            b_cocg[ii*n_vars + k][ll][mm] = cocgb[ii][ll][mm];
+        }
+      }
+    }
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
+
+          const cs_lnum_t ii = b_face_cells[face_id];
+          const cs_lnum_t b_id = b_cell_id[ii];
+
+          for (int k = 0; k < n_vars; k++) {
+
+            cs_real_t cb = coefbp[k][face_id];
+            cs_real_t extrab = 1. - isympa[face_id]*extrap*cb;
+            cs_real_t umcbdd = extrab * (1. - cb) / b_dist[face_id];
+            cs_real_t udbfs = extrab / b_face_surf[face_id];
+            cs_real_3_t dddij;
+
+            for (int ll = 0; ll < 3; ll++)
+              dddij[ll] =   udbfs * b_face_normal[face_id][ll]
+                          + umcbdd * diipb[face_id][ll];
+
+            for (int ll = 0; ll < 3; ll++) {
+              for (int mm = 0; mm < 3; mm++)
+                b_cocg[b_id*n_vars + k][ll][mm] += dddij[ll]*dddij[mm];
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+#   pragma omp parallel for if (n_b_cells*n_vars > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells*n_vars; ii++)
+      cs_math_33_inv_cramer_sym_in_place(b_cocg[ii]);
+
+  } /* End of recompute_cocg */
+
+  /* Compute Right-Hand Side */
+  /*-------------------------*/
+
+  cs_real_3_t *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext*n_vars, cs_real_3_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells_ext*n_vars; ii++) {
+    rhsv[ii][0] = 0.0;
+    rhsv[ii][1] = 0.0;
+    rhsv[ii][2] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        const cs_lnum_t ii = i_face_cells[face_id][0];
+        const cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_3_t dc;
+        for (int ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        const cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+        for (int k = 0; k < n_vars; k++) {
+
+          /* (P_j - P_i) / ||d||^2 */
+          cs_real_t pfac = (pvar[jj*n_vars + k] - pvar[ii*n_vars + k]) / ddc;
+
+          for (int ll = 0; ll < 3; ll++) {
+            cs_real_t fctb = dc[ll] * pfac;
+            rhsv[ii*n_vars + k][ll] += fctb;
+            rhsv[jj*n_vars + k][ll] += fctb;
+          }
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (halo_type == CS_HALO_EXTENDED) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        const cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_3_t dc;
+        for (int ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        const cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+        for (int k = 0; k < n_vars; k++) {
+          cs_real_t pfac = (pvar[jj*n_vars + k] - pvar[ii*n_vars + k]) / ddc;
+          for (int ll = 0; ll < 3; ll++)
+            rhsv[ii*n_vars + k][ll] += dc[ll] * pfac;
+        }
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        const cs_lnum_t ii = b_face_cells[face_id];
+
+        const cs_real_t unddij = 1. / b_dist[face_id];
+        const cs_real_t udbfs = 1. / b_face_surf[face_id];
+
+        for (int k = 0; k < n_vars; k++) {
+
+          cs_real_t ca = coefap[k][face_id], cb = coefbp[k][face_id];
+
+          cs_real_t extrab = pow((1. - isympa[face_id]*extrap*cb), 2.0);
+          cs_real_t umcbdd = (1. - cb) * unddij;
+
+          cs_real_t pfac =   (ca*inc + (cb -1.)*pvar[ii*n_vars + k])
+                           * unddij * extrab;
+
+          for (int ll = 0; ll < 3; ll++) {
+            cs_real_t dsij =   udbfs * b_face_normal[face_id][ll]
+                             + umcbdd*diipb[face_id][ll];
+            rhsv[ii*n_vars + k][ll] += dsij * pfac;
+          }
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Compute gradient */
+  /*------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    for (int k = 0; k < n_vars; k++) {
+      const cs_real_t *r = rhsv[cell_id*n_vars + k];
+      cs_real_t *g = grad[cell_id*n_vars + k];
+      if (cocg == NULL)
+        _sym_33_r_3_product(cocg_r + 6*cell_id, r, g);
+      else {
+        for (int ll = 0; ll < 3; ll++)
+          g[ll] =   cocg[cell_id][ll][0] * r[0]
+                  + cocg[cell_id][ll][1] * r[1]
+                  + cocg[cell_id][ll][2] * r[2];
+      }
+    }
+  }
+
+  if (recompute_cocg) {
+
+#   pragma omp parallel for if (n_b_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+
+      const cs_lnum_t cell_id = m->b_cells[ii];
+
+      for (int k = 0; k < n_vars; k++) {
+        const cs_real_t (*_cocg)[3]
+          = (const cs_real_t (*)[3])b_cocg[ii*n_vars + k];
+        const cs_real_t *r = rhsv[cell_id*n_vars + k];
+        cs_real_t *g = grad[cell_id*n_vars + k];
+        for (int ll = 0; ll < 3; ll++)
+          g[ll] =   _cocg[ll][0] * r[0]
+                  + _cocg[ll][1] * r[1]
+                  + _cocg[ll][2] * r[2];
+      }
+
+      /* Keep cocg matching the last variable */
+
+      if (cocg != NULL) {
+        for (int ll = 0; ll < 3; ll++) {
+          for (int mm = 0; mm < 3; mm++)
+            cocg[cell_id][ll][mm] = b_cocg[ii*n_vars + n_vars-1][ll][mm];
+        }
+      }
+      if (cocg_r != NULL)
+        cs_mesh_quantities_sym_33_to_r
+          ((const cs_real_t (*)[3])b_cocg[ii*n_vars + n_vars-1],
+           cocg_r + 6*cell_id);
+
+    }
+
+    BFT_FREE(b_cocg);
+    BFT_FREE(b_cell_id);
+
+  }
+
+  BFT_FREE(rhsv);
+}
+
 /*----------------------------------------------------------------------------
  * Clip the gradient of a vector if necessary. This function deals with the
  * standard or extended neighborhood.
@@ -4556,6 +5174,8 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
                                     i, j, pfac, dc, fctb, ddc)
     for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
+      cs_timer_t t0 = cs_timer_time();
+
       for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
            face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
            face_id++) {
@@ -4597,6 +5217,8 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
 
       } /* loop on faces */
 
+      _add_thread_time(&t0);
+
     } /* loop on threads */
 
   } /* loop on thread groups */
@@ -4687,13 +5309,22 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
   /*------------------*/
 
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    cs_real_t _cocg[3][3];
+    const cs_real_t (*c_cocg)[3] = (const cs_real_t (*)[3])_cocg;
+
+    if (cocg != NULL)
+      c_cocg = (const cs_real_t (*)[3])cocg[cell_id];
+    else
+      cs_mesh_quantities_sym_33_from_r(fvq->cocg_lsq_r + 6*cell_id, _cocg);
+
     for (j = 0; j < 3; j++) {
       for (i = 0; i < 3; i++) {
 
         gradv[cell_id][i][j] = 0.0;
 
         for (k = 0; k < 3; k++)
-          gradv[cell_id][i][j] += rhs[cell_id][i][k] * cocg[cell_id][k][j];
+          gradv[cell_id][i][j] += rhs[cell_id][i][k] * c_cocg[k][j];
 
       }
     }
@@ -4963,13 +5594,22 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
   /*------------------*/
 
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    cs_real_t _cocg[3][3];
+    const cs_real_t (*c_cocg)[3] = (const cs_real_t (*)[3])_cocg;
+
+    if (cocg != NULL)
+      c_cocg = (const cs_real_t (*)[3])cocg[cell_id];
+    else
+      cs_mesh_quantities_sym_33_from_r(fvq->cocg_lsq_r + 6*cell_id, _cocg);
+
     for (int j = 0; j < 3; j++) {
       for (int i = 0; i < 6; i++) {
 
         gradt[cell_id][i][j] = 0.0;
 
         for (int k = 0; k < 3; k++)
-          gradt[cell_id][i][j] += rhs[cell_id][i][k] * cocg[cell_id][k][j];
+          gradt[cell_id][i][j] += rhs[cell_id][i][k] * c_cocg[k][j];
 
       }
     }
@@ -6207,7 +6847,7 @@ _gradient_scalar(const char                    *var_name,
 
   if (n_r_sweeps > 0) {
     int prev_fvq_count = last_fvm_count;
-    last_fvm_count = cs_mesh_quantities_compute_count();
+    last_fvm_count = cs_mesh_quantities_cocg_compute_count();
     if (last_fvm_count != prev_fvq_count)
       recompute_cocg = true;
   }
@@ -6890,6 +7530,25 @@ cs_gradient_finalize(void)
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
+  /* Reduced precision least-squares cocg check */
+
+  if (cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_PRECISION_CHECK) {
+
+    cs_parall_max(1, CS_DOUBLE, &_cocg_lsq_r_max_diff);
+    cs_parall_max(1, CS_DOUBLE, &_cocg_lsq_r_max_ref);
+
+    double rel_diff = (_cocg_lsq_r_max_ref > 0.) ?
+      _cocg_lsq_r_max_diff / _cocg_lsq_r_max_ref : 0.;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\nReduced precision least-squares cocg check:\n\n"
+                    "  Max. absolute gradient difference: %12.5e\n"
+                    "  Max. relative gradient difference: %12.5e\n"),
+                  _cocg_lsq_r_max_diff, rel_diff);
+    cs_log_separator(CS_LOG_PERFORMANCE);
+
+  }
+
   BFT_FREE(cs_glob_gradient_systems);
 
   cs_glob_gradient_n_systems = 0;
@@ -7022,6 +7681,194 @@ cs_gradient_scalar(const char                *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields sharing the
+ *         same gradient options.
+ *
+ * This is equivalent to successive calls to \ref cs_gradient_scalar
+ * (without hydrostatic pressure, weighting, or internal coupling), but
+ * halos of all variables are synchronized in a single exchange, and for
+ * the least-squares gradient with reconstruction, all gradients are
+ * computed in a single sweep over faces, with synchronization of the
+ * results also aggregated.
+ * Other gradient types are computed variable by variable.
+ *
+ * Meshes with rotation periodicity are not handled.
+ *
+ * \param[in]       n_vars          number of variables
+ * \param[in]       var_name        variable names
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       extrap          boundary gradient extrapolation coefficient
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a, per variable
+ * \param[in]       bc_coeff_b      boundary condition term b, per variable
+ * \param[in, out]  var             gradients' base variables
+ * \param[out]      grad            gradients, per variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                        n_vars,
+                         const char                *var_name[],
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        verbosity,
+                         int                        clip_mode,
+                         double                     epsilon,
+                         double                     extrap,
+                         double                     clip_coeff,
+                         const cs_real_t           *bc_coeff_a[],
+                         const cs_real_t           *bc_coeff_b[],
+                         cs_real_t                 *var[],
+                         cs_real_3_t               *grad[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  cs_timer_t t0, t1;
+
+  static int last_fvm_count = 0;
+
+  if (n_vars < 1)
+    return;
+
+  /* Components of vectors or tensors would require specific handling
+     of rotation periodicity, which is not available here */
+
+  if (mesh->have_rotation_perio)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: not available with rotation periodicity\n"
+                "(variable \"%s\" and %d others)."),
+              __func__, var_name[0], n_vars - 1);
+
+  t0 = cs_timer_time();
+
+  /* Synchronize variables */
+
+  _sync_scalars_multi(mesh, halo_type, n_vars, var);
+
+  if (gradient_type == CS_GRADIENT_LSQ && n_r_sweeps > 1) {
+
+    const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+
+    int prev_fvq_count = last_fvm_count;
+    last_fvm_count = cs_mesh_quantities_cocg_compute_count();
+    if (last_fvm_count != prev_fvq_count)
+      recompute_cocg = true;
+
+    /* Interlaced values and gradients */
+
+    cs_real_t *pvar;
+    cs_real_3_t *_grad;
+
+    BFT_MALLOC(pvar, n_cells_ext*n_vars, cs_real_t);
+    BFT_MALLOC(_grad, n_cells_ext*n_vars, cs_real_3_t);
+
+#   pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cells_ext; i++) {
+      for (int k = 0; k < n_vars; k++)
+        pvar[i*n_vars + k] = var[k][i];
+    }
+
+    _lsq_scalar_gradient_multi(mesh,
+                               fvq,
+                               halo_type,
+                               recompute_cocg,
+                               n_vars,
+                               inc,
+                               extrap,
+                               bc_coeff_a,
+                               bc_coeff_b,
+                               pvar,
+                               _grad);
+
+    BFT_FREE(pvar);
+
+    if (mesh->halo != NULL)
+      cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD,
+                               (cs_real_t *)_grad, 3*n_vars);
+
+#   pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cells_ext; i++) {
+      for (int k = 0; k < n_vars; k++) {
+        for (int ll = 0; ll < 3; ll++)
+          grad[k][i][ll] = _grad[i*n_vars + k][ll];
+      }
+    }
+
+    BFT_FREE(_grad);
+
+    for (int k = 0; k < n_vars; k++) {
+
+      if (mesh->halo != NULL && mesh->n_init_perio > 0)
+        cs_halo_perio_sync_var_vect(mesh->halo, CS_HALO_STANDARD,
+                                    (cs_real_t *)grad[k], 3);
+
+      _scalar_gradient_clipping(halo_type, clip_mode, verbosity, 0,
+                                clip_coeff, var[k], grad[k]);
+
+      if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+        cs_bad_cells_regularisation_vector(grad[k], 0);
+
+    }
+
+  }
+
+  else {
+
+    for (int k = 0; k < n_vars; k++)
+      _gradient_scalar(var_name[k],
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       recompute_cocg,
+                       n_r_sweeps,
+                       0,             /* tr_dim */
+                       0,             /* hyd_p_flag */
+                       1,             /* w_stride */
+                       verbosity,
+                       clip_mode,
+                       epsilon,
+                       extrap,
+                       clip_coeff,
+                       NULL,          /* f_ext */
+                       bc_coeff_a[k],
+                       bc_coeff_b[k],
+                       var[k],
+                       NULL,          /* c_weight */
+                       NULL,          /* cpl */
+                       grad[k]);
+
+  }
+
+  t1 = cs_timer_time();
+
+  /* Time is shared evenly among variables for logging */
+
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  for (int k = 0; k < n_vars; k++) {
+    cs_gradient_info_t *gradient_info
+      = _find_or_add_system(var_name[k], gradient_type);
+    gradient_info->n_calls += 1;
+    gradient_info->t_tot.wall_nsec += dt.wall_nsec / n_vars;
+    gradient_info->t_tot.cpu_nsec += dt.cpu_nsec / n_vars;
+  }
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
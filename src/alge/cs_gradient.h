@@ -219,6 +219,58 @@ cs_gradient_scalar(const char                *var_name,
                    cs_internal_coupling_t    *cpl,
                    cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields sharing the
+ *         same gradient options.
+ *
+ * This is equivalent to successive calls to \ref cs_gradient_scalar
+ * (without hydrostatic pressure, weighting, or internal coupling), but
+ * halos of all variables are synchronized in a single exchange, and for
+ * the least-squares gradient with reconstruction, all gradients are
+ * computed in a single sweep over faces, with synchronization of the
+ * results also aggregated.
+ * Other gradient types are computed variable by variable.
+ *
+ * Meshes with rotation periodicity are not handled.
+ *
+ * \param[in]       n_vars          number of variables
+ * \param[in]       var_name        variable names
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       extrap          boundary gradient extrapolation coefficient
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a, per variable
+ * \param[in]       bc_coeff_b      boundary condition term b, per variable
+ * \param[in, out]  var             gradients' base variables
+ * \param[out]      grad            gradients, per variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(int                        n_vars,
+                         const char                *var_name[],
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        verbosity,
+                         int                        clip_mode,
+                         double                     epsilon,
+                         double                     extrap,
+                         double                     clip_coeff,
+                         const cs_real_t           *bc_coeff_a[],
+                         const cs_real_t           *bc_coeff_b[],
+                         cs_real_t                 *var[],
+                         cs_real_3_t               *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -791,6 +791,10 @@ _set_coeffs_native(cs_matrix_t        *matrix,
     if (copy) {
       if (mc->_da == NULL || mc->max_db_size < matrix->db_size[3]) {
         BFT_REALLOC(mc->_da, matrix->db_size[3]*ms->n_rows, cs_real_t);
+        cs_numbering_first_touch(NULL,
+                                 ms->n_rows,
+                                 matrix->db_size[3]*sizeof(cs_real_t),
+                                 mc->_da);
         mc->max_db_size = matrix->db_size[3];
       }
       memcpy(mc->_da, da, matrix->db_size[3]*sizeof(cs_real_t) * ms->n_rows);
@@ -813,6 +817,11 @@ _set_coeffs_native(cs_matrix_t        *matrix,
     if (copy) {
       if (mc->_xa == NULL || mc->max_eb_size < matrix->eb_size[3]) {
         BFT_MALLOC(mc->_xa, matrix->eb_size[3]*xa_n_vals, cs_real_t);
+        cs_numbering_first_touch(matrix->numbering,
+                                 ms->n_edges,
+                                 matrix->eb_size[3]*(symmetric ? 1 : 2)
+                                 *sizeof(cs_real_t),
+                                 mc->_xa);
         mc->max_eb_size = matrix->eb_size[3];
       }
       memcpy(mc->_xa, xa, matrix->eb_size[3]*xa_n_vals*sizeof(cs_real_t));
@@ -2223,8 +2232,11 @@ _set_coeffs_csr(cs_matrix_t      *matrix,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
-  if (mc->_val == NULL)
+  if (mc->_val == NULL) {
     BFT_MALLOC(mc->_val, ms->row_index[ms->n_rows], cs_real_t);
+    cs_numbering_first_touch_indexed(ms->n_rows, ms->row_index,
+                                     sizeof(cs_real_t), mc->_val);
+  }
   mc->val = mc->_val;
 
   /* Initialize coefficients to zero if assembly is incremental */
@@ -2348,8 +2360,11 @@ _set_coeffs_csr_from_msr(cs_matrix_t       *matrix,
 
   /* Allocate local array */
 
-  if (mc->_val == NULL)
+  if (mc->_val == NULL) {
     BFT_MALLOC(mc->_val, ms->row_index[ms->n_rows], cs_real_t);
+    cs_numbering_first_touch_indexed(ms->n_rows, ms->row_index,
+                                     sizeof(cs_real_t), mc->_val);
+  }
 
   mc->val = mc->_val;
 
@@ -2963,8 +2978,11 @@ _set_coeffs_csr_sym(cs_matrix_t        *matrix,
 
   const cs_matrix_struct_csr_sym_t  *ms = matrix->structure;
 
-  if (mc->val == NULL)
+  if (mc->val == NULL) {
     BFT_MALLOC(mc->val, ms->row_index[ms->n_rows], cs_real_t);
+    cs_numbering_first_touch_indexed(ms->n_rows, ms->row_index,
+                                     sizeof(cs_real_t), mc->val);
+  }
 
   /* Initialize coefficients to zero if assembly is incremental */
 
@@ -3573,8 +3591,11 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   /* Extradiagonal values */
 
-  if (mc->_x_val == NULL)
+  if (mc->_x_val == NULL) {
     BFT_MALLOC(mc->_x_val, ms->row_index[ms->n_rows], cs_real_t);
+    cs_numbering_first_touch_indexed(ms->n_rows, ms->row_index,
+                                     sizeof(cs_real_t), mc->_x_val);
+  }
   mc->x_val = mc->_x_val;
 
   /* Copy extra-diagonal values if assembly is direct */
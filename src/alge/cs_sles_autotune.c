@@ -0,0 +1,1016 @@
+/*============================================================================
+ * Runtime selection of sparse linear equation solvers
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_log.h"
+#include "cs_matrix.h"
+#include "cs_multigrid.h"
+#include "cs_parall.h"
+#include "cs_post.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
+#include "cs_time_step.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_sles_autotune.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_sles_autotune.c
+
+  \brief Runtime selection of sparse linear equation solvers.
+
+  An autotuned solver holds a set of candidate solver and preconditioner
+  combinations (Krylov solvers with Jacobi, polynomial or multigrid
+  preconditioning, and multigrid solvers with different smoothers
+  and coarsening options), chosen based on the matrix properties.
+
+  During an evaluation phase, candidates are used in turn at successive
+  time steps, and the elapsed time of each resolution (setup and solve,
+  until the required tolerance is reached) is accumulated. Once each
+  candidate has been used for the requested number of time steps, the
+  fastest candidate which did not fail to converge is selected and used
+  for subsequent resolutions. The evaluation may be repeated periodically,
+  as the system's conditioning may evolve during a computation.
+
+  Candidates are interleaved over time steps rather than evaluated in
+  sequence, so that slow changes in the solution do not favor one
+  candidate over another. To ensure all ranks use the same solver,
+  the maximum time over ranks is used for the comparison.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_SLES_AUTOTUNE_MAX_CANDIDATES 8
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+/* Candidate solver */
+
+typedef struct {
+
+  char                  description[64];  /* description for logging */
+
+  void                 *context;          /* solver context */
+
+  cs_sles_setup_t      *setup_func;       /* setup function */
+  cs_sles_solve_t      *solve_func;       /* solve function */
+  cs_sles_free_t       *free_func;        /* free function */
+  cs_sles_log_t        *log_func;         /* logging function */
+  cs_sles_destroy_t    *destroy_func;     /* destruction function */
+
+  int                   n_samples;        /* number of timed resolutions
+                                             in current evaluation */
+  int                   n_failures;       /* number of failed resolutions
+                                             in current evaluation */
+  double                t_sum;            /* sum of timed resolutions
+                                             in current evaluation */
+
+  int                   n_calls;          /* total number of solves */
+  int                   n_selections;     /* number of times selected */
+
+} _autotune_candidate_t;
+
+/* Autotuned solver context */
+
+struct _cs_sles_autotune_t {
+
+  int                     n_trial_steps;     /* time steps per candidate */
+  int                     reeval_interval;   /* re-evaluation interval */
+  int                     n_max_iter;        /* max. iterations */
+
+  int                     n_candidates;      /* number of candidates */
+  _autotune_candidate_t  *candidates;        /* candidates, or NULL
+                                                before first setup */
+
+  bool                    evaluating;        /* evaluation phase ? */
+  int                     nt_phase_start;    /* time step at phase start */
+  int                     n_evaluations;     /* number of evaluations */
+
+  int                     selected;          /* selected candidate, or -1 */
+  int                     active;            /* candidate used for current
+                                                resolution, or -1 */
+  bool                    timed;             /* is current resolution
+                                                timed ? */
+  cs_timer_counter_t      t_resolution;      /* current resolution time */
+
+};
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+static int _n_trial_steps_default = 0;
+static int _reeval_interval_default = 0;
+
+static const int _n_max_iter_default = 10000;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Add an iterative solver candidate.
+ *
+ * parameters:
+ *   at          <-> pointer to autotuned solver context
+ *   description <-- candidate description
+ *   c           <-- iterative solver context
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_it_candidate(cs_sles_autotune_t  *at,
+                  const char          *description,
+                  cs_sles_it_t        *c)
+{
+  assert(at->n_candidates < CS_SLES_AUTOTUNE_MAX_CANDIDATES);
+
+  _autotune_candidate_t *cd = at->candidates + at->n_candidates;
+
+  strncpy(cd->description, description, 63);
+  cd->description[63] = '\0';
+
+  cd->context = c;
+  cd->setup_func = cs_sles_it_setup;
+  cd->solve_func = cs_sles_it_solve;
+  cd->free_func = cs_sles_it_free;
+  cd->log_func = cs_sles_it_log;
+  cd->destroy_func = cs_sles_it_destroy;
+
+  at->n_candidates += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a multigrid solver candidate.
+ *
+ * parameters:
+ *   at          <-> pointer to autotuned solver context
+ *   description <-- candidate description
+ *   mg          <-- multigrid solver context
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_mg_candidate(cs_sles_autotune_t  *at,
+                  const char          *description,
+                  cs_multigrid_t      *mg)
+{
+  assert(at->n_candidates < CS_SLES_AUTOTUNE_MAX_CANDIDATES);
+
+  _autotune_candidate_t *cd = at->candidates + at->n_candidates;
+
+  strncpy(cd->description, description, 63);
+  cd->description[63] = '\0';
+
+  cd->context = mg;
+  cd->setup_func = cs_multigrid_setup;
+  cd->solve_func = cs_multigrid_solve;
+  cd->free_func = cs_multigrid_free;
+  cd->log_func = cs_multigrid_log;
+  cd->destroy_func = cs_multigrid_destroy;
+
+  at->n_candidates += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Build candidate solvers based on matrix properties.
+ *
+ * The first candidate is always a Jacobi-preconditioned Krylov solver,
+ * which is used as a fallback when another candidate fails.
+ *
+ * parameters:
+ *   at <-> pointer to autotuned solver context
+ *   a  <-- associated matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_candidates(cs_sles_autotune_t  *at,
+                  const cs_matrix_t   *a)
+{
+  const bool symmetric = cs_matrix_is_symmetric(a);
+  const bool msr = (cs_matrix_get_type(a) == CS_MATRIX_MSR) ? true : false;
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  const int *eb_size = cs_matrix_get_extra_diag_block_size(a);
+
+  /* Multigrid only handles scalar systems here */
+
+  const bool scalar = (db_size[0] == 1 && eb_size[0] == 1) ? true : false;
+
+  const int n_max_iter = at->n_max_iter;
+
+  BFT_MALLOC(at->candidates,
+             CS_SLES_AUTOTUNE_MAX_CANDIDATES,
+             _autotune_candidate_t);
+  memset(at->candidates,
+         0,
+         CS_SLES_AUTOTUNE_MAX_CANDIDATES*sizeof(_autotune_candidate_t));
+
+  at->n_candidates = 0;
+
+  if (symmetric) {
+
+    _add_it_candidate(at, "PCG, Jacobi",
+                      cs_sles_it_create(CS_SLES_PCG, 0, n_max_iter, true));
+    _add_it_candidate(at, "PCG, polynomial degree 1",
+                      cs_sles_it_create(CS_SLES_PCG, 1, n_max_iter, true));
+
+    if (scalar) {
+
+      /* Same settings as default multigrid preconditioning */
+
+      if (msr) {
+        cs_sles_it_t *c = cs_sles_it_create(CS_SLES_PCG, -1, n_max_iter, true);
+        cs_sles_pc_t *pc = cs_multigrid_pc_create();
+        cs_multigrid_t *mg = cs_sles_pc_get_context(pc);
+        cs_sles_it_transfer_pc(c, &pc);
+        cs_multigrid_set_solver_options(mg,
+                                        CS_SLES_P_SYM_GAUSS_SEIDEL,
+                                        CS_SLES_P_SYM_GAUSS_SEIDEL,
+                                        CS_SLES_PCG,
+                                        1,    /* n max cycles */
+                                        1,    /* n max iter for descent */
+                                        1,    /* n max iter for ascent */
+                                        500,  /* n max iter for coarse solve */
+                                        0, 0, -1,  /* precond degree */
+                                        -1, -1, 1); /* precision multiplier */
+        _add_it_candidate(at, "PCG, multigrid", c);
+      }
+
+      _add_mg_candidate(at, "Multigrid", cs_multigrid_create());
+
+      if (msr) {
+        cs_multigrid_t *mg = cs_multigrid_create();
+        cs_multigrid_set_solver_options(mg,
+                                        CS_SLES_P_SYM_GAUSS_SEIDEL,
+                                        CS_SLES_P_SYM_GAUSS_SEIDEL,
+                                        CS_SLES_PCG,
+                                        100,  /* n max cycles */
+                                        1,    /* n max iter for descent */
+                                        1,    /* n max iter for ascent */
+                                        500,  /* n max iter for coarse solve */
+                                        0, 0, 0,  /* precond degree */
+                                        1, 1, 1); /* precision multiplier */
+        _add_mg_candidate(at, "Multigrid, sym. Gauss-Seidel smoothers", mg);
+      }
+
+      cs_multigrid_t *mg = cs_multigrid_create();
+      cs_multigrid_set_coarsening_options(mg,
+                                          8,     /* aggregation_limit */
+                                          0,     /* coarsening_type */
+                                          25,    /* n_max_levels */
+                                          30,    /* min_g_cells */
+                                          0.95,  /* P0P1 relaxation */
+                                          0);    /* postprocess */
+      _add_mg_candidate(at, "Multigrid, aggregation limit 8", mg);
+
+    }
+
+  }
+  else {
+
+    _add_it_candidate(at, "BiCGStab, Jacobi",
+                      cs_sles_it_create(CS_SLES_BICGSTAB, 0, n_max_iter,
+                                        true));
+    _add_it_candidate(at, "BiCGStab, polynomial degree 1",
+                      cs_sles_it_create(CS_SLES_BICGSTAB, 1, n_max_iter,
+                                        true));
+    _add_it_candidate(at, "GMRES, Jacobi",
+                      cs_sles_it_create(CS_SLES_GMRES, 0, n_max_iter, true));
+    _add_it_candidate(at, "GMRES, polynomial degree 1",
+                      cs_sles_it_create(CS_SLES_GMRES, 1, n_max_iter, true));
+
+    /* Gauss-Seidel requires MSR matrix, not available for full blocks */
+
+    if (msr)
+      _add_it_candidate(at, "Symmetric Gauss-Seidel",
+                        cs_sles_it_create(CS_SLES_P_SYM_GAUSS_SEIDEL, -1,
+                                          n_max_iter, true));
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Select the best candidate of the current evaluation phase.
+ *
+ * The maximum mean resolution time over ranks is compared, so that
+ * the selection is identical on all ranks.
+ *
+ * parameters:
+ *   at   <-> pointer to autotuned solver context
+ *   name <-- pointer to system name
+ *----------------------------------------------------------------------------*/
+
+static void
+_select_best(cs_sles_autotune_t  *at,
+             const char          *name)
+{
+  double t_mean[CS_SLES_AUTOTUNE_MAX_CANDIDATES];
+
+  for (int i = 0; i < at->n_candidates; i++) {
+    const _autotune_candidate_t *cd = at->candidates + i;
+    t_mean[i] = (cd->n_samples > 0) ? cd->t_sum / cd->n_samples : 0.;
+  }
+
+  cs_parall_max(at->n_candidates, CS_DOUBLE, t_mean);
+
+  int best = -1;
+  for (int i = 0; i < at->n_candidates; i++) {
+    const _autotune_candidate_t *cd = at->candidates + i;
+    if (cd->n_samples < 1 || cd->n_failures > 0)
+      continue;
+    if (best < 0 || t_mean[i] < t_mean[best])
+      best = i;
+  }
+
+  /* The fallback candidate is used if no other candidate was timed */
+
+  if (best < 0)
+    best = 0;
+
+  at->selected = best;
+  at->candidates[best].n_selections += 1;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "  Linear solver autotuning for \"%s\":\n\n"
+                  "    Candidate                                "
+                  "  samples  failures  mean time\n"),
+                name);
+
+  for (int i = 0; i < at->n_candidates; i++) {
+    const _autotune_candidate_t *cd = at->candidates + i;
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "  %c %-42s %8d  %8d  %9.3e\n",
+                  (i == best) ? '*' : ' ', cd->description,
+                  cd->n_samples, cd->n_failures, t_mean[i]);
+  }
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n    selected: %s\n"),
+                at->candidates[best].description);
+}
+
+/*----------------------------------------------------------------------------
+ * Choose candidate for the current resolution, updating the
+ * evaluation state based on the current time step.
+ *
+ * parameters:
+ *   at   <-> pointer to autotuned solver context
+ *   name <-- pointer to system name
+ *----------------------------------------------------------------------------*/
+
+static void
+_choose_candidate(cs_sles_autotune_t  *at,
+                  const char          *name)
+{
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  /* Start a new evaluation if required */
+
+  if (   !at->evaluating && at->reeval_interval > 0
+      && nt_cur - at->nt_phase_start >= at->reeval_interval) {
+
+    at->evaluating = true;
+    at->nt_phase_start = nt_cur;
+
+    for (int i = 0; i < at->n_candidates; i++) {
+      at->candidates[i].n_samples = 0;
+      at->candidates[i].n_failures = 0;
+      at->candidates[i].t_sum = 0.;
+    }
+
+  }
+
+  if (at->evaluating) {
+
+    int k = nt_cur - at->nt_phase_start;
+    if (k < 0)
+      k = 0;
+
+    if (k >= at->n_candidates * at->n_trial_steps) {
+      _select_best(at, name);
+      at->evaluating = false;
+      at->nt_phase_start = nt_cur;
+      at->n_evaluations += 1;
+    }
+    else {
+      int i = k % at->n_candidates;
+      if (at->candidates[i].n_failures > 0)
+        i = 0;
+      at->active = i;
+      at->timed = (i == k % at->n_candidates) ? true : false;
+    }
+
+  }
+
+  if (!at->evaluating) {
+    at->active = at->selected;
+    at->timed = false;
+  }
+
+  CS_TIMER_COUNTER_INIT(at->t_resolution);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define autotuned sparse linear system solver for a given field
+ *        or equation name.
+ *
+ * If this system did not previously exist, it is added to the list of
+ * "known" systems. Otherwise, its definition is replaced by the one
+ * defined here.
+ *
+ * This is a utility function: if finer control is needed, see
+ * \ref cs_sles_define and \ref cs_sles_autotune_create.
+ *
+ * \param[in]  f_id             associated field id, or < 0
+ * \param[in]  name             associated name if f_id < 0, or NULL
+ * \param[in]  n_trial_steps    number of time steps evaluated per candidate
+ * \param[in]  reeval_interval  number of time steps after which candidates
+ *                              are evaluated again, or 0 for never
+ *
+ * \return  pointer to newly created autotuned solver info object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_autotune_t *
+cs_sles_autotune_define(int          f_id,
+                        const char  *name,
+                        int          n_trial_steps,
+                        int          reeval_interval)
+{
+  cs_sles_autotune_t *
+    at = cs_sles_autotune_create(n_trial_steps,
+                                 reeval_interval,
+                                 _n_max_iter_default);
+
+  cs_sles_t *sc = cs_sles_define(f_id,
+                                 name,
+                                 at,
+                                 "cs_sles_autotune_t",
+                                 cs_sles_autotune_setup,
+                                 cs_sles_autotune_solve,
+                                 cs_sles_autotune_free,
+                                 cs_sles_autotune_log,
+                                 cs_sles_autotune_copy,
+                                 cs_sles_autotune_destroy);
+
+  cs_sles_set_error_handler(sc,
+                            cs_sles_autotune_error_post_and_abort);
+
+  return at;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create autotuned sparse linear system solver info and context.
+ *
+ * Candidate solvers are built at the first setup, based on the matrix
+ * properties (symmetry, storage, block size).
+ *
+ * \param[in]  n_trial_steps    number of time steps evaluated per candidate
+ * \param[in]  reeval_interval  number of time steps after which candidates
+ *                              are evaluated again, or 0 for never
+ * \param[in]  n_max_iter       maximum number of iterations of candidates
+ *
+ * \return  pointer to newly created solver info object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_autotune_t *
+cs_sles_autotune_create(int  n_trial_steps,
+                        int  reeval_interval,
+                        int  n_max_iter)
+{
+  cs_sles_autotune_t *at;
+
+  BFT_MALLOC(at, 1, cs_sles_autotune_t);
+
+  at->n_trial_steps = CS_MAX(n_trial_steps, 1);
+  at->reeval_interval = CS_MAX(reeval_interval, 0);
+  at->n_max_iter = n_max_iter;
+
+  at->n_candidates = 0;
+  at->candidates = NULL;
+
+  at->evaluating = true;
+  at->nt_phase_start = -1;
+  at->n_evaluations = 0;
+
+  at->selected = -1;
+  at->active = -1;
+  at->timed = false;
+  CS_TIMER_COUNTER_INIT(at->t_resolution);
+
+  return at;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create autotuned sparse linear system solver info and context
+ *        based on existing info and context.
+ *
+ * \param[in]  context  pointer to reference info and context
+ *                      (actual type: cs_sles_autotune_t  *)
+ *
+ * \return  pointer to newly created solver info object.
+ *          (actual type: cs_sles_autotune_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_sles_autotune_copy(const void  *context)
+{
+  cs_sles_autotune_t *d = NULL;
+
+  if (context != NULL) {
+    const cs_sles_autotune_t *c = context;
+    d = cs_sles_autotune_create(c->n_trial_steps,
+                                c->reeval_interval,
+                                c->n_max_iter);
+  }
+
+  return d;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy autotuned sparse linear system solver info and context.
+ *
+ * \param[in, out]  context  pointer to solver info and context
+ *                           (actual type: cs_sles_autotune_t  **)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_destroy(void  **context)
+{
+  cs_sles_autotune_t *at = (cs_sles_autotune_t *)(*context);
+
+  if (at != NULL) {
+
+    for (int i = 0; i < at->n_candidates; i++) {
+      _autotune_candidate_t *cd = at->candidates + i;
+      cd->destroy_func(&(cd->context));
+    }
+    BFT_FREE(at->candidates);
+
+    BFT_FREE(at);
+    *context = at;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Setup autotuned sparse linear equation solver.
+ *
+ * The candidate used for the current resolution is selected here.
+ *
+ * \param[in, out]  context    pointer to solver info and context
+ *                             (actual type: cs_sles_autotune_t  *)
+ * \param[in]       name       pointer to system name
+ * \param[in]       a          associated matrix
+ * \param[in]       verbosity  associated verbosity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_setup(void               *context,
+                       const char         *name,
+                       const cs_matrix_t  *a,
+                       int                 verbosity)
+{
+  cs_sles_autotune_t  *at = context;
+
+  if (at->candidates == NULL) {
+    _build_candidates(at, a);
+    at->nt_phase_start = cs_glob_time_step->nt_cur;
+  }
+
+  if (at->active < 0)
+    _choose_candidate(at, name);
+
+  _autotune_candidate_t *cd = at->candidates + at->active;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cd->setup_func(cd->context, name, a, verbosity);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(at->t_resolution), &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call autotuned sparse linear equation solver.
+ *
+ * If a candidate under evaluation fails to converge, the system is
+ * solved again using the first (most robust) candidate, and the
+ * failing candidate is excluded from the current evaluation.
+ *
+ * \param[in, out]  context        pointer to solver info and context
+ *                                 (actual type: cs_sles_autotune_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for
+ *                                 rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[out]      n_iter         number of "equivalent" iterations
+ * \param[out]      residue        residue
+ * \param[in]       rhs            right hand side
+ * \param[in, out]  vx             system solution
+ * \param[in]       aux_size       number of elements in aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_autotune_solve(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  verbosity,
+                       cs_halo_rotation_t   rotation_mode,
+                       double               precision,
+                       double               r_norm,
+                       int                 *n_iter,
+                       double              *residue,
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx,
+                       size_t               aux_size,
+                       void                *aux_vectors)
+{
+  cs_sles_autotune_t  *at = context;
+
+  if (at->active < 0)
+    cs_sles_autotune_setup(context, name, a, verbosity);
+
+  _autotune_candidate_t *cd = at->candidates + at->active;
+
+  /* Keep initial solution in case a candidate under evaluation fails */
+
+  cs_real_t *vx_ini = NULL;
+  cs_lnum_t n_vals = 0;
+
+  if (at->timed && at->active > 0) {
+    n_vals =   cs_matrix_get_n_columns(a)
+             * cs_matrix_get_diag_block_size(a)[1];
+    BFT_MALLOC(vx_ini, n_vals, cs_real_t);
+    memcpy(vx_ini, vx, n_vals*sizeof(cs_real_t));
+  }
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_sles_convergence_state_t cvg
+    = cd->solve_func(cd->context, name, a, verbosity, rotation_mode,
+                     precision, r_norm, n_iter, residue,
+                     rhs, vx, aux_size, aux_vectors);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(at->t_resolution), &t0, &t1);
+
+  cd->n_calls += 1;
+
+  if (cvg < CS_SLES_CONVERGED && vx_ini != NULL) {
+
+    if (verbosity > 0)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    _("%s [%s]: candidate \"%s\" failed to converge;\n"
+                      "  excluded from evaluation, using \"%s\".\n"),
+                    __func__, name, cd->description,
+                    at->candidates[0].description);
+
+    cd->n_failures += 1;
+    cd->free_func(cd->context);
+
+    memcpy(vx, vx_ini, n_vals*sizeof(cs_real_t));
+
+    at->active = 0;
+    at->timed = false;
+    cd = at->candidates;
+
+    cd->setup_func(cd->context, name, a, verbosity);
+    cvg = cd->solve_func(cd->context, name, a, verbosity, rotation_mode,
+                         precision, r_norm, n_iter, residue,
+                         rhs, vx, aux_size, aux_vectors);
+
+    cd->n_calls += 1;
+
+  }
+
+  BFT_FREE(vx_ini);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free autotuned sparse linear equation solver setup context.
+ *
+ * The elapsed time of the resolution is accounted for the active
+ * candidate here.
+ *
+ * \param[in, out]  context  pointer to solver info and context
+ *                           (actual type: cs_sles_autotune_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_free(void  *context)
+{
+  cs_sles_autotune_t  *at = context;
+
+  if (at->active < 0)
+    return;
+
+  _autotune_candidate_t *cd = at->candidates + at->active;
+
+  cd->free_func(cd->context);
+
+  if (at->timed) {
+    cd->n_samples += 1;
+    cd->t_sum += at->t_resolution.wall_nsec*1e-9;
+  }
+
+  at->active = -1;
+  at->timed = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log autotuned sparse linear equation solver info.
+ *
+ * \param[in]  context   pointer to solver info and context
+ *                       (actual type: cs_sles_autotune_t  *)
+ * \param[in]  log_type  log type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_log(const void  *context,
+                     cs_log_t     log_type)
+{
+  const cs_sles_autotune_t  *at = context;
+
+  if (log_type == CS_LOG_SETUP) {
+
+    cs_log_printf(log_type,
+                  _("  Solver type:                       %s\n"
+                    "  Time steps per candidate:          %d\n"
+                    "  Re-evaluation interval:            %d\n"
+                    "  Maximum number of iterations:      %d\n"),
+                  _("Autotuned"),
+                  at->n_trial_steps, at->reeval_interval, at->n_max_iter);
+
+  }
+
+  else if (log_type == CS_LOG_PERFORMANCE) {
+
+    cs_log_printf(log_type,
+                  _("\n"
+                    "  Solver type:                   %s\n"
+                    "  Number of evaluations:         %12d\n"),
+                  _("Autotuned"), at->n_evaluations);
+
+    if (at->selected > -1)
+      cs_log_printf(log_type,
+                    _("  Selected candidate:            %s\n"),
+                    at->candidates[at->selected].description);
+
+    for (int i = 0; i < at->n_candidates; i++) {
+
+      const _autotune_candidate_t *cd = at->candidates + i;
+
+      if (cd->n_calls < 1)
+        continue;
+
+      cs_log_printf(log_type,
+                    _("\n"
+                      "  Candidate:                     %s\n"
+                      "  Number of calls:               %12d\n"
+                      "  Number of selections:          %12d\n"),
+                    cd->description, cd->n_calls, cd->n_selections);
+
+      cd->log_func(cd->context, log_type);
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return index and description of the currently selected candidate.
+ *
+ * \param[in]   context      pointer to solver info and context
+ * \param[out]  description  description of selected candidate, or NULL
+ *                           if no candidate is selected yet
+ *
+ * \return  id of selected candidate, or -1 if evaluation is not complete
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_autotune_get_selected(const cs_sles_autotune_t   *context,
+                              const char                **description)
+{
+  int retval = -1;
+
+  if (description != NULL)
+    *description = NULL;
+
+  if (context != NULL) {
+    retval = context->selected;
+    if (retval > -1 && description != NULL)
+      *description = context->candidates[retval].description;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Error handler for autotuned sparse linear equation solver.
+ *
+ * In case of divergence or breakdown (of the fallback candidate, as
+ * failures of other candidates are handled by the solver itself), this
+ * error handler outputs postprocessing data to assist debugging, then
+ * aborts the run. It does nothing in case the maximum iteration count
+ * is reached.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       state          convergence state
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for
+ *                                 rotational periodicity
+ * \param[in]       rhs            right hand side
+ * \param[in, out]  vx             system solution
+ *
+ * \return  false (do not attempt new solve)
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_autotune_error_post_and_abort(cs_sles_t                  *sles,
+                                      cs_sles_convergence_state_t state,
+                                      const cs_matrix_t          *a,
+                                      cs_halo_rotation_t          rotation_mode,
+                                      const cs_real_t            *rhs,
+                                      cs_real_t                  *vx)
+{
+  if (state >= CS_SLES_BREAKDOWN)
+    return false;
+
+  const cs_sles_autotune_t  *at = cs_sles_get_context(sles);
+  const char *name = cs_sles_get_name(sles);
+
+  int mesh_id = cs_post_init_error_writer_cells();
+
+  cs_sles_post_error_output_def(name,
+                                mesh_id,
+                                rotation_mode,
+                                a,
+                                rhs,
+                                vx);
+
+  cs_post_finalize();
+
+  const char *error_type[] = {N_("divergence"), N_("breakdown")};
+  int err_id = (state == CS_SLES_BREAKDOWN) ? 1 : 0;
+
+  const char *description = "";
+  if (at->candidates != NULL)
+    description = at->candidates[0].description;
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("%s (%s): error (%s) solving for %s"),
+            _("Autotuned"), description,
+            _(error_type[err_id]),
+            name);
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set default autotuning options.
+ *
+ * When the number of trial steps is > 0, generic systems for which no
+ * solver was otherwise defined (i.e. not handled by specific rules in
+ * \ref cs_sles_default) use an autotuned solver with these options.
+ *
+ * \param[in]  n_trial_steps    number of time steps evaluated per candidate,
+ *                              or 0 to disable default autotuning
+ * \param[in]  reeval_interval  number of time steps after which candidates
+ *                              are evaluated again, or 0 for never
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_set_default(int  n_trial_steps,
+                             int  reeval_interval)
+{
+  _n_trial_steps_default = CS_MAX(n_trial_steps, 0);
+  _reeval_interval_default = CS_MAX(reeval_interval, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query default autotuning options.
+ *
+ * \param[out]  n_trial_steps    number of time steps evaluated per candidate,
+ *                               or 0 if default autotuning is disabled
+ * \param[out]  reeval_interval  number of time steps after which candidates
+ *                               are evaluated again, or 0 for never
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_get_default(int  *n_trial_steps,
+                             int  *reeval_interval)
+{
+  if (n_trial_steps != NULL)
+    *n_trial_steps = _n_trial_steps_default;
+  if (reeval_interval != NULL)
+    *reeval_interval = _reeval_interval_default;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
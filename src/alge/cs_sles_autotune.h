@@ -0,0 +1,318 @@
+#ifndef __CS_SLES_AUTOTUNE_H__
+#define __CS_SLES_AUTOTUNE_H__
+
+/*============================================================================
+ * Runtime selection of sparse linear equation solvers
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_halo_perio.h"
+#include "cs_log.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Autotuned linear solver context (opaque) */
+
+typedef struct _cs_sles_autotune_t  cs_sles_autotune_t;
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define autotuned sparse linear system solver for a given field
+ *        or equation name.
+ *
+ * If this system did not previously exist, it is added to the list of
+ * "known" systems. Otherwise, its definition is replaced by the one
+ * defined here.
+ *
+ * This is a utility function: if finer control is needed, see
+ * \ref cs_sles_define and \ref cs_sles_autotune_create.
+ *
+ * \param[in]  f_id             associated field id, or < 0
+ * \param[in]  name             associated name if f_id < 0, or NULL
+ * \param[in]  n_trial_steps    number of time steps evaluated per candidate
+ * \param[in]  reeval_interval  number of time steps after which candidates
+ *                              are evaluated again, or 0 for never
+ *
+ * \return  pointer to newly created autotuned solver info object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_autotune_t *
+cs_sles_autotune_define(int          f_id,
+                        const char  *name,
+                        int          n_trial_steps,
+                        int          reeval_interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create autotuned sparse linear system solver info and context.
+ *
+ * Candidate solvers are built at the first setup, based on the matrix
+ * properties (symmetry, storage, block size).
+ *
+ * \param[in]  n_trial_steps    number of time steps evaluated per candidate
+ * \param[in]  reeval_interval  number of time steps after which candidates
+ *                              are evaluated again, or 0 for never
+ * \param[in]  n_max_iter       maximum number of iterations of candidates
+ *
+ * \return  pointer to newly created solver info object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_autotune_t *
+cs_sles_autotune_create(int  n_trial_steps,
+                        int  reeval_interval,
+                        int  n_max_iter);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create autotuned sparse linear system solver info and context
+ *        based on existing info and context.
+ *
+ * \param[in]  context  pointer to reference info and context
+ *                      (actual type: cs_sles_autotune_t  *)
+ *
+ * \return  pointer to newly created solver info object.
+ *          (actual type: cs_sles_autotune_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_sles_autotune_copy(const void  *context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy autotuned sparse linear system solver info and context.
+ *
+ * \param[in, out]  context  pointer to solver info and context
+ *                           (actual type: cs_sles_autotune_t  **)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_destroy(void  **context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Setup autotuned sparse linear equation solver.
+ *
+ * The candidate used for the current resolution is selected here.
+ *
+ * \param[in, out]  context    pointer to solver info and context
+ *                             (actual type: cs_sles_autotune_t  *)
+ * \param[in]       name       pointer to system name
+ * \param[in]       a          associated matrix
+ * \param[in]       verbosity  associated verbosity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_setup(void               *context,
+                       const char         *name,
+                       const cs_matrix_t  *a,
+                       int                 verbosity);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call autotuned sparse linear equation solver.
+ *
+ * If a candidate under evaluation fails to converge, the system is
+ * solved again using the first (most robust) candidate, and the
+ * failing candidate is excluded from the current evaluation.
+ *
+ * \param[in, out]  context        pointer to solver info and context
+ *                                 (actual type: cs_sles_autotune_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for
+ *                                 rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[out]      n_iter         number of "equivalent" iterations
+ * \param[out]      residue        residue
+ * \param[in]       rhs            right hand side
+ * \param[in, out]  vx             system solution
+ * \param[in]       aux_size       number of elements in aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_autotune_solve(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  verbosity,
+                       cs_halo_rotation_t   rotation_mode,
+                       double               precision,
+                       double               r_norm,
+                       int                 *n_iter,
+                       double              *residue,
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx,
+                       size_t               aux_size,
+                       void                *aux_vectors);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free autotuned sparse linear equation solver setup context.
+ *
+ * The elapsed time of the resolution is accounted for the active
+ * candidate here.
+ *
+ * \param[in, out]  context  pointer to solver info and context
+ *                           (actual type: cs_sles_autotune_t  *)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_free(void  *context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log autotuned sparse linear equation solver info.
+ *
+ * \param[in]  context   pointer to solver info and context
+ *                       (actual type: cs_sles_autotune_t  *)
+ * \param[in]  log_type  log type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_log(const void  *context,
+                     cs_log_t     log_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return index and description of the currently selected candidate.
+ *
+ * \param[in]   context      pointer to solver info and context
+ * \param[out]  description  description of selected candidate, or NULL
+ *                           if no candidate is selected yet
+ *
+ * \return  id of selected candidate, or -1 if evaluation is not complete
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_autotune_get_selected(const cs_sles_autotune_t   *context,
+                              const char                **description);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Error handler for autotuned sparse linear equation solver.
+ *
+ * In case of divergence or breakdown (of the fallback candidate, as
+ * failures of other candidates are handled by the solver itself), this
+ * error handler outputs postprocessing data to assist debugging, then
+ * aborts the run. It does nothing in case the maximum iteration count
+ * is reached.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       state          convergence state
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for
+ *                                 rotational periodicity
+ * \param[in]       rhs            right hand side
+ * \param[in, out]  vx             system solution
+ *
+ * \return  false (do not attempt new solve)
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_autotune_error_post_and_abort(cs_sles_t                  *sles,
+                                      cs_sles_convergence_state_t state,
+                                      const cs_matrix_t          *a,
+                                      cs_halo_rotation_t          rotation_mode,
+                                      const cs_real_t            *rhs,
+                                      cs_real_t                  *vx);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set default autotuning options.
+ *
+ * When the number of trial steps is > 0, generic systems for which no
+ * solver was otherwise defined (i.e. not handled by specific rules in
+ * \ref cs_sles_default) use an autotuned solver with these options.
+ *
+ * \param[in]  n_trial_steps    number of time steps evaluated per candidate,
+ *                              or 0 to disable default autotuning
+ * \param[in]  reeval_interval  number of time steps after which candidates
+ *                              are evaluated again, or 0 for never
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_set_default(int  n_trial_steps,
+                             int  reeval_interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query default autotuning options.
+ *
+ * \param[out]  n_trial_steps    number of time steps evaluated per candidate,
+ *                               or 0 if default autotuning is disabled
+ * \param[out]  reeval_interval  number of time steps after which candidates
+ *                               are evaluated again, or 0 for never
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_autotune_get_default(int  *n_trial_steps,
+                             int  *reeval_interval);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_SLES_AUTOTUNE_H__ */
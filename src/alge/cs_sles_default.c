@@ -62,6 +62,7 @@
 #include "cs_multigrid.h"
 #include "cs_parameters.h"
 #include "cs_sles.h"
+#include "cs_sles_autotune.h"
 #include "cs_sles_it.h"
 #include "cs_sles_pc.h"
 #include "cs_timer.h"
@@ -197,6 +198,16 @@ _sles_default_native(int                f_id,
         = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
     }
 
+    /* Autotuned solver if requested */
+
+    int n_trial_steps = 0, reeval_interval = 0;
+    cs_sles_autotune_get_default(&n_trial_steps, &reeval_interval);
+
+    if (n_trial_steps > 0 && coupling_id < 0) {
+      cs_sles_autotune_define(f_id, name, n_trial_steps, reeval_interval);
+      return;
+    }
+
     if (symmetric) {
       sles_it_type = CS_SLES_PCG;
       if (f_id > -1 && coupling_id < 0)
@@ -756,6 +767,8 @@ cs_sles_solve_native(int                  f_id,
     }
     else if (strcmp(cs_sles_get_type(sc), "cs_multigrid_t") == 0)
       mg = cs_sles_get_context(sc);
+    else if (strcmp(cs_sles_get_type(sc), "cs_sles_autotune_t") == 0)
+      need_msr = true; /* allows Gauss-Seidel based candidates */
 
     if (mg != NULL) {
       cs_sles_it_type_t fs_type = cs_multigrid_get_fine_solver_type(mg);
@@ -335,7 +335,7 @@ cs_run(void)
 
   if (opts.benchmark > 0) {
     int mpi_trace_mode = (opts.benchmark == 2) ? 1 : 0;
-    cs_benchmark(mpi_trace_mode);
+    cs_benchmark(mpi_trace_mode, opts.benchmark_extended);
   }
 
   if (check_mask && cs_syr_coupling_n_couplings())
@@ -542,6 +542,7 @@ cs_run(void)
 
   cs_all_to_all_log_finalize();
   cs_io_log_finalize();
+  cs_timer_stats_log_finalize();
 
   cs_timer_stats_finalize();
 
@@ -298,8 +298,11 @@ cs_at_data_assim_build_ops(void)
       bft_printf("   *Building HBHT\n");
       for (int ii = 0; ii < n_obs; ii++) {
         bft_printf("    ");
-        for (int jj = 0; jj < n_obs; jj++)
-          bft_printf("%.8f ", oi->b_proj[ii*n_obs + jj]);
+        for (cs_lnum_t jj = oi->b_proj_idx[ii];
+             jj < oi->b_proj_idx[ii+1];
+             jj++)
+          bft_printf("(%d) %.8f ", (int)oi->b_proj_ids[jj],
+                     oi->b_proj[ms->dim*jj]);
         bft_printf("\n");
       }
       bft_printf("\n");
@@ -44,6 +44,10 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "fvm_box.h"
+#include "fvm_box_tree.h"
+#include "fvm_neighborhood.h"
+
 #include "cs_ext_neighborhood.h"
 #include "cs_field.h"
 #include "cs_map.h"
@@ -53,6 +57,8 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_math.h"
+#include "cs_order.h"
+#include "cs_sort.h"
 #include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
@@ -87,6 +93,19 @@ BEGIN_C_DECLS
 /* maximum size of line in measures files */
 #define MAX_LINE_SIZE 1000
 
+/* model covariance cutoff distance (relative to influence radii);
+   beyond it, (1 + d)exp(-d) < 3.e-12 is neglected */
+#define _OI_B_CUTOFF 30.
+
+/* default maximum number of active observations in a local analysis;
+   each local analysis domain uses the closest active observations within
+   the cutoff distance, whose block of HB(H)t+R is factorized with a dense
+   LU (O(n^2) memory and O(n^3) operations) */
+#define _OI_MAX_LOCAL_OBS 200
+
+/* maximum number of local analysis domains along each axis */
+#define _OI_MAX_DOMAIN_BINS 1048576.
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -448,58 +467,625 @@ _b_matrix(cs_real_t  xi,
 }
 
 /*----------------------------------------------------------------------------
- * Assemble full matrix HB(H)t+R.
+ * Return a term of the sparse HB(H)t matrix (0 if not stored).
+ *
+ * parameters:
+ *   oi     <-- pointer to an optimal interpolation
+ *   m_dim  <-- measures set dimension
+ *   ii     <-- row observation id
+ *   jj     <-- column observation id
+ *   mc_id  <-- measures component id
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_b_proj_value(const cs_at_opt_interp_t  *oi,
+              int                        m_dim,
+              int                        ii,
+              int                        jj,
+              int                        mc_id)
+{
+  cs_lnum_t s_id = oi->b_proj_idx[ii];
+  cs_lnum_t e_id = oi->b_proj_idx[ii+1];
+
+  /* binary search in sorted row */
+
+  while (s_id < e_id) {
+    cs_lnum_t mid_id = (s_id + e_id) / 2;
+    if (oi->b_proj_ids[mid_id] < jj)
+      s_id = mid_id + 1;
+    else
+      e_id = mid_id;
+  }
+
+  if (s_id < oi->b_proj_idx[ii+1] && oi->b_proj_ids[s_id] == jj)
+    return oi->b_proj[m_dim*s_id + mc_id];
+
+  return 0.;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute extents of the support of observations (i.e. of the points of
+ * their model to observation projection), enlarged by a given distance.
+ *
+ * Observations with an empty support are skipped.
+ *
+ * parameters:
+ *   oi       <-- pointer to an optimal interpolation
+ *   m_dim    <-- measures set dimension
+ *   n_obs    <-- number of observations considered
+ *   obs_ids  <-- ids of observations considered, or NULL for all
+ *   pad      <-- enlargement distance along each axis
+ *   box_obs  --> observation position (in obs_ids) for each box
+ *   extents  --> box extents (size: n_obs*6)
+ *
+ * returns:
+ *   number of boxes defined
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_obs_support_extents(const cs_at_opt_interp_t  *oi,
+                     int                        m_dim,
+                     cs_lnum_t                  n_obs,
+                     const int                  obs_ids[],
+                     const cs_real_t            pad[3],
+                     cs_lnum_t                  box_obs[],
+                     cs_coord_t                 extents[])
+{
+  const cs_real_t *proj = oi->model_to_obs_proj;
+  const cs_lnum_t *proj_idx = oi->model_to_obs_proj_idx;
+  const int stride = m_dim + 3;
+
+  cs_lnum_t n_boxes = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
+
+    cs_lnum_t obs_id = (obs_ids != NULL) ? obs_ids[ii] : ii;
+
+    if (proj_idx[obs_id] >= proj_idx[obs_id+1])
+      continue;
+
+    cs_coord_t *b_min = extents + 6*n_boxes;
+    cs_coord_t *b_max = b_min + 3;
+
+    for (int kk = 0; kk < 3; kk++) {
+      b_min[kk] = cs_math_big_r;
+      b_max[kk] = -cs_math_big_r;
+    }
+
+    for (cs_lnum_t jj = proj_idx[obs_id]; jj < proj_idx[obs_id+1]; jj++) {
+      for (int kk = 0; kk < 3; kk++) {
+        b_min[kk] = CS_MIN(b_min[kk], (proj + jj*stride)[m_dim + kk]);
+        b_max[kk] = CS_MAX(b_max[kk], (proj + jj*stride)[m_dim + kk]);
+      }
+    }
+
+    for (int kk = 0; kk < 3; kk++) {
+      b_min[kk] -= pad[kk];
+      b_max[kk] += pad[kk];
+    }
+
+    box_obs[n_boxes] = ii;
+    n_boxes++;
+  }
+
+  return n_boxes;
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of a factorization structure and mark it as invalid.
+ *
+ * parameters:
+ *   lu  <-> pointer to factorization structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_lu_free(cs_at_opt_interp_lu_t  *lu)
+{
+  lu->n_active_obs = -1;
+  lu->n_blocks = 0;
+  BFT_FREE(lu->ao_idx);
+  BFT_FREE(lu->block_idx);
+  BFT_FREE(lu->block_ao);
+  BFT_FREE(lu->lu_idx);
+  BFT_FREE(lu->lu);
+  lu->n_domains = 0;
+  BFT_FREE(lu->domain_block);
+  BFT_FREE(lu->domain_idx);
+  BFT_FREE(lu->domain_cells);
+}
+
+/*----------------------------------------------------------------------------
+ * Free cached factorizations of an optimal interpolation.
+ *
+ * parameters:
+ *   oi  <-> pointer to an optimal interpolation
+ *----------------------------------------------------------------------------*/
+
+static void
+_lu_destroy(cs_at_opt_interp_t  *oi)
+{
+  for (int ii = 0; ii < oi->n_lu; ii++)
+    _lu_free(oi->lu + ii);
+
+  BFT_FREE(oi->lu);
+  oi->n_lu = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Group cells into local analysis domains.
+ *
+ * Domains are the cells of a cartesian grid whose spacing is the influence
+ * radius, aligned with the global bounding box of cell centers, so that
+ * they do not depend on the partitioning.
+ *
+ * parameters:
+ *   oi        <-- pointer to an optimal interpolation
+ *   lu        <-> pointer to factorization structure
+ *   h         --> domain size along each axis
+ *
+ * returns:
+ *   center of each domain (size: n_domains*3)
+ *----------------------------------------------------------------------------*/
+
+static cs_coord_t *
+_define_local_domains(const cs_at_opt_interp_t  *oi,
+                      cs_at_opt_interp_lu_t     *lu,
+                      cs_real_t                  h[3])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_3_t  *restrict cell_cen =
+    (const cs_real_3_t *restrict)cs_glob_mesh_quantities->cell_cen;
+
+  cs_real_t c_min[3], c_max[3];
+  cs_gnum_t n_bins[3];
+
+  for (int kk = 0; kk < 3; kk++) {
+    c_min[kk] = cs_math_big_r;
+    c_max[kk] = -cs_math_big_r;
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (int kk = 0; kk < 3; kk++) {
+      c_min[kk] = CS_MIN(c_min[kk], cell_cen[c_id][kk]);
+      c_max[kk] = CS_MAX(c_max[kk], cell_cen[c_id][kk]);
+    }
+  }
+
+  cs_parall_min(3, CS_REAL_TYPE, c_min);
+  cs_parall_max(3, CS_REAL_TYPE, c_max);
+
+  /* domain size is the influence radius, limited so that the number of
+     bins along each axis stays bounded */
+
+  h[0] = oi->ir[0];
+  h[1] = oi->ir[0];
+  h[2] = oi->ir[1];
+
+  for (int kk = 0; kk < 3; kk++) {
+    cs_real_t c_ext = CS_MAX(c_max[kk] - c_min[kk], 0.);
+    if (h[kk]*_OI_MAX_DOMAIN_BINS < c_ext)
+      h[kk] = c_ext / _OI_MAX_DOMAIN_BINS;
+    n_bins[kk] = (cs_gnum_t)(c_ext / h[kk]) + 1;
+  }
+
+  cs_gnum_t *c_bin = NULL;
+  BFT_MALLOC(c_bin, n_cells, cs_gnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_gnum_t b_ijk[3];
+    for (int kk = 0; kk < 3; kk++) {
+      b_ijk[kk] = (cs_gnum_t)((cell_cen[c_id][kk] - c_min[kk]) / h[kk]);
+      b_ijk[kk] = CS_MIN(b_ijk[kk], n_bins[kk] - 1);
+    }
+    c_bin[c_id] = b_ijk[0] + n_bins[0]*(b_ijk[1] + n_bins[1]*b_ijk[2]);
+  }
+
+  cs_lnum_t *order = cs_order_gnum(NULL, c_bin, n_cells);
+
+  /* Build domain index */
+
+  lu->n_domains = 0;
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    if (ii == 0 || c_bin[order[ii]] != c_bin[order[ii-1]])
+      lu->n_domains += 1;
+  }
+
+  BFT_MALLOC(lu->domain_idx, lu->n_domains + 1, cs_lnum_t);
+
+  cs_coord_t *d_center = NULL;
+  BFT_MALLOC(d_center, lu->n_domains*3, cs_coord_t);
+
+  cs_lnum_t d_id = -1;
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    cs_gnum_t bin = c_bin[order[ii]];
+    if (ii == 0 || bin != c_bin[order[ii-1]]) {
+      d_id += 1;
+      lu->domain_idx[d_id] = ii;
+      cs_gnum_t b_ijk[3] = {bin % n_bins[0],
+                            (bin / n_bins[0]) % n_bins[1],
+                            bin / (n_bins[0]*n_bins[1])};
+      for (int kk = 0; kk < 3; kk++)
+        d_center[d_id*3 + kk] = c_min[kk] + (b_ijk[kk] + 0.5)*h[kk];
+    }
+  }
+  lu->domain_idx[lu->n_domains] = n_cells;
+
+  lu->domain_cells = order;
+
+  BFT_FREE(c_bin);
+
+  return d_center;
+}
+
+/*----------------------------------------------------------------------------
+ * Select the local observation set of each local analysis domain.
+ *
+ * Active observations whose support is within the cutoff distance of a
+ * domain are candidates; at most oi->n_max_local_obs of them, the closest
+ * to the domain center (in influence radii), are kept. Domains with the
+ * same local observation set share it, so that it is factorized once.
+ *
+ * parameters:
+ *   oi            <-- pointer to an optimal interpolation
+ *   m_dim         <-- measures set dimension
+ *   n_active_obs  <-- number of active observations
+ *   ao_idx        <-- index of active observations
+ *   h             <-- domain size along each axis
+ *   d_center      <-- center of each domain
+ *   lu            <-> pointer to factorization structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_select_local_obs(const cs_at_opt_interp_t  *oi,
+                  int                        m_dim,
+                  int                        n_active_obs,
+                  const int                 *ao_idx,
+                  const cs_real_t            h[3],
+                  const cs_coord_t           d_center[],
+                  cs_at_opt_interp_lu_t     *lu)
+{
+  const cs_lnum_t n_domains = lu->n_domains;
+  const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
+  const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+
+  /* Observation supports, and their enlargement by the cutoff distance
+     (and half a domain, as domains are located by their center) */
+
+  cs_lnum_t *box_ao = NULL;
+  cs_coord_t *s_extents = NULL, *extents = NULL;
+
+  BFT_MALLOC(box_ao, n_active_obs, cs_lnum_t);
+  BFT_MALLOC(s_extents, n_active_obs*6, cs_coord_t);
+
+  const cs_real_t no_pad[3] = {0., 0., 0.};
+
+  cs_lnum_t n_boxes = _obs_support_extents(oi, m_dim, n_active_obs, ao_idx,
+                                           no_pad, box_ao, s_extents);
+
+  const cs_real_t pad[3] = {_OI_B_CUTOFF*oi->ir[0] + 0.5*h[0],
+                            _OI_B_CUTOFF*oi->ir[0] + 0.5*h[1],
+                            _OI_B_CUTOFF*oi->ir[1] + 0.5*h[2]};
+
+  BFT_MALLOC(extents, n_boxes*6, cs_coord_t);
+
+  for (cs_lnum_t ii = 0; ii < n_boxes; ii++) {
+    for (int kk = 0; kk < 3; kk++) {
+      extents[ii*6 + kk] = s_extents[ii*6 + kk] - pad[kk];
+      extents[ii*6 + kk + 3] = s_extents[ii*6 + kk + 3] + pad[kk];
+    }
+  }
+
+  cs_lnum_t *d_cand_idx = NULL, *d_cand_ids = NULL;
+
+  if (n_boxes > 0) {
+
+    cs_gnum_t *box_gnum = NULL;
+    BFT_MALLOC(box_gnum, n_boxes, cs_gnum_t);
+    for (cs_lnum_t ii = 0; ii < n_boxes; ii++)
+      box_gnum[ii] = ii + 1;
+
+#if defined(HAVE_MPI)
+    fvm_box_set_t *boxes = fvm_box_set_create(3,
+                                              1,  /* normalize */
+                                              0,  /* allow_projection */
+                                              n_boxes,
+                                              box_gnum,
+                                              extents,
+                                              MPI_COMM_NULL);
+#else
+    fvm_box_set_t *boxes = fvm_box_set_create(3,
+                                              1,  /* normalize */
+                                              0,  /* allow_projection */
+                                              n_boxes,
+                                              box_gnum,
+                                              extents);
+#endif
+
+    BFT_FREE(box_gnum);
+
+    fvm_box_tree_t *bt = fvm_box_tree_create(30,    /* max_level */
+                                             30,    /* threshold */
+                                             10.);  /* max_box_ratio */
+
+    fvm_box_tree_set_boxes(bt, boxes, FVM_BOX_TREE_ASYNC_LEVEL);
+
+    fvm_box_tree_get_point_intersects(bt,
+                                      boxes,
+                                      n_domains,
+                                      d_center,
+                                      &d_cand_idx,
+                                      &d_cand_ids);
+
+    fvm_box_tree_destroy(&bt);
+    fvm_box_set_destroy(&boxes);
+
+  }
+
+  BFT_FREE(extents);
+
+  /* Keep the closest candidates of each domain */
+
+  int n_max_cand = 0;
+  for (cs_lnum_t d_id = 0; d_cand_idx != NULL && d_id < n_domains; d_id++)
+    n_max_cand = CS_MAX(n_max_cand, d_cand_idx[d_id+1] - d_cand_idx[d_id]);
+
+  cs_lnum_t *d_set_idx = NULL, *d_set_ao = NULL, *order = NULL;
+  cs_real_t *dist = NULL;
+
+  BFT_MALLOC(d_set_idx, n_domains + 1, cs_lnum_t);
+  BFT_MALLOC(d_set_ao, n_domains*CS_MIN(n_max_cand, oi->n_max_local_obs),
+             cs_lnum_t);
+  BFT_MALLOC(order, n_max_cand, cs_lnum_t);
+  BFT_MALLOC(dist, n_max_cand, cs_real_t);
+
+  d_set_idx[0] = 0;
+
+  for (cs_lnum_t d_id = 0; d_id < n_domains; d_id++) {
+
+    cs_lnum_t n_cand = 0;
+    cs_lnum_t *cand = NULL;
+
+    if (d_cand_idx != NULL) {
+      n_cand = d_cand_idx[d_id+1] - d_cand_idx[d_id];
+      cand = d_cand_ids + d_cand_idx[d_id];
+    }
+
+    /* candidates in increasing observation order, so that ties are
+       broken independently of the box tree */
+
+    cs_sort_lnum(cand, n_cand);
+
+    const cs_coord_t *c = d_center + 3*d_id;
+
+    for (cs_lnum_t ii = 0; ii < n_cand; ii++) {
+      const cs_coord_t *s_min = s_extents + 6*cand[ii];
+      const cs_coord_t *s_max = s_min + 3;
+      cs_real_t g[3];
+      for (int kk = 0; kk < 3; kk++)
+        g[kk] = CS_MAX(0., CS_MAX(s_min[kk] - c[kk], c[kk] - s_max[kk]));
+      dist[ii] = (cs_math_sq(g[0]) + cs_math_sq(g[1]))/ir_xy2
+                + cs_math_sq(g[2])/ir_z2;
+    }
+
+    cs_order_real_allocated(NULL, dist, order, n_cand);
+
+    cs_lnum_t n_local = CS_MIN(n_cand, oi->n_max_local_obs);
+    cs_lnum_t *set_ao = d_set_ao + d_set_idx[d_id];
+
+    for (cs_lnum_t ii = 0; ii < n_local; ii++)
+      set_ao[ii] = box_ao[cand[order[ii]]];
+
+    cs_sort_lnum(set_ao, n_local);
+
+    d_set_idx[d_id+1] = d_set_idx[d_id] + n_local;
+
+  }
+
+  BFT_FREE(dist);
+  BFT_FREE(order);
+  BFT_FREE(d_cand_idx);
+  BFT_FREE(d_cand_ids);
+  BFT_FREE(s_extents);
+  BFT_FREE(box_ao);
+
+  /* Merge identical local observation sets, compared by hash first */
+
+  cs_gnum_t *d_hash = NULL;
+  BFT_MALLOC(d_hash, n_domains, cs_gnum_t);
+
+  for (cs_lnum_t d_id = 0; d_id < n_domains; d_id++) {
+    cs_gnum_t d_h = d_set_idx[d_id+1] - d_set_idx[d_id];
+    for (cs_lnum_t ii = d_set_idx[d_id]; ii < d_set_idx[d_id+1]; ii++)
+      d_h = d_h*1000003 + (cs_gnum_t)d_set_ao[ii];
+    d_hash[d_id] = d_h;
+  }
+
+  cs_lnum_t *d_order = cs_order_gnum(NULL, d_hash, n_domains);
+  cs_lnum_t *set_domain = NULL;
+
+  BFT_MALLOC(lu->domain_block, n_domains, int);
+  BFT_MALLOC(set_domain, n_domains, cs_lnum_t);
+
+  lu->n_blocks = 0;
+
+  for (cs_lnum_t ii = 0, s_start = 0; ii < n_domains; ii++) {
+
+    cs_lnum_t d_id = d_order[ii];
+
+    if (ii > 0 && d_hash[d_id] != d_hash[d_order[ii-1]])
+      s_start = lu->n_blocks;
+
+    cs_lnum_t d_size = d_set_idx[d_id+1] - d_set_idx[d_id];
+
+    int b_id = -1;
+    for (int jj = s_start; jj < lu->n_blocks && b_id < 0; jj++) {
+      cs_lnum_t r_id = set_domain[jj];
+      if (   d_set_idx[r_id+1] - d_set_idx[r_id] == d_size
+          && memcmp(d_set_ao + d_set_idx[d_id],
+                    d_set_ao + d_set_idx[r_id],
+                    d_size*sizeof(cs_lnum_t)) == 0)
+        b_id = jj;
+    }
+
+    if (b_id < 0) {
+      b_id = lu->n_blocks++;
+      set_domain[b_id] = d_id;
+    }
+
+    lu->domain_block[d_id] = b_id;
+
+  }
+
+  BFT_FREE(d_order);
+  BFT_FREE(d_hash);
+
+  /* Build local observation set index */
+
+  BFT_MALLOC(lu->block_idx, lu->n_blocks + 1, int);
+  BFT_MALLOC(lu->lu_idx, lu->n_blocks + 1, cs_lnum_t);
+
+  lu->block_idx[0] = 0;
+  lu->lu_idx[0] = 0;
+  for (int b_id = 0; b_id < lu->n_blocks; b_id++) {
+    cs_lnum_t r_id = set_domain[b_id];
+    cs_lnum_t b_size = d_set_idx[r_id+1] - d_set_idx[r_id];
+    lu->block_idx[b_id+1] = lu->block_idx[b_id] + b_size;
+    lu->lu_idx[b_id+1] = lu->lu_idx[b_id] + b_size*b_size;
+  }
+
+  BFT_MALLOC(lu->block_ao, lu->block_idx[lu->n_blocks], int);
+
+  for (int b_id = 0; b_id < lu->n_blocks; b_id++) {
+    cs_lnum_t r_id = set_domain[b_id];
+    int *block_ao = lu->block_ao + lu->block_idx[b_id];
+    for (cs_lnum_t ii = d_set_idx[r_id]; ii < d_set_idx[r_id+1]; ii++)
+      block_ao[ii - d_set_idx[r_id]] = d_set_ao[ii];
+  }
+
+  BFT_FREE(set_domain);
+  BFT_FREE(d_set_ao);
+  BFT_FREE(d_set_idx);
+}
+
+/*----------------------------------------------------------------------------
+ * Assemble a block of matrix HB(H)t+R.
+ *
+ * parameters:
+ *   ms       <-- pointer to measures set
+ *   oi       <-- pointer to an optimal interpolation
+ *   ao_idx   <-- index of active observations
+ *   b_size   <-- block size
+ *   block_ao <-- active observation positions in block
+ *   mc_id    <-- measures component id
+ *   a        --> block matrix (size: b_size*b_size)
  *----------------------------------------------------------------------------*/
 
-static cs_real_t *
+static void
 _assembly_adding_obs_covariance(cs_measures_set_t  *ms,
                                 cs_at_opt_interp_t *oi,
-                                int                *ao_idx,
-                                int                 n_active_obs,
-                                int                 mc_id)
+                                const int          *ao_idx,
+                                int                 b_size,
+                                const int          *block_ao,
+                                int                 mc_id,
+                                cs_real_t          *a)
 {
   cs_lnum_t n_obs = ms->nb_measures;
   cs_real_t *obs_cov = oi->obs_cov;
-  cs_real_t *b_proj = oi->b_proj;
-  cs_real_t *a, r;
+  cs_real_t r = 0.;
 
   int m_dim = ms->dim;
-  int a_l_size = n_active_obs;
-  int a_size = cs_math_sq(a_l_size);
-  BFT_MALLOC(a, a_size, cs_real_t);
 
-  /* filling in the full matrix */
+  /* filling in the block matrix */
 
-  for (cs_lnum_t ii = 0; ii < a_size; ii++)
-    a[ii] = 0.;
+  for (cs_lnum_t ii = 0; ii < b_size; ii++) {
+    int obs_i = ao_idx[block_ao[ii]];
 
-  for (cs_lnum_t ii = 0; ii < n_active_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_active_obs; jj++) {
+    for (cs_lnum_t jj = 0; jj < b_size; jj++) {
+      int obs_j = ao_idx[block_ao[jj]];
 
-      int id = ii*a_l_size + jj;
-      a[id] = b_proj[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+      int id = ii*b_size + jj;
+      a[id] = _b_proj_value(oi, m_dim, obs_i, obs_j, mc_id);
 
       /* time weighting of variances */
       if (ii == jj) {
         if (!oi->obs_cov_is_diag) {
-          r = obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+          r = obs_cov[m_dim*(obs_i * n_obs + obs_j)+mc_id];
         } else if (oi->obs_cov_is_diag) {
-          r = obs_cov[m_dim*ao_idx[ii]+mc_id];
+          r = obs_cov[m_dim*obs_i+mc_id];
         }
 
         if (oi->steady <= 0) {
-          a[id] += (r + 1.) / oi->time_weights[m_dim*ao_idx[ii]+mc_id] - 1.;
+          a[id] += (r + 1.) / oi->time_weights[m_dim*obs_i+mc_id] - 1.;
         } else {
           a[id] += r;
         }
 
       } else if (!oi->obs_cov_is_diag) {
-        a[id] += obs_cov[m_dim*(ao_idx[ii] * n_obs + ao_idx[jj])+mc_id];
+        a[id] += obs_cov[m_dim*(obs_i * n_obs + obs_j)+mc_id];
       }
     }
   }
+}
+
+/*----------------------------------------------------------------------------
+ * Factorize local blocks of matrix HB(H)t+R, one for each local observation
+ * set of local analysis domains.
+ *
+ * parameters:
+ *   ms            <-- pointer to measures set
+ *   oi            <-- pointer to an optimal interpolation
+ *   n_active_obs  <-- number of active observations
+ *   ao_idx        <-- index of active observations
+ *   mc_id         <-- measures component id
+ *   lu            <-> pointer to factorization structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_factorize_local_sets(cs_measures_set_t      *ms,
+                      cs_at_opt_interp_t     *oi,
+                      int                     n_active_obs,
+                      const int              *ao_idx,
+                      int                     mc_id,
+                      cs_at_opt_interp_lu_t  *lu)
+{
+  _lu_free(lu);
+
+  cs_real_t h[3];
+  cs_coord_t *d_center = _define_local_domains(oi, lu, h);
+
+  _select_local_obs(oi, ms->dim, n_active_obs, ao_idx, h, d_center, lu);
+
+  BFT_FREE(d_center);
+
+  lu->n_active_obs = n_active_obs;
+  BFT_MALLOC(lu->ao_idx, n_active_obs, int);
+  memcpy(lu->ao_idx, ao_idx, n_active_obs*sizeof(int));
+
+  BFT_MALLOC(lu->lu, lu->lu_idx[lu->n_blocks], cs_real_t);
+
+  int b_size_max = 0;
+  for (int b_id = 0; b_id < lu->n_blocks; b_id++)
+    b_size_max = CS_MAX(b_size_max,
+                        lu->block_idx[b_id+1] - lu->block_idx[b_id]);
+
+  cs_real_t *a = NULL;
+  BFT_MALLOC(a, b_size_max*b_size_max, cs_real_t);
+
+  for (int b_id = 0; b_id < lu->n_blocks; b_id++) {
+    int b_size = lu->block_idx[b_id+1] - lu->block_idx[b_id];
+    if (b_size < 1)
+      continue;
+    _assembly_adding_obs_covariance(ms,
+                                    oi,
+                                    ao_idx,
+                                    b_size,
+                                    lu->block_ao + lu->block_idx[b_id],
+                                    mc_id,
+                                    a);
+    cs_math_fact_lu(1, b_size, a, lu->lu + lu->lu_idx[b_id]);
+  }
 
-  return a;
+  BFT_FREE(a);
 }
 
 /*============================================================================
@@ -582,6 +1168,8 @@ cs_at_opt_interp_create(const char   *name)
   oi->ig_id = -1;
 
   if (!reall) {
+    oi->b_proj_idx = NULL;
+    oi->b_proj_ids = NULL;
     oi->b_proj = NULL;
     oi->relax = NULL;
     oi->times = NULL;
@@ -594,8 +1182,13 @@ cs_at_opt_interp_create(const char   *name)
     oi->active_time = NULL;
     oi->time_weights = NULL;
     oi->time_window = NULL;
+    oi->n_max_local_obs = _OI_MAX_LOCAL_OBS;
+    oi->n_lu = 0;
+    oi->lu = NULL;
   }
   else {
+    BFT_FREE(oi->b_proj_idx);
+    BFT_FREE(oi->b_proj_ids);
     BFT_FREE(oi->b_proj);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->times);
@@ -608,6 +1201,7 @@ cs_at_opt_interp_create(const char   *name)
     BFT_FREE(oi->active_time);
     BFT_FREE(oi->time_weights);
     BFT_FREE(oi->time_window);
+    _lu_destroy(oi);
   }
 
   return oi;
@@ -676,6 +1270,8 @@ cs_at_opt_interps_destroy(void)
 {
   for (int i = 0; i < _n_opt_interps; i++) {
     cs_at_opt_interp_t  *oi = _opt_interps + i;
+    BFT_FREE(oi->b_proj_idx);
+    BFT_FREE(oi->b_proj_ids);
     BFT_FREE(oi->b_proj);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->obs_cov);
@@ -688,6 +1284,7 @@ cs_at_opt_interps_destroy(void)
     BFT_FREE(oi->active_time);
     BFT_FREE(oi->time_weights);
     BFT_FREE(oi->time_window);
+    _lu_destroy(oi);
   }
 
   BFT_FREE(_opt_interps);
@@ -735,6 +1332,7 @@ cs_at_opt_interp_read_file(char const           filename[50],
   oi->steady = -1;
   oi->frequency = 1;
   oi->type_nudging = 0;
+  oi->n_max_local_obs = _OI_MAX_LOCAL_OBS;
 
   /* First reading - test if file exists */
   fichier = fopen(filename, "r");
@@ -932,6 +1530,18 @@ cs_at_opt_interp_read_file(char const           filename[50],
 
     }
 
+    /* Reading the maximum number of observations in a local analysis */
+    if (strncmp(line, "_max_local_obs_", 15) == 0) {
+      fscanf(fichier, "%i", &(oi->n_max_local_obs));
+      if (oi->n_max_local_obs < 1)
+        oi->n_max_local_obs = 1;
+
+#if _OI_DEBUG_
+      bft_printf("   * Reading _max_local_obs_ : %i\n", oi->n_max_local_obs);
+#endif
+
+    }
+
     /* Reading the frequency of analysis computation */
     if (strncmp(line, "_frequency_", 11) == 0) {
       fscanf(fichier, "%i", &(oi->frequency));
@@ -1366,6 +1976,10 @@ cs_at_opt_interp_obs_operator(cs_measures_set_t  *ms,
 /*!
  * \brief Compute $\tens{H}\tens{B}\transpose{\tens{H}}$.
  *
+ * Only terms between observations whose supports are closer than the
+ * model covariance cutoff distance are computed and stored, in a sparse
+ * (row-indexed) form.
+ *
  * \param[in]  ms  pointer to measures set
  * \param[in]  oi  pointer to an optimal interpolation
  */
@@ -1382,16 +1996,113 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
   const int dim = ms->dim;
   const int stride = dim + 3; /* dimension of field + dimension of space */
 
-  BFT_MALLOC(oi->b_proj, n_obs*n_obs*dim, cs_real_t);
-  cs_real_t *b_proj = oi->b_proj;
-
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
 
+  /* Previous factorizations are not valid anymore */
+
+  _lu_destroy(oi);
+
+  BFT_FREE(oi->b_proj_idx);
+  BFT_FREE(oi->b_proj_ids);
+  BFT_FREE(oi->b_proj);
+
+  /* Find pairs of observations whose supports are closer than the
+     cutoff distance, using supports enlarged by half that distance */
+
+  cs_lnum_t *box_obs = NULL;
+  cs_gnum_t *box_gnum = NULL;
+  cs_coord_t *extents = NULL;
+
+  BFT_MALLOC(box_obs, n_obs, cs_lnum_t);
+  BFT_MALLOC(extents, n_obs*6, cs_coord_t);
+
+  const cs_real_t pad[3] = {0.5*_OI_B_CUTOFF*oi->ir[0],
+                            0.5*_OI_B_CUTOFF*oi->ir[0],
+                            0.5*_OI_B_CUTOFF*oi->ir[1]};
+
+  cs_lnum_t n_boxes = _obs_support_extents(oi, dim, n_obs, NULL, pad,
+                                           box_obs, extents);
+
+  BFT_MALLOC(box_gnum, n_boxes, cs_gnum_t);
+  for (cs_lnum_t ii = 0; ii < n_boxes; ii++)
+    box_gnum[ii] = box_obs[ii] + 1;
+
+  BFT_FREE(box_obs);
+
+#if defined(HAVE_MPI)
+  fvm_neighborhood_t *nh = fvm_neighborhood_create(MPI_COMM_NULL);
+#else
+  fvm_neighborhood_t *nh = fvm_neighborhood_create();
+#endif
+
+  cs_lnum_t n_elts = 0;
+  cs_gnum_t *elt_num = NULL, *neighbor_num = NULL;
+  cs_lnum_t *neighbor_index = NULL;
+
+  if (n_boxes > 0) {
+    fvm_neighborhood_by_boxes(nh,
+                              3,
+                              n_boxes,
+                              NULL,
+                              NULL,
+                              &box_gnum,
+                              &extents);
+    fvm_neighborhood_get_data(nh,
+                              &n_elts,
+                              &elt_num,
+                              &neighbor_index,
+                              &neighbor_num);
+  }
+
+  BFT_FREE(box_gnum);
+  BFT_FREE(extents);
+
+  /* Build sparse structure (with sorted rows, including diagonal) */
+
+  BFT_MALLOC(oi->b_proj_idx, n_obs + 1, cs_lnum_t);
+  cs_lnum_t *b_proj_idx = oi->b_proj_idx;
+
+  for (cs_lnum_t ii = 0; ii < n_obs + 1; ii++)
+    b_proj_idx[ii] = (ii > 0) ? 1 : 0;
+
+  for (cs_lnum_t ii = 0; ii < n_elts; ii++)
+    b_proj_idx[elt_num[ii]] += neighbor_index[ii+1] - neighbor_index[ii];
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    b_proj_idx[ii+1] += b_proj_idx[ii];
+
+  BFT_MALLOC(oi->b_proj_ids, b_proj_idx[n_obs], cs_lnum_t);
+  cs_lnum_t *b_proj_ids = oi->b_proj_ids;
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    b_proj_ids[b_proj_idx[ii]] = ii;
+
+  for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
+    cs_lnum_t obs_id = elt_num[ii] - 1;
+    cs_lnum_t shift = b_proj_idx[obs_id] + 1;
+    for (cs_lnum_t jj = neighbor_index[ii]; jj < neighbor_index[ii+1]; jj++)
+      b_proj_ids[shift++] = neighbor_num[jj] - 1;
+  }
+
+  fvm_neighborhood_destroy(&nh);
+
+  for (cs_lnum_t ii = 0; ii < n_obs; ii++)
+    cs_sort_lnum(b_proj_ids + b_proj_idx[ii],
+                 b_proj_idx[ii+1] - b_proj_idx[ii]);
+
+  /* Compute matrix terms */
+
+  BFT_MALLOC(oi->b_proj, b_proj_idx[n_obs]*dim, cs_real_t);
+  cs_real_t *b_proj = oi->b_proj;
+
+# pragma omp parallel for if (n_obs > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
+    for (cs_lnum_t nn = b_proj_idx[ii]; nn < b_proj_idx[ii+1]; nn++) {
+      cs_lnum_t jj = b_proj_ids[nn];
+
       for (int pp = 0; pp < dim; pp++)
-        b_proj[dim*(ii*n_obs + jj) + pp] = 0;
+        b_proj[dim*nn + pp] = 0;
 
       for (cs_lnum_t kk = proj_idx[ii]; kk < proj_idx[ii+1]; kk++) {
         cs_real_t x1 = (proj + kk*stride)[dim  ];
@@ -1406,8 +2117,8 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
           cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
 
           for (int pp = 0; pp < dim; pp++)
-            b_proj[dim*(ii*n_obs + jj) + pp] += (proj + kk*stride)[pp] * (proj + ll*stride)[pp]
-                                              * influ;
+            b_proj[dim*nn + pp] +=   (proj + kk*stride)[pp]
+                                   * (proj + ll*stride)[pp] * influ;
         }
       }
     }
@@ -1584,6 +2295,13 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t   *ms,
 /*!
  * \brief Compute analysis for a given variable.
  *
+ * The analysis is localized: cells are grouped into local domains (of the
+ * size of the influence radii), and each domain only uses the closest active
+ * observations within the cutoff distance, with at most n_max_local_obs
+ * of them. Factorizations of the local blocks of HB(H)t+R are kept and
+ * reused as long as the active observations and their time weights are
+ * unchanged.
+ *
  * \param[in]  f            field variable of which analysis will be computed
  * \param[in]  oi           optimal interpolation for field variable
  * \param[in]  f_oia        analysis field of field variable
@@ -1591,6 +2309,7 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t   *ms,
  * \param[in]  ao_idx       index of active observations
  * \param[in]  inverse      boolean, true if it necessary to recompute the
  *                          inverse of HB(H)
+ * \param[in]  mc_id        measures component id
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1639,7 +2358,6 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   const int stride = m_dim + 3; /* dimension of field + dimension of space */
 
   int a_l_size = n_active_obs;
-  int a_size = cs_math_sq(a_l_size);
 
   cs_real_t *inc = NULL;
   BFT_MALLOC(inc, a_l_size, cs_real_t);
@@ -1680,69 +2398,126 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   bft_printf("\n");
 #endif
 
-  cs_real_t *alu = NULL;
-  if (inverse) {
-    cs_real_t *a = _assembly_adding_obs_covariance(ms,
-                                                   oi,
-                                                   ao_idx,
-                                                   n_active_obs,
-                                                   mc_id);
-    BFT_MALLOC(alu, a_size, cs_real_t);
+  /* local analysis domains and factorizations, reused if possible */
+
+  if (oi->lu == NULL) {
+    oi->n_lu = m_dim;
+    BFT_MALLOC(oi->lu, m_dim, cs_at_opt_interp_lu_t);
+    for (int kk = 0; kk < m_dim; kk++) {
+      cs_at_opt_interp_lu_t *_lu = oi->lu + kk;
+      _lu->n_active_obs = -1;
+      _lu->ao_idx = NULL;
+      _lu->n_blocks = 0;
+      _lu->block_idx = NULL;
+      _lu->block_ao = NULL;
+      _lu->lu_idx = NULL;
+      _lu->lu = NULL;
+      _lu->n_domains = 0;
+      _lu->domain_block = NULL;
+      _lu->domain_idx = NULL;
+      _lu->domain_cells = NULL;
+    }
+  }
 
-    cs_math_fact_lu(1, a_l_size, a, alu);
-    BFT_FREE(a);
+  cs_at_opt_interp_lu_t *lu = oi->lu + mc_id;
+
+  bool refactorize = inverse;
+  if (lu->n_active_obs != n_active_obs)
+    refactorize = true;
+  else if (memcmp(lu->ao_idx, ao_idx, n_active_obs*sizeof(int)) != 0)
+    refactorize = true;
+
+  if (refactorize)
+    _factorize_local_sets(ms, oi, n_active_obs, ao_idx, mc_id, lu);
 
 #if _OI_DEBUG_
-    bft_printf("\n   * LU Matrix\n");
-    for (int ii = 0; ii < n_active_obs; ii++) {
-      bft_printf("    ");
-      for (int jj = 0; jj < n_active_obs; jj++) {
-        int id = ii*a_l_size + jj;
-        bft_printf("%.8f ", alu[id]);
-      }
-      bft_printf("\n");
-    }
-#endif
+  {
+    int b_size_max = 0;
+    for (int b_id = 0; b_id < lu->n_blocks; b_id++)
+      b_size_max = CS_MAX(b_size_max,
+                          lu->block_idx[b_id+1] - lu->block_idx[b_id]);
+    bft_printf("\n   * LU factorization (%s)\n", (refactorize) ?
+               "computed" : "reused");
+    bft_printf("    %ld local domains, %d local observation sets,\n"
+               "    max. local observations %d\n",
+               (long)lu->n_domains, lu->n_blocks, b_size_max);
   }
+#endif
 
 #if _OI_DEBUG_
   bft_printf("\n   * Computing (HBHT + R)^-1*I\n");
 #endif
 
-  cs_real_t *vect = NULL;
-  BFT_MALLOC(vect, a_l_size, cs_real_t);
+  /* Forward and backward, for each local observation set */
 
-  /* Forward and backward */
+  cs_lnum_t s_size = lu->block_idx[lu->n_blocks];
 
-  cs_math_fw_and_bw_lu(alu, a_l_size, vect, inc);
+  cs_real_t *b_rhs = NULL, *b_x = NULL;
+  BFT_MALLOC(b_rhs, s_size, cs_real_t);
+  BFT_MALLOC(b_x, s_size, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < s_size; ii++)
+    b_rhs[ii] = inc[lu->block_ao[ii]];
 
-  BFT_FREE(alu);
   BFT_FREE(inc);
 
+# pragma omp parallel for if (lu->n_blocks > CS_THR_MIN)
+  for (int b_id = 0; b_id < lu->n_blocks; b_id++) {
+    int b_size = lu->block_idx[b_id+1] - lu->block_idx[b_id];
+    if (b_size > 0)
+      cs_math_fw_and_bw_lu(lu->lu + lu->lu_idx[b_id],
+                           b_size,
+                           b_x + lu->block_idx[b_id],
+                           b_rhs + lu->block_idx[b_id]);
+  }
+
+  BFT_FREE(b_rhs);
+
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
 
-  for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
+  /* Compute analysis, each cell using the local observation set
+     of its domain */
+
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++)
     f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
       f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
 
-    for (int ll = 0; ll < n_active_obs; ll++) {
-      for (int mm = proj_idx[ao_idx[ll]];
-           mm < proj_idx[ao_idx[ll]+1];
-           mm++) {
-        cs_real_t x = (proj + mm*stride)[m_dim  ];
-        cs_real_t y = (proj + mm*stride)[m_dim+1];
-        cs_real_t z = (proj + mm*stride)[m_dim+2];
-        f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] +=  (proj + mm*stride)[mc_id] * vect[ll]
-                                                   * _b_matrix(cell_cen[ii][0],
-                                                               cell_cen[ii][1],
-                                                               cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
+# pragma omp parallel for if (lu->n_domains > CS_THR_MIN)
+  for (cs_lnum_t d_id = 0; d_id < lu->n_domains; d_id++) {
+
+    int b_id = lu->domain_block[d_id];
+    const int *block_ao = lu->block_ao + lu->block_idx[b_id];
+    const cs_real_t *vect = b_x + lu->block_idx[b_id];
+    int b_size = lu->block_idx[b_id+1] - lu->block_idx[b_id];
+
+    for (cs_lnum_t jj = lu->domain_idx[d_id];
+         jj < lu->domain_idx[d_id+1];
+         jj++) {
+
+      cs_lnum_t c_id = lu->domain_cells[jj];
+      cs_real_t *val = f_oia->val + c_id*f_dim + ms->comp_ids[mc_id];
+
+      for (int ll = 0; ll < b_size; ll++) {
+        int obs_id = ao_idx[block_ao[ll]];
+        for (int mm = proj_idx[obs_id]; mm < proj_idx[obs_id+1]; mm++) {
+          cs_real_t x = (proj + mm*stride)[m_dim  ];
+          cs_real_t y = (proj + mm*stride)[m_dim+1];
+          cs_real_t z = (proj + mm*stride)[m_dim+2];
+          *val +=  (proj + mm*stride)[mc_id] * vect[ll]
+                 * _b_matrix(cell_cen[c_id][0],
+                             cell_cen[c_id][1],
+                             cell_cen[c_id][2],
+                             x, y, z, ir_xy2, ir_z2);
+        }
       }
+
     }
+
   }
 
-  BFT_FREE(vect);
+  BFT_FREE(b_x);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -59,6 +59,28 @@ typedef enum {
 
 } cs_at_opt_interp_type_t;
 
+/* Local analysis for a given measures component: cells are grouped into
+   local domains, each using a bounded set of the closest active observations;
+   blocks of HB(H)t+R are factorized once per distinct local set */
+
+typedef struct {
+
+  int                      n_active_obs;        /* Number of active obs.
+                                                   (-1 if not factorized) */
+  int                     *ao_idx;              /* Active observation ids */
+  int                      n_blocks;            /* Number of local obs. sets */
+  int                     *block_idx;           /* Set index in block_ao */
+  int                     *block_ao;            /* Active obs. by set */
+  cs_lnum_t               *lu_idx;              /* Set index in lu */
+  cs_real_t               *lu;                  /* LU factors of sets */
+  cs_lnum_t                n_domains;           /* Number of local domains */
+  int                     *domain_block;        /* Local set of each domain */
+  cs_lnum_t               *domain_idx;          /* Domain index in
+                                                   domain_cells */
+  cs_lnum_t               *domain_cells;        /* Cell ids by domain */
+
+} cs_at_opt_interp_lu_t;
+
 typedef struct _cs_at_opt_interp_t {
 
   const char              *name;                /* Name */
@@ -70,6 +92,8 @@ typedef struct _cs_at_opt_interp_t {
   cs_real_t               *model_to_obs_proj;
   cs_lnum_t               *model_to_obs_proj_idx;
   cs_lnum_t               *model_to_obs_proj_c_ids;
+  cs_lnum_t               *b_proj_idx;          /* Sparse HB(H)t row index */
+  cs_lnum_t               *b_proj_ids;          /* Sparse HB(H)t obs. ids */
   cs_real_t               *b_proj;
   cs_real_t                ir[2];
   cs_real_t               *relax;
@@ -84,6 +108,11 @@ typedef struct _cs_at_opt_interp_t {
   int                      steady;
   int                      frequency;
   int                      type_nudging;
+  int                      n_max_local_obs;     /* Maximum number of active
+                                                   obs. in a local analysis */
+  int                      n_lu;                /* Number of factorizations */
+  cs_at_opt_interp_lu_t   *lu;                  /* Cached factorizations
+                                                   (per measures component) */
 
 } cs_at_opt_interp_t;
 
@@ -213,6 +242,10 @@ cs_at_opt_interp_obs_operator(cs_measures_set_t  *ms,
 /*!
  * \brief Compute $\tens{H}\tens{B}\transpose{\tens{H}}$.
  *
+ * Only terms between observations whose supports are closer than the
+ * model covariance cutoff distance are computed and stored, in a sparse
+ * (row-indexed) form.
+ *
  * \param[in]  ms  pointer to measures set
  * \param[in]  oi  pointer to an optimal interpolation
  */
@@ -249,6 +282,10 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t  *ms,
 /*!
  * \brief Compute analysis for a given variable.
  *
+ * Active observations are split into independent (uncorrelated) blocks,
+ * whose factorizations are kept and reused as long as the active
+ * observations and their time weights are unchanged.
+ *
  * \param[in]  f            field variable of which analysis will be computed
  * \param[in]  oi           optimal interpolation for field variable
  * \param[in]  f_oia        analysis field of field variable
@@ -256,6 +293,7 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t  *ms,
  * \param[in]  ao_idx       index of active observations
  * \param[in]  inverse      boolean, true if it necessary to recompute the
  *                          inverse of HB(H)
+ * \param[in]  mc_id        measures component id
  */
 /*----------------------------------------------------------------------------*/
 
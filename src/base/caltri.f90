@@ -185,6 +185,10 @@ if (imrgrl.eq.3 .or. imrgrl.eq.6 .or. imrgrl.eq.9) then
   call redvse(anomax)
 endif
 
+! Free mesh arrays only needed for setup (memory-lean mode)
+
+call redmem
+
 !===============================================================================
 ! End of modules initialization
 !===============================================================================
@@ -163,16 +163,17 @@ integer          modntl
 integer          iuntur, f_dim
 integer          nlogla, nsubla, iuiptn
 integer          f_id_rough, f_id
+integer          iwf, nwf
 
 double precision rnx, rny, rnz, rxnn
 double precision tx, ty, tz, txn, txn0, t2x, t2y, t2z
-double precision utau, upx, upy, upz, usn
+double precision utau
 double precision uiptn, uiptmn, uiptmx
 double precision uetmax, uetmin, ukmax, ukmin, yplumx, yplumn
 double precision tetmax, tetmin, tplumx, tplumn
 double precision uk, uet, nusury, yplus, dplus
 double precision sqrcmu, clsyme, ek
-double precision xnuii, xnuit, xmutlm
+double precision xmutlm
 double precision rcprod
 double precision hflui, hint, pimp, qimp
 double precision eloglo(3,3), alpha(6,6)
@@ -193,6 +194,12 @@ double precision, dimension(:), pointer :: viscl, visct, cpro_cp, yplbr, uetbor
 double precision, dimension(:), pointer :: bfpro_roughness
 double precision, dimension(:), allocatable :: byplus, bdplus, buk
 double precision, dimension(:), allocatable :: hbord2
+integer, dimension(:), allocatable :: wf_ids, wf_iuntur
+double precision, dimension(:), allocatable :: wf_xnuii, wf_xnuit, wf_utau
+double precision, dimension(:), allocatable :: wf_distb, wf_rough
+double precision, dimension(:), allocatable :: wf_rnnb, wf_ek
+double precision, dimension(:), allocatable :: wf_uet, wf_uk, wf_yplus
+double precision, dimension(:), allocatable :: wf_ypup, wf_cofimp, wf_dplus
 double precision, dimension(:), pointer :: cvar_k, cvar_ep
 double precision, dimension(:), pointer :: cvar_r11, cvar_r22, cvar_r33
 double precision, dimension(:), pointer :: cvar_r12, cvar_r13, cvar_r23
@@ -549,12 +556,88 @@ allocate(byplus(nfabor))
 allocate(bdplus(nfabor))
 allocate(buk(nfabor))
 
+! --- Evaluate velocity wall functions for all smooth wall faces at once
+
+nwf = 0
+do ifac = 1, nfabor
+  if (icodcl(ifac,iu).eq.5) nwf = nwf + 1
+enddo
+
+allocate(wf_ids(nwf), wf_iuntur(nwf))
+allocate(wf_xnuii(nwf), wf_xnuit(nwf), wf_utau(nwf))
+allocate(wf_distb(nwf), wf_rough(nwf), wf_rnnb(nwf), wf_ek(nwf))
+allocate(wf_uet(nwf), wf_uk(nwf), wf_yplus(nwf))
+allocate(wf_ypup(nwf), wf_cofimp(nwf), wf_dplus(nwf))
+
+iwf = 0
+do ifac = 1, nfabor
+
+  if (icodcl(ifac,iu).eq.5) then
+
+    iwf = iwf + 1
+    iel = ifabor(ifac)
+
+    romc = crom(iel)
+    srfbnf = surfbn(ifac)
+
+    rnx = surfbo(1,ifac)/srfbnf
+    rny = surfbo(2,ifac)/srfbnf
+    rnz = surfbo(3,ifac)/srfbnf
+
+    rcodcx = rcodcl(ifac,iu,1)
+    rcodcy = rcodcl(ifac,iv,1)
+    rcodcz = rcodcl(ifac,iw,1)
+
+    ! If we are not using ALE, force the displacement velocity for the face
+    !  to be tangential (and update rcodcl for possible use)
+    ! In frozen rotor (iturbo = 1), the velocity is neither tangential to the
+    !  wall (absolute velocity solved in a relative frame of reference)
+    if (iale.eq.0.and.iturbo.eq.0) then
+      rcodcn = rcodcx*rnx+rcodcy*rny+rcodcz*rnz
+      rcodcx = rcodcx -rcodcn*rnx
+      rcodcy = rcodcy -rcodcn*rny
+      rcodcz = rcodcz -rcodcn*rnz
+      rcodcl(ifac,iu,1) = rcodcx
+      rcodcl(ifac,iv,1) = rcodcy
+      rcodcl(ifac,iw,1) = rcodcz
+    endif
+
+    ! Relative tangential velocity and turbulence quantities
+
+    call wall_velocity_turb(ifac, iel, rnx, rny, rnz, tx, ty, tz, ek, rnnb)
+
+    wf_ids(iwf) = ifac - 1
+    wf_xnuii(iwf) = viscl(iel)/romc
+    wf_xnuit(iwf) = visct(iel)/romc
+    wf_utau(iwf) = sqrt(tx**2 +ty**2 +tz**2)
+    wf_distb(iwf) = distb(ifac)
+    wf_rnnb(iwf) = rnnb
+    wf_ek(iwf) = ek
+    if (f_id_rough.ge.0) then
+      wf_rough(iwf) = bfpro_roughness(ifac)
+    else
+      wf_rough(iwf) = 0.d0
+    endif
+
+  endif
+
+enddo
+
+call cs_wall_functions_velocity_batch                          &
+  ( iwallf, nwf   , wf_ids,                                    &
+    wf_xnuii, wf_xnuit, wf_utau, wf_distb, wf_rough,           &
+    wf_rnnb, wf_ek,                                            &
+    wf_iuntur, nsubla, nlogla,                                 &
+    wf_uet, wf_uk, wf_yplus, wf_ypup, wf_cofimp, wf_dplus )
+
 ! --- Loop on boundary faces
+iwf = 0
 do ifac = 1, nfabor
 
   ! Test on the presence of a smooth wall condition (start)
   if (icodcl(ifac,iu).eq.5) then
 
+    iwf = iwf + 1
     iel = ifabor(ifac)
 
     ! Physical properties
@@ -582,30 +665,14 @@ do ifac = 1, nfabor
     rcodcy = rcodcl(ifac,iv,1)
     rcodcz = rcodcl(ifac,iw,1)
 
-    ! If we are not using ALE, force the displacement velocity for the face
-    !  to be tangential (and update rcodcl for possible use)
-    ! In frozen rotor (iturbo = 1), the velocity is neither tangential to the
-    !  wall (absolute velocity solved in a relative frame of reference)
-    if (iale.eq.0.and.iturbo.eq.0) then
-      rcodcn = rcodcx*rnx+rcodcy*rny+rcodcz*rnz
-      rcodcx = rcodcx -rcodcn*rnx
-      rcodcy = rcodcy -rcodcn*rny
-      rcodcz = rcodcz -rcodcn*rnz
-      rcodcl(ifac,iu,1) = rcodcx
-      rcodcl(ifac,iv,1) = rcodcy
-      rcodcl(ifac,iw,1) = rcodcz
-    endif
+    ! The displacement velocity was made tangential if needed
+    !  before the wall function evaluation
 
-    ! Relative tangential velocity
+    ! Relative tangential velocity (ek, rnnb and Rij components
+    !  are also set, for use in section 2)
 
-    upx = velipb(ifac,1) - rcodcx
-    upy = velipb(ifac,2) - rcodcy
-    upz = velipb(ifac,3) - rcodcz
+    call wall_velocity_turb(ifac, iel, rnx, rny, rnz, tx, ty, tz, ek, rnnb)
 
-    usn = upx*rnx+upy*rny+upz*rnz
-    tx  = upx -usn*rnx
-    ty  = upy -usn*rny
-    tz  = upz -usn*rnz
     txn = sqrt(tx**2 +ty**2 +tz**2)
     utau= txn
 
@@ -727,51 +794,23 @@ do ifac = 1, nfabor
     !      and uk based on ek
 
     nusury = visclc/(distbf*romc)
-    xnuii = visclc/romc
-    xnuit = visctc/romc
-
-    if (itytur.eq.2 .or. itytur.eq.5 .or. iturb.eq.60) then
-      ek = cvar_k(iel)
-      ! TODO: we could add 2*nu_T dv/dy to rnnb
-      rnnb = 2.d0 / 3.d0 * ek
-    else if (itytur.eq.3) then
-      if (irijco.eq.1) then
-        ek = 0.5d0*(cvar_rij(1,iel)+cvar_rij(2,iel)+cvar_rij(3,iel))
-        rxx = cvar_rij(1,iel)
-        rxy = cvar_rij(4,iel)
-        rxz = cvar_rij(6,iel)
-        ryy = cvar_rij(2,iel)
-        ryz = cvar_rij(5,iel)
-        rzz = cvar_rij(3,iel)
-      else
-        ek = 0.5d0*(cvar_r11(iel)+cvar_r22(iel)+cvar_r33(iel))
-        rxx = cvar_r11(iel)
-        rxy = cvar_r12(iel)
-        rxz = cvar_r13(iel)
-        ryy = cvar_r22(iel)
-        ryz = cvar_r23(iel)
-        rzz = cvar_r33(iel)
-      endif
-      rnnb =   rnx * (rxx * rnx + rxy * rny + rxz * rnz) &
-             + rny * (rxy * rnx + ryy * rny + ryz * rnz) &
-             + rnz * (rxz * rnx + ryz * rny + rzz * rnz)
 
+    if (itytur.eq.3) then
       rttb =   tx * (rxx * tx + rxy * ty + rxz * tz) &
              + ty * (rxy * tx + ryy * ty + ryz * tz) &
              + tz * (rxz * tx + ryz * ty + rzz * tz)
     endif
 
-    if (f_id_rough.ge.0) then
-      roughness = bfpro_roughness(ifac)
-    else
-      roughness = 0.d0
-    endif
+    ! Wall function results (evaluated for all wall faces above)
 
-    call wallfunctions &
-  ( iwallf, ifac  ,                                        &
-    xnuii , xnuit , utau  , distbf, roughness, rnnb, ek,   &
-    iuntur, nsubla, nlogla,                                &
-    uet   , uk    , yplus , ypup  , cofimp, dplus )
+    roughness = wf_rough(iwf)
+    iuntur = wf_iuntur(iwf)
+    uet    = wf_uet(iwf)
+    uk     = wf_uk(iwf)
+    yplus  = wf_yplus(iwf)
+    ypup   = wf_ypup(iwf)
+    cofimp = wf_cofimp(iwf)
+    dplus  = wf_dplus(iwf)
 
     uetmax = max(uet,uetmax)
     uetmin = min(uet,uetmin)
@@ -1544,6 +1583,12 @@ do ifac = 1, nfabor
 enddo
 ! --- End of loop over faces
 
+deallocate(wf_ids, wf_iuntur)
+deallocate(wf_xnuii, wf_xnuit, wf_utau)
+deallocate(wf_distb, wf_rough, wf_rnnb, wf_ek)
+deallocate(wf_uet, wf_uk, wf_yplus)
+deallocate(wf_ypup, wf_cofimp, wf_dplus)
+
 !===========================================================================
 ! 8. Boundary conditions on the other scalars
 !    (Specific treatment for the variances of the scalars next to walls:
@@ -1925,6 +1970,73 @@ endif
 !----
 
 return
+
+contains
+
+  !-----------------------------------------------------------------------------
+
+  !> \brief Relative tangential velocity and turbulence quantities used by
+  !>        the wall functions at a given wall face.
+
+  !> The Reynolds stress components rxx, rxy, rxz, ryy, ryz, rzz of the host
+  !> are also set for Rij models.
+
+  !> \param[in]     ifac          face number
+  !> \param[in]     iel           adjacent cell number
+  !> \param[in]     rnx, rny, rnz unit normal
+  !> \param[out]    tx, ty, tz    relative tangential velocity (not normed)
+  !> \param[out]    ek            turbulent kinetic energy
+  !> \param[out]    rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+
+  subroutine wall_velocity_turb(ifac, iel, rnx, rny, rnz, tx, ty, tz, &
+                                ek, rnnb)
+
+    integer          ifac, iel
+    double precision rnx, rny, rnz, tx, ty, tz, ek, rnnb
+
+    double precision upx, upy, upz, usn
+
+    upx = velipb(ifac,1) - rcodcl(ifac,iu,1)
+    upy = velipb(ifac,2) - rcodcl(ifac,iv,1)
+    upz = velipb(ifac,3) - rcodcl(ifac,iw,1)
+
+    usn = upx*rnx+upy*rny+upz*rnz
+    tx  = upx -usn*rnx
+    ty  = upy -usn*rny
+    tz  = upz -usn*rnz
+
+    ek = 0.d0
+    rnnb = 0.d0
+
+    if (itytur.eq.2 .or. itytur.eq.5 .or. iturb.eq.60) then
+      ek = cvar_k(iel)
+      ! TODO: we could add 2*nu_T dv/dy to rnnb
+      rnnb = 2.d0 / 3.d0 * ek
+    else if (itytur.eq.3) then
+      if (irijco.eq.1) then
+        ek = 0.5d0*(cvar_rij(1,iel)+cvar_rij(2,iel)+cvar_rij(3,iel))
+        rxx = cvar_rij(1,iel)
+        rxy = cvar_rij(4,iel)
+        rxz = cvar_rij(6,iel)
+        ryy = cvar_rij(2,iel)
+        ryz = cvar_rij(5,iel)
+        rzz = cvar_rij(3,iel)
+      else
+        ek = 0.5d0*(cvar_r11(iel)+cvar_r22(iel)+cvar_r33(iel))
+        rxx = cvar_r11(iel)
+        rxy = cvar_r12(iel)
+        rxz = cvar_r13(iel)
+        ryy = cvar_r22(iel)
+        ryz = cvar_r23(iel)
+        rzz = cvar_r33(iel)
+      endif
+      rnnb =   rnx * (rxx * rnx + rxy * rny + rxz * rnz) &
+             + rny * (rxy * rnx + ryy * rny + ryz * rnz) &
+             + rnz * (rxz * rnx + ryz * rny + rzz * rnz)
+    endif
+
+  end subroutine wall_velocity_turb
+
 end subroutine
 
 !===============================================================================
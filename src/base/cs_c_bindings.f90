@@ -2282,6 +2282,31 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function computing velocity wall functions
+    ! for a batch of faces.
+
+    subroutine cs_wall_functions_velocity_batch(iwallf, n_faces, face_ids,  &
+                                                l_visc, t_visc, vel, y,     &
+                                                roughness, rnnb, kinetic_en,&
+                                                iuntur, nsubla, nlogla,     &
+                                                ustar, uk, yplus, ypup,     &
+                                                cofimp, dplus)              &
+      bind(C, name='cs_wall_functions_velocity_batch')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: iwallf, n_faces
+      integer(c_int), dimension(*), intent(in) :: face_ids
+      real(kind=c_double), dimension(*), intent(in) :: l_visc, t_visc, vel
+      real(kind=c_double), dimension(*), intent(in) :: y, roughness, rnnb
+      real(kind=c_double), dimension(*), intent(in) :: kinetic_en
+      integer(c_int), dimension(*), intent(out) :: iuntur
+      integer(c_int), intent(inout) :: nsubla, nlogla
+      real(kind=c_double), dimension(*), intent(out) :: ustar, uk, yplus
+      real(kind=c_double), dimension(*), intent(out) :: ypup, cofimp, dplus
+    end subroutine cs_wall_functions_velocity_batch
+
+    !---------------------------------------------------------------------------
+
     !> (DOXYGEN_SHOULD_SKIP_THIS) \endcond
 
     !---------------------------------------------------------------------------
@@ -48,8 +48,10 @@
 
 #include "cs_log.h"
 #include "cs_map.h"
-#include "cs_parall.h"
+#include "cs_mesh.h"
 #include "cs_mesh_location.h"
+#include "cs_numbering.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -519,20 +521,21 @@ _field_create(const char   *name,
  * allocate and initialize a field values array.
  *
  * parameters:
- *   n_elts  <-- number of associated elements
- *   dim     <-- associated dimension
- *   val_old <-- pointer to previous array in case of reallocation
- *               (usually NULL)
+ *   location_id <-- id of associated mesh location
+ *   n_elts      <-- number of associated elements
+ *   dim         <-- associated dimension
+ *   val_old     <-- pointer to previous array in case of reallocation
+ *                   (usually NULL)
  *
  * returns  pointer to new field values.
  *----------------------------------------------------------------------------*/
 
 static cs_real_t *
-_add_val(cs_lnum_t   n_elts,
-         int         dim,
-         cs_real_t  *val_old)
+_add_val(int          location_id,
+         cs_lnum_t    n_elts,
+         int          dim,
+         cs_real_t   *val_old)
 {
-  cs_lnum_t  ii;
   cs_real_t  *val = val_old;
 
   BFT_REALLOC(val, n_elts*dim, cs_real_t);
@@ -542,20 +545,27 @@ _add_val(cs_lnum_t   n_elts,
      first be touched by the same core that will later operate on
      this memory, usually leading to better core/memory affinity. */
 
-  if (dim == 1) {
-#   pragma omp parallel for
-    for (ii = 0; ii < n_elts; ii++)
-      val[ii] = 0.0;
-  }
-  else {
-    cs_lnum_t jj;
-#   pragma omp parallel for private(jj)
-    for (ii = 0; ii < n_elts; ii++) {
-      for (jj = 0; jj < dim; jj++)
-        val[ii*dim + jj] = 0.0;
+  const cs_numbering_t *numbering = NULL;
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  if (m != NULL) {
+    switch(cs_mesh_location_get_type(location_id)) {
+    case CS_MESH_LOCATION_CELLS:
+      numbering = m->cell_numbering;
+      break;
+    case CS_MESH_LOCATION_INTERIOR_FACES:
+      numbering = m->i_face_numbering;
+      break;
+    case CS_MESH_LOCATION_BOUNDARY_FACES:
+      numbering = m->b_face_numbering;
+      break;
+    default:
+      break;
     }
   }
 
+  cs_numbering_first_touch(numbering, n_elts, dim*sizeof(cs_real_t), val);
+
   return val;
 }
 
@@ -1660,7 +1670,8 @@ cs_field_set_n_time_vals(cs_field_t  *f,
     else { /* if (n_time_vals_ini < _n_time_vals) */
       if (f->is_owner) {
         const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
-        f->val_pre = _add_val(n_elts[2], f->dim, f->val_pre);
+        f->val_pre = _add_val(f->location_id, n_elts[2], f->dim,
+                               f->val_pre);
       }
     }
   }
@@ -1687,7 +1698,8 @@ cs_field_allocate_values(cs_field_t  *f)
     /* Initialization */
 
     for (ii = 0; ii < f->n_time_vals; ii++)
-      f->vals[ii] = _add_val(n_elts[2], f->dim, f->vals[ii]);
+      f->vals[ii] = _add_val(f->location_id, n_elts[2], f->dim,
+                               f->vals[ii]);
 
     f->val = f->vals[0];
     if (f->n_time_vals > 1)
@@ -47,6 +47,8 @@
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
 
 #include "fvm_periodicity.h"
 
@@ -62,6 +64,89 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Node-local exchange through MPI-3 shared memory windows */
+
+#if defined(HAVE_MPI)
+#  if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#    define CS_HALO_HAVE_SHM 1
+#  endif
+#endif
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+#if defined(CS_HALO_HAVE_SHM)
+
+/* Node-local exchange information */
+
+struct _cs_halo_shm_t {
+
+  int               n_node_ranks;  /* Number of node-local neighbor ranks */
+  int              *node_rank;     /* Rank of each communicating domain in
+                                      node communicator, or -1 if not
+                                      node-local (or local rank) */
+
+  MPI_Win           win;           /* Shared memory window */
+  cs_real_t        *send_buffer;   /* Local send buffer (in window) */
+  cs_lnum_t         n_win_vals;    /* Size of local send buffer */
+
+  const cs_real_t **d_buffer;      /* Send buffer of node-local domains */
+  cs_lnum_t        *d_n_vals;      /* Size of send buffer of domains */
+  cs_lnum_t        *d_start;       /* Start of elements destined to local
+                                      rank in send buffer of domains */
+
+  MPI_Request      *request;       /* Notification requests */
+
+};
+
+#endif /* defined(CS_HALO_HAVE_SHM) */
+
+#if defined(HAVE_MPI)
+
+/* Maximum number of (synchronization mode, stride) combinations
+   with persistent requests for a given halo */
+
+#define CS_HALO_N_PERSISTENT_SLOTS 8
+
+/* Persistent requests and buffers for a given (mode, stride) combination */
+
+typedef struct {
+
+  int               end_shift;     /* 1 for standard, 2 for extended */
+  int               stride;        /* Number of values per element */
+
+  int               n_recv;        /* Number of receive requests */
+  int               n_requests;    /* Total number of requests */
+
+  cs_real_t        *send_buffer;   /* Send buffer */
+  cs_real_t        *recv_buffer;   /* Receive buffer */
+
+  MPI_Request      *request;       /* Persistent requests (receives first) */
+
+} _cs_halo_p_slot_t;
+
+/* Persistent communication information */
+
+struct _cs_halo_persistent_t {
+
+  int               n_c_domains;   /* Number of communicating domains
+                                      for which slots were built */
+  int              *c_domain_rank; /* Copy of halo->c_domain_rank */
+  cs_lnum_t        *index;         /* Copy of halo->index */
+  cs_lnum_t        *send_index;    /* Copy of halo->send_index */
+
+  int               n_slots;       /* Number of used slots */
+  _cs_halo_p_slot_t slot[CS_HALO_N_PERSISTENT_SLOTS];
+
+};
+
+#endif /* defined(HAVE_MPI) */
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -95,10 +180,68 @@ static cs_real_t  *_cs_glob_halo_rot_backup = NULL;
 
 static int _cs_glob_halo_use_barrier = false;
 
+/* Should we use persistent requests and per-halo buffers ? */
+
+static bool _cs_glob_halo_use_persistent = true;
+
+/* Should we use shared memory for node-local exchanges ? */
+
+static bool _cs_glob_halo_use_shm = false;
+
+#if defined(CS_HALO_HAVE_SHM)
+
+/* Maximum stride handled through shared memory (larger strides
+   use messages) */
+
+static const int _cs_glob_halo_shm_max_stride = 9;
+
+/* Node communicator, and number of halos using it */
+
+static MPI_Comm  _cs_glob_halo_node_comm = MPI_COMM_NULL;
+static int       _cs_glob_halo_n_shm = 0;
+
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of halo exchange requests, accounting for the
+ * associated wait time in timer statistics.
+ *
+ * parameters:
+ *   count   <-- number of requests
+ *   request <-> array of requests
+ *   status  --> array of statuses, or MPI_STATUSES_IGNORE
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_waitall(int           count,
+              MPI_Request   request[],
+              MPI_Status    status[])
+{
+#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link timer stats */
+
+  cs_timer_t t0 = cs_timer_time();
+
+  MPI_Waitall(count, request, status);
+
+  cs_timer_t t1 = cs_timer_time();
+
+  cs_timer_stats_add_wait(CS_TIMER_STATS_WAIT_HALO, &t0, &t1);
+
+#else
+
+  MPI_Waitall(count, request, status);
+
+#endif
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Save rotation terms of a halo to an internal buffer.
  *
@@ -311,6 +454,588 @@ _zero_rotation_values(const cs_halo_t  *halo,
   }
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Create empty persistent communication information for a halo.
+ *
+ * returns:
+ *   pointer to persistent communication information, or NULL if
+ *   not running in parallel
+ *----------------------------------------------------------------------------*/
+
+static cs_halo_persistent_t *
+_persistent_create(void)
+{
+  cs_halo_persistent_t *p = NULL;
+
+  if (cs_glob_n_ranks < 2)
+    return p;
+
+  BFT_MALLOC(p, 1, cs_halo_persistent_t);
+
+  p->n_c_domains = 0;
+  p->c_domain_rank = NULL;
+  p->index = NULL;
+  p->send_index = NULL;
+
+  p->n_slots = 0;
+
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Free persistent requests and buffers of a halo (but not the
+ * structure itself).
+ *
+ * parameters:
+ *   p <-> pointer to persistent communication information
+ *----------------------------------------------------------------------------*/
+
+static void
+_persistent_clear(cs_halo_persistent_t  *p)
+{
+  for (int s_id = 0; s_id < p->n_slots; s_id++) {
+    _cs_halo_p_slot_t *slot = p->slot + s_id;
+    for (int i = 0; i < slot->n_requests; i++)
+      MPI_Request_free(slot->request + i);
+    BFT_FREE(slot->request);
+    BFT_FREE(slot->recv_buffer);
+    BFT_FREE(slot->send_buffer);
+  }
+  p->n_slots = 0;
+
+  BFT_FREE(p->send_index);
+  BFT_FREE(p->index);
+  BFT_FREE(p->c_domain_rank);
+  p->n_c_domains = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Return persistent requests and buffers matching a halo synchronization
+ * mode and stride, building them if needed.
+ *
+ * Since halos may be modified after their creation (and possibly after
+ * a first synchronization), the halo's communication pattern is compared
+ * to the one for which requests were built, and existing requests are
+ * freed in case of mismatch.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   end_shift <-- 1 for standard halo, 2 for extended halo
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   pointer to matching slot, or NULL if persistent communication
+ *   is not used or all slots are used by other combinations
+ *----------------------------------------------------------------------------*/
+
+static _cs_halo_p_slot_t *
+_persistent_slot(const cs_halo_t  *halo,
+                 int               end_shift,
+                 int               stride)
+{
+  cs_halo_persistent_t *p = halo->persistent;
+
+  if (p == NULL || _cs_glob_halo_use_persistent == false)
+    return NULL;
+
+  const int n_c_domains = halo->n_c_domains;
+  const size_t n_idx = 2*n_c_domains + 1;
+
+  /* Check communication pattern is unchanged */
+
+  if (p->n_c_domains > 0) {
+    if (   p->n_c_domains != n_c_domains
+        || memcmp(p->c_domain_rank, halo->c_domain_rank,
+                  n_c_domains*sizeof(int)) != 0
+        || memcmp(p->index, halo->index, n_idx*sizeof(cs_lnum_t)) != 0
+        || memcmp(p->send_index, halo->send_index,
+                  n_idx*sizeof(cs_lnum_t)) != 0)
+      _persistent_clear(p);
+  }
+
+  if (n_c_domains < 1)
+    return NULL;
+
+  if (p->n_c_domains == 0) {
+    p->n_c_domains = n_c_domains;
+    BFT_MALLOC(p->c_domain_rank, n_c_domains, int);
+    BFT_MALLOC(p->index, n_idx, cs_lnum_t);
+    BFT_MALLOC(p->send_index, n_idx, cs_lnum_t);
+    memcpy(p->c_domain_rank, halo->c_domain_rank, n_c_domains*sizeof(int));
+    memcpy(p->index, halo->index, n_idx*sizeof(cs_lnum_t));
+    memcpy(p->send_index, halo->send_index, n_idx*sizeof(cs_lnum_t));
+  }
+
+  /* Search for existing slot */
+
+  for (int s_id = 0; s_id < p->n_slots; s_id++) {
+    if (   p->slot[s_id].end_shift == end_shift
+        && p->slot[s_id].stride == stride)
+      return p->slot + s_id;
+  }
+
+  if (p->n_slots >= CS_HALO_N_PERSISTENT_SLOTS)
+    return NULL;
+
+  /* Build new slot */
+
+  _cs_halo_p_slot_t *slot = p->slot + p->n_slots;
+  p->n_slots += 1;
+
+  const int local_rank = cs_glob_rank_id;
+
+  slot->end_shift = end_shift;
+  slot->stride = stride;
+  slot->n_recv = 0;
+  slot->n_requests = 0;
+
+  BFT_MALLOC(slot->send_buffer,
+             halo->send_index[2*n_c_domains]*stride,
+             cs_real_t);
+  BFT_MALLOC(slot->recv_buffer,
+             halo->index[2*n_c_domains]*stride,
+             cs_real_t);
+  BFT_MALLOC(slot->request, 2*n_c_domains, MPI_Request);
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->index[2*rank_id];
+    cs_lnum_t length = halo->index[2*rank_id + end_shift] - start;
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Recv_init(slot->recv_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    slot->request + slot->n_requests++);
+
+  }
+
+  slot->n_recv = slot->n_requests;
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t length = halo->send_index[2*rank_id + end_shift] - start;
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Send_init(slot->send_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    slot->request + slot->n_requests++);
+
+  }
+
+  return slot;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy persistent communication information of a halo.
+ *
+ * parameters:
+ *   halo <-> pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_persistent_destroy(cs_halo_t  *halo)
+{
+  if (halo->persistent == NULL)
+    return;
+
+  _persistent_clear(halo->persistent);
+
+  BFT_FREE(halo->persistent);
+}
+
+/*----------------------------------------------------------------------------
+ * Pack strided values to send for a given halo.
+ *
+ * When elements to send for all ranks are contiguous in the send list
+ * (always true for the extended halo, and for the standard halo when
+ * there is no extended halo), they are packed in a single (threaded)
+ * loop; otherwise, each rank's section is packed separately.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   end_shift <-- 1 for standard halo, 2 for extended halo
+ *   var       <-- pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *   buffer    --> send buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_strided(const cs_halo_t  *halo,
+              int               end_shift,
+              const cs_real_t   var[],
+              int               stride,
+              cs_real_t         buffer[])
+{
+  const cs_lnum_t *send_list = halo->send_list;
+
+  int n_sections = 1;
+  if (end_shift == 1) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      if (halo->send_index[2*rank_id + 1] != halo->send_index[2*rank_id + 2])
+        n_sections = halo->n_c_domains;
+    }
+  }
+
+  for (int rank_id = 0; rank_id < n_sections; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t end = halo->send_index[2*rank_id + end_shift];
+    if (n_sections == 1)
+      end = halo->send_index[2*halo->n_c_domains];
+
+    if (stride == 1) {
+#     pragma omp parallel for if (end - start > CS_THR_MIN)
+      for (cs_lnum_t i = start; i < end; i++)
+        buffer[i] = var[send_list[i]];
+    }
+    else if (stride == 3) {
+#     pragma omp parallel for if (end - start > CS_THR_MIN)
+      for (cs_lnum_t i = start; i < end; i++) {
+        const cs_real_t *v = var + send_list[i]*3;
+        buffer[i*3]     = v[0];
+        buffer[i*3 + 1] = v[1];
+        buffer[i*3 + 2] = v[2];
+      }
+    }
+    else {
+#     pragma omp parallel for if ((end - start)*stride > CS_THR_MIN)
+      for (cs_lnum_t i = start; i < end; i++) {
+        const cs_real_t *v = var + send_list[i]*stride;
+        for (int j = 0; j < stride; j++)
+          buffer[i*stride + j] = v[j];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Exchange strided variable values with distant ranks using persistent
+ * requests and per-halo buffers.
+ *
+ * Receives are started before packing, and received values are then
+ * copied from the receive buffer to the halo section of the variable.
+ *
+ * parameters:
+ *   halo   <-- pointer to halo structure
+ *   slot   <-> associated persistent requests and buffers
+ *   var    <-> pointer to variable value array
+ *
+ * returns:
+ *   id of local rank in halo communicating domains, or -1
+ *----------------------------------------------------------------------------*/
+
+static int
+_sync_var_strided_persistent(const cs_halo_t    *halo,
+                             _cs_halo_p_slot_t  *slot,
+                             cs_real_t           var[])
+{
+  int local_rank_id = -1;
+
+  const int local_rank = cs_glob_rank_id;
+  const int end_shift = slot->end_shift;
+  const int stride = slot->stride;
+
+  if (slot->n_recv > 0)
+    MPI_Startall(slot->n_recv, slot->request);
+
+  _pack_strided(halo, end_shift, var, stride, slot->send_buffer);
+
+  /* We wait for posting all receives (often recommended) */
+
+  if (_cs_glob_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  if (slot->n_requests > slot->n_recv)
+    MPI_Startall(slot->n_requests - slot->n_recv,
+                 slot->request + slot->n_recv);
+
+  _halo_waitall(slot->n_requests, slot->request, MPI_STATUSES_IGNORE);
+
+  /* Copy received values */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank) {
+      local_rank_id = rank_id;
+      continue;
+    }
+
+    size_t start = halo->index[2*rank_id]*stride;
+    size_t length = (  halo->index[2*rank_id + end_shift]
+                     - halo->index[2*rank_id]) * stride;
+
+    if (length > 0)
+      memcpy(var + halo->n_local_elts*stride + start,
+             slot->recv_buffer + start,
+             length*sizeof(cs_real_t));
+
+  }
+
+  return local_rank_id;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+#if defined(CS_HALO_HAVE_SHM)
+
+/*----------------------------------------------------------------------------
+ * Destroy node-local exchange information of a halo.
+ *
+ * This operation is collective on the node communicator.
+ *
+ * parameters:
+ *   halo <-> pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_shm_destroy(cs_halo_t  *halo)
+{
+  cs_halo_shm_t *shm = halo->shm;
+
+  if (shm == NULL)
+    return;
+
+  MPI_Win_unlock_all(shm->win);
+  MPI_Win_free(&(shm->win));
+
+  BFT_FREE(shm->request);
+  BFT_FREE(shm->d_start);
+  BFT_FREE(shm->d_n_vals);
+  BFT_FREE(shm->d_buffer);
+  BFT_FREE(shm->node_rank);
+
+  BFT_FREE(halo->shm);
+
+  _cs_glob_halo_n_shm -= 1;
+
+  if (_cs_glob_halo_n_shm == 0)
+    MPI_Comm_free(&_cs_glob_halo_node_comm);
+}
+
+#endif /* defined(CS_HALO_HAVE_SHM) */
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Exchange strided variable values with distant ranks, using shared
+ * memory for node-local ranks.
+ *
+ * Local send buffers are placed in a shared memory window, so values from
+ * node-local ranks are copied directly from their send buffer; zero-byte
+ * messages are used to signal that data is ready (from sender to
+ * receiver), and that it has been read (from receiver to sender),
+ * so the sender does not overwrite it at the next exchange.
+ *
+ * Values for ranks on other nodes, or whose size exceeds the shared
+ * buffer size, use regular messages.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   end_shift <-- 1 for standard halo, 2 for extended halo
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   id of local rank in halo communicating domains, or -1
+ *----------------------------------------------------------------------------*/
+
+static int
+_sync_var_strided_shm(const cs_halo_t  *halo,
+                      cs_lnum_t         end_shift,
+                      cs_real_t         var[],
+                      int               stride)
+{
+  int local_rank_id = -1;
+
+#if defined(CS_HALO_HAVE_SHM)
+
+  const cs_halo_shm_t *shm = halo->shm;
+
+  const int local_rank = cs_glob_rank_id;
+  const int n_c_domains = halo->n_c_domains;
+
+  int request_count = 0, n_ready = 0, n_notify = 0;
+
+  cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+
+  MPI_Request *ready_request = shm->request;
+  MPI_Request *notify_request = shm->request + n_c_domains;
+
+  /* Receive data from distant ranks, or notifications from
+     node-local ranks (ready to read first, then done reading) */
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    const int d_rank = halo->c_domain_rank[rank_id];
+
+    if (d_rank == local_rank) {
+      local_rank_id = rank_id;
+      continue;
+    }
+
+    cs_lnum_t r_length = (  halo->index[2*rank_id + end_shift]
+                          - halo->index[2*rank_id]) * stride;
+
+    if (r_length > 0) {
+      if (   shm->node_rank[rank_id] > -1
+          && shm->d_start[rank_id]*stride + r_length
+             <= shm->d_n_vals[rank_id])
+        MPI_Irecv(NULL, 0, MPI_BYTE, d_rank, d_rank, cs_glob_mpi_comm,
+                  ready_request + n_ready++);
+      else
+        MPI_Irecv(var + (halo->n_local_elts + halo->index[2*rank_id])*stride,
+                  r_length,
+                  CS_MPI_REAL,
+                  d_rank,
+                  d_rank,
+                  cs_glob_mpi_comm,
+                  &(_cs_glob_halo_request[request_count++]));
+    }
+
+    cs_lnum_t s_end = halo->send_index[2*rank_id + end_shift] * stride;
+    cs_lnum_t s_length = s_end - halo->send_index[2*rank_id]*stride;
+
+    if (   s_length > 0 && shm->node_rank[rank_id] > -1
+        && s_end <= shm->n_win_vals)
+      MPI_Irecv(NULL, 0, MPI_BYTE, d_rank, d_rank, cs_glob_mpi_comm,
+                notify_request + n_notify++);
+
+  }
+
+  /* Assemble buffers for halo exchange */
+
+  bool shm_send = false;
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      continue;
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t end = halo->send_index[2*rank_id + end_shift];
+
+    cs_real_t *_buffer = build_buffer;
+
+    if (shm->node_rank[rank_id] > -1 && end*stride <= shm->n_win_vals) {
+      _buffer = shm->send_buffer;
+      if (end > start)
+        shm_send = true;
+    }
+
+    for (cs_lnum_t i = start; i < end; i++) {
+      for (int j = 0; j < stride; j++)
+        _buffer[i*stride + j] = var[(halo->send_list[i])*stride + j];
+    }
+
+  }
+
+  if (shm_send)
+    MPI_Win_sync(shm->win);
+
+  /* We wait for posting all receives (often recommended) */
+
+  if (_cs_glob_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  /* Send data to distant ranks, or notify node-local ranks */
+
+  for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+    const int d_rank = halo->c_domain_rank[rank_id];
+
+    if (d_rank == local_rank)
+      continue;
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t end = halo->send_index[2*rank_id + end_shift];
+
+    if (end <= start)
+      continue;
+
+    if (shm->node_rank[rank_id] > -1 && end*stride <= shm->n_win_vals)
+      MPI_Isend(NULL, 0, MPI_BYTE, d_rank, local_rank, cs_glob_mpi_comm,
+                notify_request + n_notify++);
+    else
+      MPI_Isend(build_buffer + start*stride,
+                (end - start)*stride,
+                CS_MPI_REAL,
+                d_rank,
+                local_rank,
+                cs_glob_mpi_comm,
+                &(_cs_glob_halo_request[request_count++]));
+
+  }
+
+  /* Read values from node-local ranks once available */
+
+  if (n_ready > 0) {
+
+    _halo_waitall(n_ready, ready_request, MPI_STATUSES_IGNORE);
+    MPI_Win_sync(shm->win);
+
+    for (int rank_id = 0; rank_id < n_c_domains; rank_id++) {
+
+      const int d_rank = halo->c_domain_rank[rank_id];
+
+      if (d_rank == local_rank || shm->node_rank[rank_id] < 0)
+        continue;
+
+      cs_lnum_t r_length = (  halo->index[2*rank_id + end_shift]
+                            - halo->index[2*rank_id]) * stride;
+      cs_lnum_t d_start = shm->d_start[rank_id]*stride;
+
+      if (r_length < 1 || d_start + r_length > shm->d_n_vals[rank_id])
+        continue;
+
+      const cs_real_t *d_buffer = shm->d_buffer[rank_id] + d_start;
+      cs_real_t *recv_var
+        = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
+
+      for (cs_lnum_t i = 0; i < r_length; i++)
+        recv_var[i] = d_buffer[i];
+
+      MPI_Isend(NULL, 0, MPI_BYTE, d_rank, local_rank, cs_glob_mpi_comm,
+                notify_request + n_notify++);
+
+    }
+
+  }
+
+  /* Wait for all exchanges */
+
+  _halo_waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+  _halo_waitall(n_notify, notify_request, MPI_STATUSES_IGNORE);
+
+#else
+
+  CS_UNUSED(end_shift);
+  CS_UNUSED(var);
+  CS_UNUSED(stride);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (halo->c_domain_rank[rank_id] == cs_glob_rank_id)
+      local_rank_id = rank_id;
+  }
+
+#endif /* defined(CS_HALO_HAVE_SHM) */
+
+  return local_rank_id;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -444,6 +1169,14 @@ cs_halo_create(const cs_interface_set_t  *ifs)
 
   halo->send_list = NULL;
 
+  halo->shm = NULL;
+
+#if defined(HAVE_MPI)
+  halo->persistent = _persistent_create();
+#else
+  halo->persistent = NULL;
+#endif
+
   _cs_glob_n_halos += 1;
 
   return halo;
@@ -508,6 +1241,14 @@ cs_halo_create_from_ref(const cs_halo_t  *ref)
 
   halo->send_list = NULL;
 
+  halo->shm = NULL;
+
+#if defined(HAVE_MPI)
+  halo->persistent = _persistent_create();
+#else
+  halo->persistent = NULL;
+#endif
+
   _cs_glob_n_halos += 1;
 
   return halo;
@@ -560,6 +1301,13 @@ cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
   halo->periodicity = NULL;
   halo->send_perio_lst = NULL;
   halo->perio_lst = NULL;
+  halo->shm = NULL;
+
+#if defined(HAVE_MPI)
+  halo->persistent = _persistent_create();
+#else
+  halo->persistent = NULL;
+#endif
 
   halo->n_local_elts = n_local_elts;
 
@@ -767,6 +1515,14 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   cs_halo_t  *_halo = *halo;
 
+#if defined(CS_HALO_HAVE_SHM)
+  _shm_destroy(_halo);
+#endif
+
+#if defined(HAVE_MPI)
+  _persistent_destroy(_halo);
+#endif
+
   BFT_FREE(_halo->c_domain_rank);
 
   BFT_FREE(_halo->send_perio_lst);
@@ -802,6 +1558,138 @@ cs_halo_destroy(cs_halo_t  **halo)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize node-local exchange through shared memory for a halo.
+ *
+ * Halo values of neighbor ranks on the same compute node are then read
+ * directly from their send buffer in a shared memory window, with only
+ * (zero-byte) notifications using messages; values from ranks on other
+ * nodes still use messages.
+ *
+ * This function does nothing unless shared memory use has been enabled
+ * through cs_halo_set_use_shared_memory() and MPI-3 is available. It is
+ * collective on cs_glob_mpi_comm (as is the destruction of the halo
+ * afterwards), so it is called for the main mesh halo only.
+ *
+ * parameters:
+ *   halo <-> pointer to cs_halo_t structure.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_shared_memory_init(cs_halo_t  *halo)
+{
+#if defined(CS_HALO_HAVE_SHM)
+
+  if (   _cs_glob_halo_use_shm == false || cs_glob_n_ranks < 2
+      || halo == NULL || halo->shm != NULL)
+    return;
+
+  const int n_c_domains = halo->n_c_domains;
+  const int local_rank = cs_glob_rank_id;
+
+  /* Node communicator */
+
+  if (_cs_glob_halo_node_comm == MPI_COMM_NULL)
+    MPI_Comm_split_type(cs_glob_mpi_comm,
+                        MPI_COMM_TYPE_SHARED,
+                        local_rank,
+                        MPI_INFO_NULL,
+                        &_cs_glob_halo_node_comm);
+
+  cs_halo_shm_t *shm;
+  BFT_MALLOC(shm, 1, cs_halo_shm_t);
+
+  /* Rank of communicating domains in node communicator */
+
+  BFT_MALLOC(shm->node_rank, n_c_domains, int);
+
+  MPI_Group g_glob, g_node;
+  MPI_Comm_group(cs_glob_mpi_comm, &g_glob);
+  MPI_Comm_group(_cs_glob_halo_node_comm, &g_node);
+
+  MPI_Group_translate_ranks(g_glob, n_c_domains, halo->c_domain_rank,
+                            g_node, shm->node_rank);
+
+  MPI_Group_free(&g_node);
+  MPI_Group_free(&g_glob);
+
+  shm->n_node_ranks = 0;
+  for (int i = 0; i < n_c_domains; i++) {
+    if (   shm->node_rank[i] == MPI_UNDEFINED
+        || halo->c_domain_rank[i] == local_rank)
+      shm->node_rank[i] = -1;
+    else
+      shm->n_node_ranks += 1;
+  }
+
+  /* Send buffer in shared memory window */
+
+  shm->n_win_vals =   halo->n_send_elts[CS_HALO_EXTENDED]
+                    * _cs_glob_halo_shm_max_stride;
+
+  MPI_Win_allocate_shared(shm->n_win_vals * sizeof(cs_real_t),
+                          sizeof(cs_real_t),
+                          MPI_INFO_NULL,
+                          _cs_glob_halo_node_comm,
+                          &(shm->send_buffer),
+                          &(shm->win));
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, shm->win);
+
+  /* Send buffers of node-local ranks */
+
+  BFT_MALLOC(shm->d_buffer, n_c_domains, const cs_real_t *);
+  BFT_MALLOC(shm->d_n_vals, n_c_domains, cs_lnum_t);
+  BFT_MALLOC(shm->d_start, n_c_domains, cs_lnum_t);
+
+  for (int i = 0; i < n_c_domains; i++) {
+    shm->d_buffer[i] = NULL;
+    shm->d_n_vals[i] = 0;
+    shm->d_start[i] = 0;
+    if (shm->node_rank[i] > -1) {
+      MPI_Aint size;
+      int disp_unit;
+      cs_real_t *base = NULL;
+      MPI_Win_shared_query(shm->win, shm->node_rank[i],
+                           &size, &disp_unit, &base);
+      shm->d_buffer[i] = base;
+      shm->d_n_vals[i] = size / sizeof(cs_real_t);
+    }
+  }
+
+  /* Exchange start of elements destined to each node-local rank */
+
+  BFT_MALLOC(shm->request, 4*n_c_domains, MPI_Request);
+
+  int request_count = 0;
+
+  for (int i = 0; i < n_c_domains; i++) {
+    if (shm->node_rank[i] > -1)
+      MPI_Irecv(shm->d_start + i, 1, CS_MPI_LNUM,
+                halo->c_domain_rank[i], halo->c_domain_rank[i],
+                cs_glob_mpi_comm, shm->request + request_count++);
+  }
+
+  for (int i = 0; i < n_c_domains; i++) {
+    if (shm->node_rank[i] > -1)
+      MPI_Isend(halo->send_index + 2*i, 1, CS_MPI_LNUM,
+                halo->c_domain_rank[i], local_rank,
+                cs_glob_mpi_comm, shm->request + request_count++);
+  }
+
+  MPI_Waitall(request_count, shm->request, MPI_STATUSES_IGNORE);
+
+  halo->shm = shm;
+
+  _cs_glob_halo_n_shm += 1;
+
+#else
+
+  CS_UNUSED(halo);
+
+#endif /* defined(CS_HALO_HAVE_SHM) */
+}
+
 /*----------------------------------------------------------------------------
  * Update global buffer sizes so as to be usable with a given halo.
  *
@@ -1024,7 +1912,7 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _halo_waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
 
   }
 
@@ -1216,7 +2104,7 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _halo_waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1355,7 +2243,7 @@ cs_halo_sync_num(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _halo_waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1407,7 +2295,17 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1) {
+  _cs_halo_p_slot_t *p_slot = NULL;
+  if (cs_glob_n_ranks > 1 && halo->shm == NULL)
+    p_slot = _persistent_slot(halo, end_shift, 1);
+
+  if (cs_glob_n_ranks > 1 && halo->shm != NULL)
+    local_rank_id = _sync_var_strided_shm(halo, end_shift, var, 1);
+
+  else if (p_slot != NULL)
+    local_rank_id = _sync_var_strided_persistent(halo, p_slot, var);
+
+  else if (cs_glob_n_ranks > 1) {
 
     int rank_id;
     int request_count = 0;
@@ -1485,7 +2383,7 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _halo_waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1549,7 +2447,17 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1) {
+  _cs_halo_p_slot_t *p_slot = NULL;
+  if (cs_glob_n_ranks > 1 && halo->shm == NULL)
+    p_slot = _persistent_slot(halo, end_shift, stride);
+
+  if (cs_glob_n_ranks > 1 && halo->shm != NULL)
+    local_rank_id = _sync_var_strided_shm(halo, end_shift, var, stride);
+
+  else if (p_slot != NULL)
+    local_rank_id = _sync_var_strided_persistent(halo, p_slot, var);
+
+  else if (cs_glob_n_ranks > 1) {
 
     int rank_id;
     int request_count = 0;
@@ -1651,7 +2559,7 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _halo_waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1812,6 +2720,67 @@ cs_halo_set_use_barrier(bool use_barrier)
   _cs_glob_halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return shared memory (node-local exchange) usage flag.
+ *
+ * returns:
+ *   true if halos may exchange values with ranks on the same node through
+ *   MPI-3 shared memory, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_shared_memory(void)
+{
+  return _cs_glob_halo_use_shm;
+}
+
+/*----------------------------------------------------------------------------
+ * Set shared memory (node-local exchange) usage flag.
+ *
+ * This setting only applies to halos for which
+ * cs_halo_shared_memory_init() is called afterwards, so it should be set
+ * before the mesh halo is built (for example in cs_user_partition()).
+ *
+ * parameters:
+ *   use_shm <-- true if halos may exchange values with ranks on the same
+ *               node through MPI-3 shared memory, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_shared_memory(bool  use_shm)
+{
+  _cs_glob_halo_use_shm = use_shm;
+}
+
+/*----------------------------------------------------------------------------
+ * Return persistent communication usage flag.
+ *
+ * returns:
+ *   true if halo exchanges of floating-point values use per-halo buffers
+ *   and persistent MPI requests, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void)
+{
+  return _cs_glob_halo_use_persistent;
+}
+
+/*----------------------------------------------------------------------------
+ * Set persistent communication usage flag.
+ *
+ * parameters:
+ *   use_persistent <-- true if halo exchanges of floating-point values
+ *                      should use per-halo buffers and persistent MPI
+ *                      requests, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool  use_persistent)
+{
+  _cs_glob_halo_use_persistent = use_persistent;
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -65,6 +65,14 @@ typedef enum {
 
 } cs_halo_rotation_t ;
 
+/* Node-local (shared memory) exchange information (private) */
+
+typedef struct _cs_halo_shm_t  cs_halo_shm_t;
+
+/* Persistent communication information (private) */
+
+typedef struct _cs_halo_persistent_t  cs_halo_persistent_t;
+
 /* Structure for halo management */
 /* ----------------------------- */
 
@@ -152,6 +160,12 @@ typedef struct {
 
   */
 
+  cs_halo_shm_t  *shm;      /* Node-local exchange information
+                               (for MPI-3 shared memory), or NULL */
+
+  cs_halo_persistent_t  *persistent;  /* Persistent requests and buffers
+                                         (built on demand), or NULL */
+
 } cs_halo_t;
 
 /*=============================================================================
@@ -240,6 +254,26 @@ cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
 void
 cs_halo_destroy(cs_halo_t  **halo);
 
+/*----------------------------------------------------------------------------
+ * Initialize node-local exchange through shared memory for a halo.
+ *
+ * Halo values of neighbor ranks on the same compute node are then read
+ * directly from their send buffer in a shared memory window, with only
+ * (zero-byte) notifications using messages; values from ranks on other
+ * nodes still use messages.
+ *
+ * This function does nothing unless shared memory use has been enabled
+ * through cs_halo_set_use_shared_memory() and MPI-3 is available. It is
+ * collective on cs_glob_mpi_comm (as is the destruction of the halo
+ * afterwards), so it is called for the main mesh halo only.
+ *
+ * parameters:
+ *   halo <-> pointer to cs_halo_t structure.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_shared_memory_init(cs_halo_t  *halo);
+
 /*----------------------------------------------------------------------------
  * Update global buffer sizes so as to be usable with a given halo.
  *
@@ -460,6 +494,55 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return shared memory (node-local exchange) usage flag.
+ *
+ * returns:
+ *   true if halos may exchange values with ranks on the same node through
+ *   MPI-3 shared memory, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_shared_memory(void);
+
+/*----------------------------------------------------------------------------
+ * Set shared memory (node-local exchange) usage flag.
+ *
+ * This setting only applies to halos for which
+ * cs_halo_shared_memory_init() is called afterwards, so it should be set
+ * before the mesh halo is built (for example in cs_user_partition()).
+ *
+ * parameters:
+ *   use_shm <-- true if halos may exchange values with ranks on the same
+ *               node through MPI-3 shared memory, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_shared_memory(bool  use_shm);
+
+/*----------------------------------------------------------------------------
+ * Return persistent communication usage flag.
+ *
+ * returns:
+ *   true if halo exchanges of floating-point values use per-halo buffers
+ *   and persistent MPI requests, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void);
+
+/*----------------------------------------------------------------------------
+ * Set persistent communication usage flag.
+ *
+ * parameters:
+ *   use_persistent <-- true if halo exchanges of floating-point values
+ *                      should use per-halo buffers and persistent MPI
+ *                      requests, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool  use_persistent);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
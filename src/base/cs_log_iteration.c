@@ -116,6 +116,39 @@ typedef struct {
 
 } cs_log_clip_t;
 
+/* Working values for logging at a given time step */
+/*-------------------------------------------------*/
+
+typedef struct {
+
+  int          n_locations;      /* Number of mesh locations */
+  cs_gnum_t   *n_g_elts;         /* Global number of elements per location */
+  double      *total_weight;     /* Total weight per location, or -1 */
+
+  int          f_count;          /* Number of logged field values */
+  int          f_loc_count[4];   /* Number of logged field values
+                                    per field location */
+  size_t       f_name_width[4];  /* Maximum field name width
+                                    per field location */
+  int         *f_log_id;         /* Start id of values for each field,
+                                    or -1 if not logged */
+  int         *f_moment_id;      /* Associated moment id, or -1 */
+  double      *f_vmin;           /* Field minimum values */
+  double      *f_vmax;           /* Field maximum values */
+  double      *f_vsum;           /* Field sums */
+  double      *f_wsum;           /* Field weighted sums */
+
+  double      *s_vmin;           /* Simple statistics minimum values */
+  double      *s_vmax;           /* Simple statistics maximum values */
+  double      *s_vsum;           /* Simple statistics sums */
+  double      *s_wsum;           /* Simple statistics weighted sums */
+
+  double      *c_vmin;           /* Minimum values prior to clipping */
+  double      *c_vmax;           /* Maximum values prior to clipping */
+  cs_gnum_t   *c_count;          /* Clipping counts */
+
+} cs_log_work_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -144,6 +177,18 @@ static cs_log_clip_t  *_clips = NULL;
 
 static cs_time_plot_t  *_l2_residual_plot = NULL;
 
+/* Global reductions for logging are grouped */
+
+static cs_parall_reduce_t  *_log_reduce = NULL;
+
+/* Mesh locations for field logging */
+
+static const cs_mesh_location_type_t _field_log_locations[]
+  = {CS_MESH_LOCATION_CELLS,
+     CS_MESH_LOCATION_INTERIOR_FACES,
+     CS_MESH_LOCATION_BOUNDARY_FACES,
+     CS_MESH_LOCATION_VERTICES};
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -507,33 +552,200 @@ _log_clip_info(const char        *prefix,
 }
 
 /*----------------------------------------------------------------------------
- * Main logging output of variables.
+ * Initialize working values for logging at the current time step.
+ *
+ * Local mesh location info and copies of clipping and simple statistics
+ * values are registered for global reduction.
+ *
+ * parameters:
+ *   w <-> pointer to working values structure
+ *   r <-> pointer to aggregated reduction structure
  *----------------------------------------------------------------------------*/
 
 static void
-_log_fields(void)
+_log_work_init(cs_log_work_t       *w,
+               cs_parall_reduce_t  *r)
 {
-  int f_id, li, log_count;
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  /* Mesh locations */
+
+  w->n_locations = cs_mesh_location_n_locations();
+
+  BFT_MALLOC(w->n_g_elts, w->n_locations, cs_gnum_t);
+  BFT_MALLOC(w->total_weight, w->n_locations, double);
+
+  for (int loc_id = 0; loc_id < w->n_locations; loc_id++) {
+
+    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(loc_id);
+    const cs_lnum_t _n_elts = n_elts[0];
 
+    w->n_g_elts[loc_id] = 0;
+    w->total_weight[loc_id] = -1;
+
+    if (mq == NULL)
+      continue;
+
+    /* Values are weighted only when the total weight is defined */
+
+    switch(loc_id) {
+    case CS_MESH_LOCATION_CELLS:
+      w->n_g_elts[loc_id] = m->n_g_cells;
+      w->total_weight[loc_id] = mq->tot_vol;
+      break;
+    case CS_MESH_LOCATION_INTERIOR_FACES:
+      w->n_g_elts[loc_id] = m->n_g_i_faces;
+      cs_array_reduce_sum_l(_n_elts, 1, NULL, mq->i_face_surf,
+                            w->total_weight + loc_id);
+      cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, 1, CS_DOUBLE,
+                           w->total_weight + loc_id);
+      break;
+    case CS_MESH_LOCATION_BOUNDARY_FACES:
+      w->n_g_elts[loc_id] = m->n_g_b_faces;
+      cs_array_reduce_sum_l(_n_elts, 1, NULL, mq->b_face_surf,
+                            w->total_weight + loc_id);
+      cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, 1, CS_DOUBLE,
+                           w->total_weight + loc_id);
+      break;
+    case CS_MESH_LOCATION_VERTICES:
+      w->n_g_elts[loc_id] = m->n_g_vertices;
+      break;
+    default:
+      w->n_g_elts[loc_id] = _n_elts;
+      cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, 1, CS_GNUM_TYPE,
+                           w->n_g_elts + loc_id);
+      break;
+    }
+
+  }
+
+  /* Fields (values computed later) */
+
+  w->f_count = 0;
+  for (int li = 0; li < 4; li++) {
+    w->f_loc_count[li] = 0;
+    w->f_name_width[li] = 0;
+  }
+  w->f_log_id = NULL;
+  w->f_moment_id = NULL;
+  w->f_vmin = NULL;
+  w->f_vmax = NULL;
+  w->f_vsum = NULL;
+  w->f_wsum = NULL;
+
+  /* Simple statistics */
+
+  w->s_vmin = NULL;
+  w->s_vmax = NULL;
+  w->s_vsum = NULL;
+  w->s_wsum = NULL;
+
+  if (_n_sstats > 0) {
+
+    BFT_MALLOC(w->s_vmin, _sstats_val_size, double);
+    BFT_MALLOC(w->s_vmax, _sstats_val_size, double);
+    BFT_MALLOC(w->s_vsum, _sstats_val_size, double);
+    BFT_MALLOC(w->s_wsum, _sstats_val_size, double);
+
+    memcpy(w->s_vmin, _sstats_vmin, _sstats_val_size*sizeof(double));
+    memcpy(w->s_vmax, _sstats_vmax, _sstats_val_size*sizeof(double));
+    memcpy(w->s_vsum, _sstats_vsum, _sstats_val_size*sizeof(double));
+    memcpy(w->s_wsum, _sstats_wsum, _sstats_val_size*sizeof(double));
+
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN,
+                         _sstats_val_size, CS_DOUBLE, w->s_vmin);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX,
+                         _sstats_val_size, CS_DOUBLE, w->s_vmax);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM,
+                         _sstats_val_size, CS_DOUBLE, w->s_vsum);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM,
+                         _sstats_val_size, CS_DOUBLE, w->s_wsum);
+
+  }
+
+  /* Clippings */
+
+  w->c_vmin = NULL;
+  w->c_vmax = NULL;
+  w->c_count = NULL;
+
+  if (_n_clips > 0) {
+
+    BFT_MALLOC(w->c_vmin, _clips_val_size, double);
+    BFT_MALLOC(w->c_vmax, _clips_val_size, double);
+    BFT_MALLOC(w->c_count, _clips_val_size*2, cs_gnum_t);
+
+    memcpy(w->c_vmin, _clips_vmin, _clips_val_size*sizeof(double));
+    memcpy(w->c_vmax, _clips_vmax, _clips_val_size*sizeof(double));
+    memcpy(w->c_count, _clips_count, _clips_val_size*sizeof(cs_gnum_t)*2);
+
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN,
+                         _clips_val_size, CS_DOUBLE, w->c_vmin);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX,
+                         _clips_val_size, CS_DOUBLE, w->c_vmax);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM,
+                         _clips_val_size*2, CS_GNUM_TYPE, w->c_count);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free working values for logging at the current time step.
+ *
+ * parameters:
+ *   w <-> pointer to working values structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_work_free(cs_log_work_t  *w)
+{
+  BFT_FREE(w->c_count);
+  BFT_FREE(w->c_vmax);
+  BFT_FREE(w->c_vmin);
+
+  BFT_FREE(w->s_wsum);
+  BFT_FREE(w->s_vsum);
+  BFT_FREE(w->s_vmax);
+  BFT_FREE(w->s_vmin);
+
+  BFT_FREE(w->f_wsum);
+  BFT_FREE(w->f_vsum);
+  BFT_FREE(w->f_vmax);
+  BFT_FREE(w->f_vmin);
+  BFT_FREE(w->f_moment_id);
+  BFT_FREE(w->f_log_id);
+
+  BFT_FREE(w->total_weight);
+  BFT_FREE(w->n_g_elts);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute local statistics of logged fields.
+ *
+ * Local values are registered for global reduction.
+ *
+ * parameters:
+ *   w <-> pointer to working values structure
+ *   r <-> pointer to aggregated reduction structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_fields_compute(cs_log_work_t       *w,
+                    cs_parall_reduce_t  *r)
+{
+  int f_id, li;
+
+  int log_count = 0;
   int log_count_max = 0;
-  int fpe_flag = 0;
   int     *log_id = NULL, *moment_id = NULL;
   double  *vmin = NULL, *vmax = NULL, *vsum = NULL, *wsum = NULL;
 
-  char tmp_s[5][64] =  {"", "", "", "", ""};
-
-  const char _underline[] = "---------------------------------";
   const int n_fields = cs_field_n_fields();
   const int n_moments = cs_time_moment_n_moments();
   const int log_key_id = cs_field_key_id("log");
   const int label_key_id = cs_field_key_id("label");
 
-  const cs_mesh_location_type_t m_l[] = {CS_MESH_LOCATION_CELLS,
-                                         CS_MESH_LOCATION_INTERIOR_FACES,
-                                         CS_MESH_LOCATION_BOUNDARY_FACES,
-                                         CS_MESH_LOCATION_VERTICES
-                                         };
-
   cs_mesh_t *m = cs_glob_mesh;
   const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
 
@@ -547,6 +759,9 @@ _log_fields(void)
   BFT_MALLOC(vsum, log_count_max, double);
   BFT_MALLOC(wsum, log_count_max, double);
 
+  for (f_id = 0; f_id < n_fields; f_id++)
+    log_id[f_id] = -1;
+
   if (n_moments > 0) {
     BFT_MALLOC(moment_id, n_fields, int);
     for (f_id = 0; f_id < n_fields; f_id++)
@@ -563,55 +778,37 @@ _log_fields(void)
   for (li = 0; li < 4; li++) {
 
     size_t max_name_width = cs_log_strlen(_("field"));
-    int loc_id = m_l[li];
-    int have_weight = 0;
-    double total_weight = -1;
-    cs_gnum_t n_g_elts = 0;
+    int loc_id = _field_log_locations[li];
+    int loc_log_start = log_count;
     cs_real_t *gather_array = NULL; /* only if CS_MESH_LOCATION_VERTICES */
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(loc_id);
     const cs_lnum_t _n_elts = n_elts[0];
     const cs_real_t *weight = NULL;
+    const bool have_weight = (w->total_weight[loc_id] >= 0);
+
+    if (w->n_g_elts[loc_id] == 0)
+      continue;
 
     if (mq != NULL) {
       switch(loc_id) {
       case CS_MESH_LOCATION_CELLS:
-        n_g_elts = m->n_g_cells;
         weight = mq->cell_vol;
-        have_weight = 1;
-        total_weight = mq->tot_vol;
         break;
       case CS_MESH_LOCATION_INTERIOR_FACES:
-        n_g_elts = m->n_g_i_faces;
         weight = mq->i_face_surf;
-        cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
-        have_weight = 1;
         break;
       case CS_MESH_LOCATION_BOUNDARY_FACES:
-        n_g_elts = m->n_g_b_faces;
         weight = mq->b_face_surf;
-        cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
-        have_weight = 1;
         break;
       case CS_MESH_LOCATION_VERTICES:
-        n_g_elts = m->n_g_vertices;
-        have_weight = 0;
         BFT_MALLOC(gather_array, m->n_vertices, cs_real_t);
         break;
       default:
-        n_g_elts = _n_elts;
-        cs_parall_counter(&n_g_elts, 1);
         break;
       }
     }
 
-    if (n_g_elts == 0)
-      continue;
-
-    /* First loop on fields */
-
-    log_count = 0;
+    /* Loop on fields */
 
     for (f_id = 0; f_id < n_fields; f_id++) {
 
@@ -619,19 +816,15 @@ _log_fields(void)
 
       const cs_field_t  *f = cs_field_by_id(f_id);
 
-      if (f->location_id != loc_id || ! (cs_field_get_key_int(f, log_key_id))) {
-        log_id[f_id] = -1;
+      if (f->location_id != loc_id || ! (cs_field_get_key_int(f, log_key_id)))
         continue;
-      }
 
       /* Only log active moments */
 
       if (moment_id != NULL) {
         if (moment_id[f_id] > -1) {
-          if (!cs_time_moment_is_active(moment_id[f_id])) {
-            log_id[f_id] = -1;
+          if (!cs_time_moment_is_active(moment_id[f_id]))
             continue;
-          }
         }
       }
 
@@ -695,10 +888,8 @@ _log_fields(void)
                                        vmax + log_count,
                                        vsum + log_count);
 
-        if (have_weight) {
-          for (c_id = 0; c_id < _dim; c_id++)
-            wsum[log_count + c_id] = 0.;
-        }
+        for (c_id = 0; c_id < _dim; c_id++)
+          wsum[log_count + c_id] = 0.;
       }
 
       log_count += _dim;
@@ -715,29 +906,64 @@ _log_fields(void)
 
       max_name_width = CS_MAX(max_name_width, l_name_width);
 
-    } /* End of first loop on fields */
+    } /* End of loop on fields */
 
     if (gather_array != NULL)
       BFT_FREE(gather_array);
 
-    if (log_count < 1)
-      continue;
+    w->f_loc_count[li] = log_count - loc_log_start;
+    w->f_name_width[li] = CS_MIN(max_name_width, 63);
 
-    /* Group MPI operations if required */
+  } /* End of loop on mesh locations */
 
-    cs_parall_min(log_count, CS_DOUBLE, vmin);
-    cs_parall_max(log_count, CS_DOUBLE, vmax);
-    cs_parall_sum(log_count, CS_DOUBLE, vsum);
+  w->f_count = log_count;
+  w->f_log_id = log_id;
+  w->f_moment_id = moment_id;
+  w->f_vmin = vmin;
+  w->f_vmax = vmax;
+  w->f_vsum = vsum;
+  w->f_wsum = wsum;
+
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, log_count, CS_DOUBLE, vmin);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, log_count, CS_DOUBLE, vmax);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, log_count, CS_DOUBLE, vsum);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, log_count, CS_DOUBLE, wsum);
+}
+
+/*----------------------------------------------------------------------------
+ * Main logging output of variables.
+ *
+ * parameters:
+ *   w <-- pointer to working values structure, with global values
+ *----------------------------------------------------------------------------*/
 
-#   if defined(HAVE_MPI)
-    cs_parall_counter_max(&have_weight, 1);
-    if (have_weight)
-      cs_parall_sum(log_count, CS_DOUBLE, wsum);
-#   endif
+static void
+_log_fields(const cs_log_work_t  *w)
+{
+  int f_id, li;
 
-    /* Print headers */
+  int fpe_flag = 0;
+
+  char tmp_s[5][64] =  {"", "", "", "", ""};
+
+  const char _underline[] = "---------------------------------";
+  const int n_fields = cs_field_n_fields();
+  const int label_key_id = cs_field_key_id("label");
+
+  /* Loop on locations */
+
+  for (li = 0; li < 4; li++) {
 
-    max_name_width = CS_MIN(max_name_width, 63);
+    int loc_id = _field_log_locations[li];
+    const cs_gnum_t n_g_elts = w->n_g_elts[loc_id];
+    const double total_weight = w->total_weight[loc_id];
+    const bool have_weight = (total_weight >= 0);
+    const size_t max_name_width = w->f_name_width[li];
+
+    if (n_g_elts == 0 || w->f_loc_count[li] < 1)
+      continue;
+
+    /* Print headers */
 
     const char *loc_name = _(cs_mesh_location_get_name(loc_id));
     size_t loc_name_w = cs_log_strlen(loc_name);
@@ -784,21 +1010,18 @@ _log_fields(void)
                     "-  %s  %s  %s  %s\n",
                     tmp_s[0], tmp_s[1], tmp_s[2], tmp_s[3]);
 
-    /* Second loop on fields */
-
-    log_count = 0;
+    /* Loop on fields */
 
     for (f_id = 0; f_id < n_fields; f_id++) {
 
-      int _dim;
-      if (log_id[f_id] < 0)
+      const int log_id = w->f_log_id[f_id];
+      if (log_id < 0)
         continue;
 
       const cs_field_t  *f = cs_field_by_id(f_id);
 
-      /* Position in log */
-
-      _dim = (f->dim == 3) ? 4 : f->dim;
+      if (f->location_id != loc_id)
+        continue;
 
       const char *name = cs_field_get_key_str(f, label_key_id);
       if (name == NULL)
@@ -809,8 +1032,8 @@ _log_fields(void)
         t_weight = total_weight;
 
       char prefix[] = "v  ";
-      if (moment_id != NULL) {
-        if (moment_id[f_id] > -1)
+      if (w->f_moment_id != NULL) {
+        if (w->f_moment_id[f_id] > -1)
           prefix[0] = 'm';
       }
       if (f->type & CS_FIELD_ACCUMULATOR)
@@ -822,14 +1045,12 @@ _log_fields(void)
                       f->dim,
                       n_g_elts,
                       t_weight,
-                      vmin + log_count,
-                      vmax + log_count,
-                      vsum + log_count,
-                      wsum + log_count,
+                      w->f_vmin + log_id,
+                      w->f_vmax + log_id,
+                      w->f_vsum + log_id,
+                      w->f_wsum + log_id,
                       &fpe_flag);
 
-      log_count += _dim;
-
     } /* End of loop on fields */
 
   } /* End of loop on mesh locations */
@@ -839,55 +1060,26 @@ _log_fields(void)
     bft_error(__FILE__, __LINE__, 0,
                 _("Invalid (not-a-number) values detected for a field."));
 
-  BFT_FREE(moment_id);
-  BFT_FREE(wsum);
-  BFT_FREE(vsum);
-  BFT_FREE(vmax);
-  BFT_FREE(vmin);
-  BFT_FREE(log_id);
-
   cs_log_printf(CS_LOG_DEFAULT, "\n");
 }
 
 /*----------------------------------------------------------------------------
  * Main logging output of additional simple statistics
+ *
+ * parameters:
+ *   w <-- pointer to working values structure, with global values
  *----------------------------------------------------------------------------*/
 
 static void
-_log_sstats(void)
+_log_sstats(const cs_log_work_t  *w)
 {
   int     stat_id;
   int     fpe_flag = 0;
-  double _boundary_surf = -1;
-  double _interior_surf = -1;
-  double  *vmin = NULL, *vmax = NULL, *vsum = NULL, *wsum = NULL;
 
   char tmp_s[5][64] =  {"", "", "", "", ""};
 
   const char _underline[] = "---------------------------------";
 
-  const cs_mesh_t *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-
-  /* Allocate working arrays */
-
-  BFT_MALLOC(vmin, _sstats_val_size, double);
-  BFT_MALLOC(vmax, _sstats_val_size, double);
-  BFT_MALLOC(vsum, _sstats_val_size, double);
-  BFT_MALLOC(wsum, _sstats_val_size, double);
-
-  memcpy(vmin, _sstats_vmin, _sstats_val_size*sizeof(double));
-  memcpy(vmax, _sstats_vmax, _sstats_val_size*sizeof(double));
-  memcpy(vsum, _sstats_vsum, _sstats_val_size*sizeof(double));
-  memcpy(wsum, _sstats_wsum, _sstats_val_size*sizeof(double));
-
-  /* Group MPI operations if required */
-
-  cs_parall_min(_sstats_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_sstats_val_size, CS_DOUBLE, vmax);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, vsum);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, wsum);
-
   /* Loop on statistics */
 
   int sstat_cat_start = 0;
@@ -931,56 +1123,12 @@ _log_sstats(void)
       if (n_loc_stats == 0)
         continue;
 
-      cs_gnum_t n_g_elts = 0;
-      int have_weight = 0;
-      double total_weight = -1;
-      const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(loc_id);;
-      const cs_lnum_t _n_elts = n_elts[0];
-      const cs_real_t *weight = NULL;
+      const cs_gnum_t n_g_elts = w->n_g_elts[loc_id];
+      const double total_weight = w->total_weight[loc_id];
+      const int have_weight = (total_weight >= 0) ? 1 : 0;
       const char *loc_name = _(cs_mesh_location_get_name(loc_id));
       size_t loc_name_w = cs_log_strlen(loc_name);
 
-      if (mq != NULL) {
-        switch(loc_id) {
-        case CS_MESH_LOCATION_CELLS:
-          n_g_elts = m->n_g_cells;
-          weight = mq->cell_vol;
-          have_weight = 1;
-          total_weight = mq->tot_vol;
-          break;
-        case CS_MESH_LOCATION_INTERIOR_FACES:
-          n_g_elts = m->n_g_i_faces;
-          weight = mq->i_face_surf;
-          if (_interior_surf < 0) {
-            cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &_interior_surf);
-            cs_parall_sum(1, CS_DOUBLE, &_interior_surf);
-            if (_interior_surf < 0) _interior_surf = 0; /* just to be safe */
-          }
-          total_weight = _interior_surf;
-          have_weight = 1;
-          break;
-        case CS_MESH_LOCATION_BOUNDARY_FACES:
-          n_g_elts = m->n_g_b_faces;
-          weight = mq->b_face_surf;
-          if (_boundary_surf < 0) {
-            cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &_boundary_surf);
-            cs_parall_sum(1, CS_DOUBLE, &_boundary_surf);
-            if (_boundary_surf < 0) _boundary_surf = 0; /* just to be safe */
-          }
-          total_weight = _boundary_surf;
-          have_weight = 1;
-          break;
-        case CS_MESH_LOCATION_VERTICES:
-          n_g_elts = m->n_g_vertices;
-          have_weight = 0;
-          break;
-        default:
-          n_g_elts = _n_elts;
-          cs_parall_counter(&n_g_elts, 1);
-          break;
-        }
-      }
-
       for (stat_id = sstat_cat_start; stat_id < sstat_cat_end; stat_id++) {
         if (_sstats[stat_id].loc_id == loc_id) {
           const char *stat_name
@@ -1053,10 +1201,10 @@ _log_sstats(void)
                         _sstats[stat_id].dim,
                         n_g_elts,
                         t_weight,
-                        vmin + stat_id,
-                        vmax + stat_id,
-                        vsum + stat_id,
-                        wsum + stat_id,
+                        w->s_vmin + stat_id,
+                        w->s_vmax + stat_id,
+                        w->s_vsum + stat_id,
+                        w->s_wsum + stat_id,
                         &fpe_flag);
 
       } /* End of loop on stats */
@@ -1072,11 +1220,6 @@ _log_sstats(void)
     bft_error(__FILE__, __LINE__, 0,
                 _("Invalid (not-a-number) values detected for a statistic."));
 
-  BFT_FREE(wsum);
-  BFT_FREE(vsum);
-  BFT_FREE(vmax);
-  BFT_FREE(vmin);
-
   cs_log_printf(CS_LOG_DEFAULT, "\n");
 }
 
@@ -1195,15 +1338,18 @@ _add_clipping(int               name_id,
 
 /*----------------------------------------------------------------------------
  * Main logging output of additional clippings
+ *
+ * parameters:
+ *   w <-- pointer to working values structure, with global values
  *----------------------------------------------------------------------------*/
 
 static void
-_log_clips(void)
+_log_clips(const cs_log_work_t  *w)
 {
   int     clip_id;
   int     type_idx[] = {0, 0, 0};
-  double  *vmin = NULL, *vmax = NULL;
-  cs_gnum_t  *vcount = NULL;
+  double  *vmin = w->c_vmin, *vmax = w->c_vmax;
+  cs_gnum_t  *vcount = w->c_count;
   size_t max_name_width = cs_log_strlen(_("field"));
   const int label_key_id = cs_field_key_id("label");
 
@@ -1212,22 +1358,6 @@ _log_clips(void)
   const char *_cat_name[] = {N_("field"), N_("value")};
   const char *_cat_prefix[] = {"a  ", "a   "};
 
-  /* Allocate working arrays */
-
-  BFT_MALLOC(vmin, _clips_val_size, double);
-  BFT_MALLOC(vmax, _clips_val_size, double);
-  BFT_MALLOC(vcount, _clips_val_size*2, cs_gnum_t);
-
-  memcpy(vmin, _clips_vmin, _clips_val_size*sizeof(double));
-  memcpy(vmax, _clips_vmax, _clips_val_size*sizeof(double));
-  memcpy(vcount, _clips_count, _clips_val_size*sizeof(cs_gnum_t)*2);
-
-  /* Group MPI operations if required */
-
-  cs_parall_min(_clips_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_clips_val_size, CS_DOUBLE, vmax);
-  cs_parall_sum(_clips_val_size*2, CS_GNUM_TYPE, vcount);
-
   /* Fist loop on clippings for counting */
 
   for (clip_id = 0; clip_id < _n_clips; clip_id++) {
@@ -1348,10 +1478,6 @@ _log_clips(void)
 
   }
 
-  BFT_FREE(vcount);
-  BFT_FREE(vmax);
-  BFT_FREE(vmin);
-
   cs_log_printf(CS_LOG_DEFAULT, "\n");
 }
 
@@ -1403,6 +1529,8 @@ cs_log_iteration_destroy_all(void)
 
   if (_l2_residual_plot != NULL)
     cs_time_plot_finalize(&_l2_residual_plot);
+
+  cs_parall_reduce_destroy(&_log_reduce);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1414,13 +1542,32 @@ cs_log_iteration_destroy_all(void)
 void
 cs_log_iteration(void)
 {
+  cs_log_work_t  w;
+
+  /* Compute local values; global reductions are grouped in a single
+     collective operation. All global values are needed by the following
+     output, so there is no local work to overlap with the reduction. */
+
+  if (_log_reduce == NULL)
+    _log_reduce = cs_parall_reduce_create();
+
+  _log_work_init(&w, _log_reduce);
+  _log_fields_compute(&w, _log_reduce);
+
+  cs_parall_reduce_start(_log_reduce);
+  cs_parall_reduce_finish(_log_reduce);
+
+  /* Output */
+
   if (_n_clips > 0)
-    _log_clips();
+    _log_clips(&w);
 
-  _log_fields();
+  _log_fields(&w);
 
   if (_n_sstats > 0)
-    _log_sstats();
+    _log_sstats(&w);
+
+  _log_work_free(&w);
 
   cs_time_moment_log_iteration();
   cs_lagr_stat_log_iteration();
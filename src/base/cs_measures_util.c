@@ -51,6 +51,8 @@
 #include "bft_printf.h"
 #include "bft_mem.h"
 
+#include "fvm_box.h"
+#include "fvm_box_tree.h"
 #include "fvm_nodal.h"
 #include "fvm_point_location.h"
 
@@ -233,6 +235,10 @@ cs_interpol_field_on_grid(cs_interpol_grid_t         *ig,
 /*----------------------------------------------------------------------------
  * Compute a Cressman interpolation on the global mesh.
  *
+ * Measures only contribute to elements inside their influence box
+ * (beyond which their weight is set to 0), so a box tree built on these
+ * boxes is used to restrict the sum to contributing measures.
+ *
  * parameters:
  *   ms                   <-- pointer to the measures set structure
  *                            (values to interpolate)
@@ -249,10 +255,15 @@ cs_cressman_interpol(cs_measures_set_t         *ms,
                      int                        id_type)
 {
   cs_lnum_t n_elts = 0;
-  cs_real_t *xyz_cen;
+  cs_real_t *xyz_cen = NULL;
   const cs_mesh_t *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t *mesh_quantities = cs_glob_mesh_quantities;
 
+  /* Weights are set to 0 beyond r2/4 = 700; the matching half-width
+     along each axis is slightly enlarged to be safe with rounding */
+
+  const cs_real_t r_max = sqrt(2800.) * (1. + 1.e-10);
+
   if (id_type == 1) {
     n_elts = mesh->n_cells;
     xyz_cen = mesh_quantities->cell_cen;
@@ -262,28 +273,143 @@ cs_cressman_interpol(cs_measures_set_t         *ms,
     xyz_cen = mesh_quantities->b_face_cog;
   }
 
-# pragma omp parallel for
+  if (n_elts < 1)
+    return;
+
+  /* Local extents of interpolation points */
+
+  cs_coord_t l_min[3], l_max[3], eps = 0.;
+
+  for (int k = 0; k < 3; k++) {
+    l_min[k] = xyz_cen[k];
+    l_max[k] = xyz_cen[k];
+  }
+  for (cs_lnum_t ii = 1; ii < n_elts; ii++) {
+    for (int k = 0; k < 3; k++) {
+      l_min[k] = CS_MIN(l_min[k], xyz_cen[ii*3 + k]);
+      l_max[k] = CS_MAX(l_max[k], xyz_cen[ii*3 + k]);
+    }
+  }
+  for (int k = 0; k < 3; k++)
+    eps = CS_MAX(eps, l_max[k] - l_min[k]);
+  eps = CS_MAX(eps*1.e-6, 1.e-12);
+
+  for (int k = 0; k < 3; k++) {
+    l_min[k] -= eps;
+    l_max[k] += eps;
+  }
+
+  /* Influence boxes of Cressman measures, clipped to local extents;
+     a zero inverse radius means an unbounded influence along that axis */
+
+  cs_lnum_t n_boxes = 0;
+  cs_lnum_t *m_ids = NULL;
+  cs_gnum_t *box_gnum = NULL;
+  cs_coord_t *extents = NULL;
+
+  BFT_MALLOC(m_ids, ms->nb_measures, cs_lnum_t);
+  BFT_MALLOC(box_gnum, ms->nb_measures, cs_gnum_t);
+  BFT_MALLOC(extents, ms->nb_measures*6, cs_coord_t);
+
+  for (cs_lnum_t jj = 0; jj < ms->nb_measures; jj++) {
+
+    if (ms->is_cressman[jj] != 1)
+      continue;
+
+    cs_coord_t *b_min = extents + n_boxes*6;
+    cs_coord_t *b_max = b_min + 3;
+    int k;
+
+    for (k = 0; k < 3; k++) {
+      b_min[k] = l_min[k];
+      b_max[k] = l_max[k];
+      if (CS_ABS(ms->inf_radius[jj*3 + k]) > 0.) {
+        cs_real_t r = r_max / CS_ABS(ms->inf_radius[jj*3 + k]);
+        b_min[k] = CS_MAX(b_min[k], ms->coords[jj*3 + k] - r);
+        b_max[k] = CS_MIN(b_max[k], ms->coords[jj*3 + k] + r);
+      }
+      if (b_max[k] <= b_min[k])
+        break;
+    }
+
+    if (k == 3) {
+      m_ids[n_boxes] = jj;
+      box_gnum[n_boxes] = n_boxes + 1;
+      n_boxes++;
+    }
+
+  }
+
+  /* Build box tree and find contributing measures for each element */
+
+  cs_lnum_t *elt_index = NULL, *elt_box_ids = NULL;
+
+  if (n_boxes > 0) {
+
+#if defined(HAVE_MPI)
+    fvm_box_set_t *boxes = fvm_box_set_create(3,
+                                              1,  /* normalize */
+                                              0,  /* allow_projection */
+                                              n_boxes,
+                                              box_gnum,
+                                              extents,
+                                              MPI_COMM_NULL);
+#else
+    fvm_box_set_t *boxes = fvm_box_set_create(3,
+                                              1,  /* normalize */
+                                              0,  /* allow_projection */
+                                              n_boxes,
+                                              box_gnum,
+                                              extents);
+#endif
+
+    fvm_box_tree_t *bt = fvm_box_tree_create(30,    /* max_level */
+                                             30,    /* threshold */
+                                             10.);  /* max_box_ratio */
+
+    fvm_box_tree_set_boxes(bt, boxes, FVM_BOX_TREE_ASYNC_LEVEL);
+
+    fvm_box_tree_get_point_intersects(bt,
+                                      boxes,
+                                      n_elts,
+                                      xyz_cen,
+                                      &elt_index,
+                                      &elt_box_ids);
+
+    fvm_box_tree_destroy(&bt);
+    fvm_box_set_destroy(&boxes);
+
+  }
+
+  BFT_FREE(extents);
+  BFT_FREE(box_gnum);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
     cs_real_t total_weight = 0.;
     cs_real_t interpolated_value = 0.;
-    for (cs_lnum_t jj = 0; jj < ms->nb_measures; jj++) {
-      if (ms->is_cressman[jj] == 1) {
-        cs_real_t dist_x = (xyz_cen[ii*3   ] - ms->coords[jj*3   ])
-                          *ms->inf_radius[jj*3   ];
-        cs_real_t dist_y = (xyz_cen[ii*3 +1] - ms->coords[jj*3 +1])
-                          *ms->inf_radius[jj*3 +1];
-        cs_real_t dist_z = (xyz_cen[ii*3 +2] - ms->coords[jj*3 +2])
-                          *ms->inf_radius[jj*3 +2];
-
-        cs_real_t r2 = dist_x*dist_x + dist_y*dist_y + dist_z*dist_z;
-
-        cs_real_t weight = 0.;
-        if (r2/4. <= 700.)
-          weight = exp(-r2/4.);
-
-        total_weight += weight;
-        interpolated_value += (ms->measures[jj])*weight;
-      }
+    cs_lnum_t s_id = 0, e_id = 0;
+    if (elt_index != NULL) {
+      s_id = elt_index[ii];
+      e_id = elt_index[ii+1];
+    }
+    for (cs_lnum_t kk = s_id; kk < e_id; kk++) {
+      cs_lnum_t jj = m_ids[elt_box_ids[kk]];
+      cs_real_t dist_x = (xyz_cen[ii*3   ] - ms->coords[jj*3   ])
+                        *ms->inf_radius[jj*3   ];
+      cs_real_t dist_y = (xyz_cen[ii*3 +1] - ms->coords[jj*3 +1])
+                        *ms->inf_radius[jj*3 +1];
+      cs_real_t dist_z = (xyz_cen[ii*3 +2] - ms->coords[jj*3 +2])
+                        *ms->inf_radius[jj*3 +2];
+
+      cs_real_t r2 = dist_x*dist_x + dist_y*dist_y + dist_z*dist_z;
+
+      cs_real_t weight = 0.;
+      if (r2/4. <= 700.)
+        weight = exp(-r2/4.);
+
+      total_weight += weight;
+      interpolated_value += (ms->measures[jj])*weight;
     }
 
     if (total_weight > 0.)
@@ -292,6 +418,9 @@ cs_cressman_interpol(cs_measures_set_t         *ms,
       interpolated_values[ii] = 0.;
   }
 
+  BFT_FREE(elt_index);
+  BFT_FREE(elt_box_ids);
+  BFT_FREE(m_ids);
 }
 
 /*----------------------------------------------------------------------------
@@ -80,6 +80,39 @@ const char  *cs_numbering_type_name[] = {N_("default"),
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute the range of elements assigned to a thread by a static schedule
+ * (as used by "omp parallel for" loops without a schedule clause by
+ * common OpenMP implementations).
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   t_id      <-- thread id
+ *   n_t       <-- number of threads
+ *   s_id      --> start id for this thread
+ *   e_id      --> past-the-end id for this thread
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_static_thread_range(cs_lnum_t   n,
+                     int         t_id,
+                     int         n_t,
+                     cs_lnum_t  *s_id,
+                     cs_lnum_t  *e_id)
+{
+  cs_lnum_t q = n / n_t;
+  cs_lnum_t r = n % n_t;
+
+  if (t_id < r) {
+    *s_id = t_id*(q+1);
+    *e_id = *s_id + q + 1;
+  }
+  else {
+    *s_id = t_id*q + r;
+    *e_id = *s_id + q;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Return number of elements in a given thread exclusion group
  *
@@ -644,6 +677,138 @@ cs_numbering_destroy(cs_numbering_t  **numbering)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize (zero) an array so that its memory is first touched
+ *        by the threads which will later operate on it.
+ *
+ * With a first-touch memory placement policy, memory pages are mapped to
+ * the NUMA domain of the thread which first writes to them. This function
+ * should thus be called just after allocating arrays which are later
+ * handled by threaded loops, so as to use the same thread partitioning.
+ *
+ * For a threaded numbering, elements are touched by the thread to which
+ * they are assigned in each group; otherwise, and for elements beyond
+ * those covered by the numbering (such as ghost cells), a static
+ * partitioning is used, matching that of threaded loops without a
+ * schedule clause.
+ *
+ * \param[in]       numbering  pointer to cs_numbering_t structure, or NULL
+ * \param[in]       n_elts     number of elements
+ * \param[in]       elt_size   size of values associated with an element
+ *                             (in bytes)
+ * \param[in, out]  a          array to initialize (size: n_elts*elt_size)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch(const cs_numbering_t  *numbering,
+                         cs_lnum_t              n_elts,
+                         size_t                 elt_size,
+                         void                  *a)
+{
+  if (a == NULL || n_elts < 1)
+    return;
+
+  unsigned char *_a = a;
+  cs_lnum_t n_num_elts = 0;
+
+  /* Elements covered by a threaded numbering */
+
+  if (numbering != NULL && numbering->type == CS_NUMBERING_THREADS) {
+
+    const int n_threads = numbering->n_threads;
+    const int n_groups = numbering->n_groups;
+    const cs_lnum_t *group_index = numbering->group_index;
+
+    for (int i = 0; i < n_threads*n_groups; i++) {
+      if (group_index[i*2 + 1] > n_num_elts)
+        n_num_elts = group_index[i*2 + 1];
+    }
+    if (n_num_elts > n_elts)
+      n_num_elts = n_elts;
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_threads; t_id++) {
+      for (int g_id = 0; g_id < n_groups; g_id++) {
+        cs_lnum_t s_id = group_index[(t_id*n_groups + g_id)*2];
+        cs_lnum_t e_id = group_index[(t_id*n_groups + g_id)*2 + 1];
+        if (e_id > n_num_elts)
+          e_id = n_num_elts;
+        if (e_id > s_id)
+          memset(_a + s_id*elt_size, 0, (e_id - s_id)*elt_size);
+      }
+    }
+
+  }
+
+  /* Other elements */
+
+  const cs_lnum_t n = n_elts - n_num_elts;
+
+  if (n < 1)
+    return;
+
+  _a += n_num_elts*elt_size;
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    int t_id = 0, n_t = 1;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+    n_t = omp_get_num_threads();
+#endif
+    cs_lnum_t s_id, e_id;
+    _static_thread_range(n, t_id, n_t, &s_id, &e_id);
+    if (e_id > s_id)
+      memset(_a + s_id*elt_size, 0, (e_id - s_id)*elt_size);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize (zero) an indexed array so that its memory is first
+ *        touched by the threads which will later operate on it.
+ *
+ * Values associated with element i are in the range
+ * [index[i], index[i+1]) of the array, and elements are partitioned among
+ * threads in the same manner as threaded loops without a schedule clause
+ * (this is the case for the rows of CSR or MSR matrices).
+ *
+ * \param[in]       n_elts    number of elements
+ * \param[in]       index     values index (size: n_elts + 1)
+ * \param[in]       val_size  size of each value (in bytes)
+ * \param[in, out]  a         array to initialize (size: index[n_elts])
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch_indexed(cs_lnum_t        n_elts,
+                                 const cs_lnum_t  index[],
+                                 size_t           val_size,
+                                 void            *a)
+{
+  if (a == NULL || n_elts < 1)
+    return;
+
+  unsigned char *_a = a;
+
+# pragma omp parallel if (n_elts > CS_THR_MIN)
+  {
+    int t_id = 0, n_t = 1;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+    n_t = omp_get_num_threads();
+#endif
+    cs_lnum_t s_id, e_id;
+    _static_thread_range(n_elts, t_id, n_t, &s_id, &e_id);
+    if (e_id > s_id)
+      memset(_a + index[s_id]*val_size,
+             0,
+             (index[e_id] - index[s_id])*val_size);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log information relative to a cs_numbering_t structure.
@@ -183,6 +183,59 @@ cs_numbering_create_threaded(int        n_threads,
 void
 cs_numbering_destroy(cs_numbering_t  **numbering);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize (zero) an array so that its memory is first touched
+ *        by the threads which will later operate on it.
+ *
+ * With a first-touch memory placement policy, memory pages are mapped to
+ * the NUMA domain of the thread which first writes to them. This function
+ * should thus be called just after allocating arrays which are later
+ * handled by threaded loops, so as to use the same thread partitioning.
+ *
+ * For a threaded numbering, elements are touched by the thread to which
+ * they are assigned in each group; otherwise, and for elements beyond
+ * those covered by the numbering (such as ghost cells), a static
+ * partitioning is used, matching that of threaded loops without a
+ * schedule clause.
+ *
+ * \param[in]       numbering  pointer to cs_numbering_t structure, or NULL
+ * \param[in]       n_elts     number of elements
+ * \param[in]       elt_size   size of values associated with an element
+ *                             (in bytes)
+ * \param[in, out]  a          array to initialize (size: n_elts*elt_size)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch(const cs_numbering_t  *numbering,
+                         cs_lnum_t              n_elts,
+                         size_t                 elt_size,
+                         void                  *a);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize (zero) an indexed array so that its memory is first
+ *        touched by the threads which will later operate on it.
+ *
+ * Values associated with element i are in the range
+ * [index[i], index[i+1]) of the array, and elements are partitioned among
+ * threads in the same manner as threaded loops without a schedule clause
+ * (this is the case for the rows of CSR or MSR matrices).
+ *
+ * \param[in]       n_elts    number of elements
+ * \param[in]       index     values index (size: n_elts + 1)
+ * \param[in]       val_size  size of each value (in bytes)
+ * \param[in, out]  a         array to initialize (size: index[n_elts])
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_numbering_first_touch_indexed(cs_lnum_t        n_elts,
+                                 const cs_lnum_t  index[],
+                                 size_t           val_size,
+                                 void            *a);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log information relative to a cs_numbering_t structure.
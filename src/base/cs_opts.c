@@ -118,7 +118,11 @@ _arg_env_help(const char  *name)
   fprintf
     (e, _(" --benchmark       elementary operations performance\n"
           "                   [--mpitrace] operations done only once\n"
-          "                                for light MPI traces\n"));
+          "                                for light MPI traces\n"
+          "                   [--extended] also time halo exchanges,\n"
+          "                                gradients, face loops, linear\n"
+          "                                solvers and I/O, and write\n"
+          "                                results to benchmark.csv/json\n"));
   fprintf
     (e, _(" -h, --help        this help message\n\n"));
 
@@ -255,6 +259,7 @@ cs_opts_define(int         argc,
   opts->preprocess = false;
   opts->verif = false;
   opts->benchmark = 0;
+  opts->benchmark_extended = false;
 
   opts->yacs_module = NULL;
 
@@ -274,11 +279,14 @@ cs_opts_define(int         argc,
 
     else if (strcmp(s, "--benchmark") == 0) {
       opts->benchmark = 1;
-      if (arg_id + 1 < argc) {
-        if (strcmp(argv[arg_id + 1], "--mpitrace") == 0) {
+      while (arg_id + 1 < argc) {
+        if (strcmp(argv[arg_id + 1], "--mpitrace") == 0)
           opts->benchmark = 2;
-          arg_id++;
-        }
+        else if (strcmp(argv[arg_id + 1], "--extended") == 0)
+          opts->benchmark_extended = true;
+        else
+          break;
+        arg_id++;
       }
     }
 
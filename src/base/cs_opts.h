@@ -75,6 +75,7 @@ typedef struct {
                                    0: not used;
                                    1: timing (CPU + Walltime) mode
                                    2: MPI trace-friendly mode */
+  bool           benchmark_extended;  /* Extended benchmark mode */
 
   /* Connection with YACS */
 
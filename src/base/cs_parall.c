@@ -41,6 +41,9 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -141,6 +144,40 @@ typedef struct
   int     rank;
 } _mpi_double_int_t;
 
+/* Values registered for an aggregated reduction */
+
+typedef struct {
+
+  cs_parall_reduce_op_t   op;        /* reduction operation */
+  cs_datatype_t           datatype;  /* matching Code_Saturne datatype */
+  int                     n;         /* number of values */
+  void                   *val;       /* local values in, global values out */
+
+} _reduce_array_t;
+
+/* Aggregated reduction structure */
+
+struct _cs_parall_reduce_t {
+
+  int               n_arrays;      /* number of registered arrays */
+  int               n_arrays_max;  /* size of arrays */
+  int               n_vals;        /* total number of registered values */
+  int               n_vals_max;    /* size of buffer (in value pairs) */
+
+  _reduce_array_t  *arrays;        /* registered arrays */
+  double           *buffer;        /* packed (value, operation) pairs,
+                                      local then global */
+
+  bool              active;        /* reduction started and not finished */
+
+#if defined(HAVE_MPI)
+  MPI_Datatype      pair_type;     /* (value, operation) pair datatype */
+  MPI_Op            mpi_op;        /* associated reduction operation */
+  MPI_Request       request;       /* request for non-blocking reduction */
+#endif
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -264,6 +301,141 @@ _cs_parall_allreduce(int             n,
 
 #endif
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Convert a value of a given datatype to a double.
+ *
+ * parameters:
+ *   datatype <-- matching Code_Saturne datatype
+ *   val      <-- pointer to array of values
+ *   i        <-- index of value in array
+ *
+ * returns:
+ *   value converted to double
+ *----------------------------------------------------------------------------*/
+
+static double
+_reduce_val_to_double(cs_datatype_t   datatype,
+                      const void     *val,
+                      int             i)
+{
+  double retval = 0.;
+
+  switch(datatype) {
+  case CS_FLOAT:
+    retval = ((const float *)val)[i];
+    break;
+  case CS_DOUBLE:
+    retval = ((const double *)val)[i];
+    break;
+  case CS_INT32:
+    retval = ((const int32_t *)val)[i];
+    break;
+  case CS_INT64:
+    retval = ((const int64_t *)val)[i];
+    break;
+  case CS_UINT32:
+    retval = ((const uint32_t *)val)[i];
+    break;
+  case CS_UINT64:
+    retval = ((const uint64_t *)val)[i];
+    break;
+  default:
+    assert(0);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Convert a double to a value of a given datatype.
+ *
+ * parameters:
+ *   datatype <-- matching Code_Saturne datatype
+ *   d        <-- value to convert
+ *   val      <-> pointer to array of values
+ *   i        <-- index of value in array
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_val_from_double(cs_datatype_t   datatype,
+                        double          d,
+                        void           *val,
+                        int             i)
+{
+  switch(datatype) {
+  case CS_FLOAT:
+    ((float *)val)[i] = d;
+    break;
+  case CS_DOUBLE:
+    ((double *)val)[i] = d;
+    break;
+  case CS_INT32:
+    ((int32_t *)val)[i] = d;
+    break;
+  case CS_INT64:
+    ((int64_t *)val)[i] = d;
+    break;
+  case CS_UINT32:
+    ((uint32_t *)val)[i] = d;
+    break;
+  case CS_UINT64:
+    ((uint64_t *)val)[i] = d;
+    break;
+  default:
+    assert(0);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * MPI reduction operation for (value, operation) pairs.
+ *
+ * Each pair carries its own operation, so that sums, minima and maxima
+ * may be combined in a single reduction, even if the MPI library splits
+ * the buffer into several segments.
+ *
+ * parameters:
+ *   in       <-- input pairs
+ *   inout    <-> input and output pairs
+ *   len      <-- number of pairs
+ *   datatype <-- associated MPI datatype
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_pairs(void          *in,
+              void          *inout,
+              int           *len,
+              MPI_Datatype  *datatype)
+{
+  CS_UNUSED(datatype);
+
+  const double *a = in;
+  double *b = inout;
+
+  for (int i = 0; i < *len; i++) {
+    const double v = a[i*2];
+    const int op = a[i*2 + 1];
+    switch(op) {
+    case CS_PARALL_REDUCE_SUM:
+      b[i*2] += v;
+      break;
+    case CS_PARALL_REDUCE_MIN:
+      if (v < b[i*2])
+        b[i*2] = v;
+      break;
+    case CS_PARALL_REDUCE_MAX:
+      if (v > b[i*2])
+        b[i*2] = v;
+      break;
+    default:
+      assert(0);
+    }
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -943,6 +1115,250 @@ cs_parall_allgather_r(int        n_elts,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a structure for aggregated global reductions.
+ *
+ * Values registered with \ref cs_parall_reduce_add are packed in a single
+ * buffer, so that a single (non-blocking if possible) global reduction
+ * is used for all of them, whatever their datatype and operation.
+ *
+ * \return  pointer to new aggregated reduction structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_reduce_t *
+cs_parall_reduce_create(void)
+{
+  cs_parall_reduce_t  *r = NULL;
+
+  BFT_MALLOC(r, 1, cs_parall_reduce_t);
+
+  r->n_arrays = 0;
+  r->n_arrays_max = 0;
+  r->n_vals = 0;
+  r->n_vals_max = 0;
+
+  r->arrays = NULL;
+  r->buffer = NULL;
+
+  r->active = false;
+
+#if defined(HAVE_MPI)
+  r->pair_type = MPI_DATATYPE_NULL;
+  r->mpi_op = MPI_OP_NULL;
+  r->request = MPI_REQUEST_NULL;
+#endif
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy an aggregated global reductions structure.
+ *
+ * If a reduction is still active, it is finished first.
+ *
+ * \param[in, out]  r  pointer to aggregated reduction structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_destroy(cs_parall_reduce_t  **r)
+{
+  cs_parall_reduce_t  *_r = *r;
+
+  if (_r == NULL)
+    return;
+
+  if (_r->active)
+    cs_parall_reduce_finish(_r);
+
+#if defined(HAVE_MPI)
+  if (_r->mpi_op != MPI_OP_NULL)
+    MPI_Op_free(&(_r->mpi_op));
+  if (_r->pair_type != MPI_DATATYPE_NULL)
+    MPI_Type_free(&(_r->pair_type));
+#endif
+
+  BFT_FREE(_r->buffer);
+  BFT_FREE(_r->arrays);
+
+  BFT_FREE(*r);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Register values for an aggregated global reduction.
+ *
+ * Local values are read when \ref cs_parall_reduce_start is called, and
+ * replaced by global values when \ref cs_parall_reduce_finish is called,
+ * so the given array must remain available until then.
+ *
+ * Values are reduced as doubles, so integer values are exact only
+ * up to 2^53, which is sufficient for logging and diagnostics.
+ *
+ * \param[in, out]  r         pointer to aggregated reduction structure
+ * \param[in]       op        reduction operation
+ * \param[in]       n         number of values
+ * \param[in]       datatype  matching Code_Saturne datatype
+ * \param[in, out]  val       local values in, global values out (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_add(cs_parall_reduce_t     *r,
+                     cs_parall_reduce_op_t   op,
+                     int                     n,
+                     cs_datatype_t           datatype,
+                     void                   *val)
+{
+  assert(r != NULL);
+
+  if (r->active)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: values may not be added to a reduction in progress."),
+              __func__);
+
+  if (n < 1)
+    return;
+
+  if (r->n_arrays >= r->n_arrays_max) {
+    r->n_arrays_max = CS_MAX(r->n_arrays_max*2, 8);
+    BFT_REALLOC(r->arrays, r->n_arrays_max, _reduce_array_t);
+  }
+
+  _reduce_array_t *a = r->arrays + r->n_arrays;
+
+  a->op = op;
+  a->datatype = datatype;
+  a->n = n;
+  a->val = val;
+
+  r->n_arrays += 1;
+  r->n_vals += n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start an aggregated global reduction.
+ *
+ * All registered local values are packed, and a single global reduction
+ * is started. It is non-blocking if the MPI library supports MPI-3
+ * non-blocking collectives. Results are available only after
+ * \ref cs_parall_reduce_finish is called.
+ *
+ * \param[in, out]  r  pointer to aggregated reduction structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_start(cs_parall_reduce_t  *r)
+{
+  assert(r != NULL);
+
+  if (r->active)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: a reduction is already in progress."),
+              __func__);
+
+  r->active = true;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks < 2 || r->n_vals < 1)
+    return;
+
+  if (r->n_vals > r->n_vals_max) {
+    r->n_vals_max = CS_MAX(r->n_vals_max*2, r->n_vals);
+    BFT_REALLOC(r->buffer, r->n_vals_max*4, double);
+  }
+
+  int k = 0;
+  for (int i = 0; i < r->n_arrays; i++) {
+    const _reduce_array_t *a = r->arrays + i;
+    for (int j = 0; j < a->n; j++) {
+      r->buffer[k*2] = _reduce_val_to_double(a->datatype, a->val, j);
+      r->buffer[k*2 + 1] = a->op;
+      k++;
+    }
+  }
+
+  if (r->pair_type == MPI_DATATYPE_NULL) {
+    MPI_Type_contiguous(2, MPI_DOUBLE, &(r->pair_type));
+    MPI_Type_commit(&(r->pair_type));
+    MPI_Op_create(_reduce_pairs, true, &(r->mpi_op));
+  }
+
+  double *g_buffer = r->buffer + r->n_vals*2;
+
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  MPI_Iallreduce(r->buffer, g_buffer, r->n_vals, r->pair_type,
+                 r->mpi_op, cs_glob_mpi_comm, &(r->request));
+#else
+  cs_timer_t t0 = cs_timer_time();
+  MPI_Allreduce(r->buffer, g_buffer, r->n_vals, r->pair_type,
+                r->mpi_op, cs_glob_mpi_comm);
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_stats_add_wait(CS_TIMER_STATS_WAIT_REDUCTION, &t0, &t1);
+#endif
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finish an aggregated global reduction.
+ *
+ * Wait for the reduction started by \ref cs_parall_reduce_start to
+ * complete, and copy the global values to the registered arrays.
+ * Registered values are then cleared, so the structure may be reused.
+ *
+ * \param[in, out]  r  pointer to aggregated reduction structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_finish(cs_parall_reduce_t  *r)
+{
+  assert(r != NULL);
+
+  if (! r->active)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: no reduction is in progress."),
+              __func__);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1 && r->n_vals > 0) {
+
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+    cs_timer_t t0 = cs_timer_time();
+    MPI_Wait(&(r->request), MPI_STATUS_IGNORE);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_wait(CS_TIMER_STATS_WAIT_REDUCTION, &t0, &t1);
+#endif
+
+    const double *g_buffer = r->buffer + r->n_vals*2;
+
+    int k = 0;
+    for (int i = 0; i < r->n_arrays; i++) {
+      const _reduce_array_t *a = r->arrays + i;
+      for (int j = 0; j < a->n; j++) {
+        _reduce_val_from_double(a->datatype, g_buffer[k*2], a->val, j);
+        k++;
+      }
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  r->n_arrays = 0;
+  r->n_vals = 0;
+  r->active = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return minimum recommended scatter or gather buffer size.
@@ -37,6 +37,24 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Operation for aggregated global reductions */
+
+typedef enum {
+
+  CS_PARALL_REDUCE_SUM,    /* sum of values */
+  CS_PARALL_REDUCE_MIN,    /* minimum of values */
+  CS_PARALL_REDUCE_MAX     /* maximum of values */
+
+} cs_parall_reduce_op_t;
+
+/* Opaque aggregated global reductions structure */
+
+typedef struct _cs_parall_reduce_t  cs_parall_reduce_t;
+
 /*=============================================================================
  * Public function prototypes for Fortran API
  *============================================================================*/
@@ -340,6 +358,86 @@ cs_parall_min_id_rank_r(cs_lnum_t  *elt_id,
                         int        *rank_id,
                         cs_real_t   dis2mn);
 
+/*----------------------------------------------------------------------------
+ * Create a structure for aggregated global reductions.
+ *
+ * Values registered with cs_parall_reduce_add() are packed in a single
+ * buffer, so that a single (non-blocking if possible) global reduction
+ * is used for all of them, whatever their datatype and operation.
+ *
+ * returns:
+ *   pointer to new aggregated reduction structure
+ *----------------------------------------------------------------------------*/
+
+cs_parall_reduce_t *
+cs_parall_reduce_create(void);
+
+/*----------------------------------------------------------------------------
+ * Destroy an aggregated global reductions structure.
+ *
+ * If a reduction is still active, it is finished first.
+ *
+ * parameters:
+ *   r <-> pointer to aggregated reduction structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_destroy(cs_parall_reduce_t  **r);
+
+/*----------------------------------------------------------------------------
+ * Register values for an aggregated global reduction.
+ *
+ * Local values are read when cs_parall_reduce_start() is called, and
+ * replaced by global values when cs_parall_reduce_finish() is called,
+ * so the given array must remain available until then.
+ *
+ * Values are reduced as doubles, so integer values are exact only
+ * up to 2^53, which is sufficient for logging and diagnostics.
+ *
+ * parameters:
+ *   r        <-> pointer to aggregated reduction structure
+ *   op       <-- reduction operation
+ *   n        <-- number of values
+ *   datatype <-- matching Code_Saturne datatype
+ *   val      <-> local values in, global values out (size: n)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_add(cs_parall_reduce_t     *r,
+                     cs_parall_reduce_op_t   op,
+                     int                     n,
+                     cs_datatype_t           datatype,
+                     void                   *val);
+
+/*----------------------------------------------------------------------------
+ * Start an aggregated global reduction.
+ *
+ * All registered local values are packed, and a single global reduction
+ * is started. It is non-blocking if the MPI library supports MPI-3
+ * non-blocking collectives. Results are available only after
+ * cs_parall_reduce_finish() is called.
+ *
+ * parameters:
+ *   r <-> pointer to aggregated reduction structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_start(cs_parall_reduce_t  *r);
+
+/*----------------------------------------------------------------------------
+ * Finish an aggregated global reduction.
+ *
+ * Wait for the reduction started by cs_parall_reduce_start() to complete,
+ * and copy the global values to the registered arrays. Registered values
+ * are then cleared, so the structure may be reused.
+ *
+ * parameters:
+ *   r <-> pointer to aggregated reduction structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_finish(cs_parall_reduce_t  *r);
+
 /*----------------------------------------------------------------------------
  * Return minimum recommended scatter or gather buffer size.
  *
@@ -45,6 +45,11 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+#include "cs_timer.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -89,6 +94,10 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Number of property types */
+
+#define CS_PHYS_PROP_N_TYPES (CS_PHYS_PROP_SPEED_OF_SOUND + 1)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -116,6 +125,37 @@ typedef struct {
 
 } cs_thermal_table_t;
 
+/* Tabulated property structure (values on a uniform grid of the
+   thermodynamic plane, in the units used by the property library) */
+
+typedef struct {
+
+  int          n[2];                 /* number of nodes along each axis */
+  double       v_min[2];             /* lower bounds along each axis */
+  double       v_max[2];             /* upper bounds along each axis */
+  double       dv_inv[2];            /* inverse of node spacing */
+  double       max_err;              /* max. interpolation error
+                                        estimated at cell centers */
+
+  cs_real_t   *val;                  /* values at nodes, with var2 index
+                                        varying fastest */
+
+} cs_phys_prop_table_t;
+
+/* Tabulation options */
+
+typedef struct {
+
+  int          active;               /* tabulation active if 1 */
+  int          n_min;                /* initial number of nodes per axis */
+  int          n_max;                /* maximum number of nodes per axis */
+  double       v_min[2];             /* lower bounds along each axis */
+  double       v_max[2];             /* upper bounds along each axis */
+  double       tolerance;            /* target max. error */
+  bool         use_cache;            /* read/write tables from/to file */
+
+} cs_phys_prop_table_options_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer types
  *----------------------------------------------------------------------------*/
@@ -150,6 +190,36 @@ typedef void
 
 cs_thermal_table_t *cs_glob_thermal_table = NULL;
 
+static cs_phys_prop_table_options_t  _table_options
+  = {0, 33, 1025, {0., 0.}, {0., 0.}, 1.e-4, true};
+
+static cs_phys_prop_table_t  *_tables[CS_PHYS_PROP_N_TYPES]
+  = {NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+     NULL, NULL, NULL, NULL, NULL, NULL};
+
+static const char *_phys_prop_name[CS_PHYS_PROP_N_TYPES]
+  = {"pressure",
+     "temperature",
+     "enthalpy",
+     "entropy",
+     "isobaric_heat_capacity",
+     "isochoric_heat_capacity",
+     "specific_volume",
+     "density",
+     "internal_energy",
+     "quality",
+     "thermal_conductivity",
+     "dynamic_viscosity",
+     "speed_of_sound"};
+
+static const char _table_magic[] = "Code_Saturne property table 1.1";
+
+/* Property values below this fraction of the maximum absolute value over
+   a table use an absolute (instead of relative) interpolation error, to
+   avoid refining tables around zero crossings */
+
+static const double _table_abs_err_fraction = 1.e-3;
+
 #if defined(HAVE_DLOPEN) && defined(HAVE_EOS)
 
 static void                     *_cs_eos_dl_lib = NULL;
@@ -190,6 +260,529 @@ _thermal_table_create(void)
   return tt;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a physical property using the selected property library.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_library_compute(cs_phys_prop_type_t   property,
+                           cs_lnum_t             n_vals,
+                           const cs_real_t       var1[],
+                           const cs_real_t       var2[],
+                           cs_real_t             val[])
+{
+  if (cs_glob_thermal_table->type == 1) {
+    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#if defined(HAVE_EOS)
+  else if (cs_glob_thermal_table->type == 2) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      var1,
+                      var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  else if (cs_glob_thermal_table->type == 3) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a property on a structured set of points of the thermodynamic
+ * plane, distributing evaluations among ranks.
+ *
+ * Point (i, j) has coordinates (v_min[0] + (i+shift)*dv[0],
+ * v_min[1] + (j+shift)*dv[1]), and its value is stored in val[i*n1 + j].
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n0       <-- number of points along first axis
+ *   n1       <-- number of points along second axis
+ *   v_min    <-- lower bounds along each axis
+ *   dv       <-- point spacing along each axis
+ *   shift    <-- shift of points relative to v_min, in spacing units
+ *   val      --> values at points (on all ranks)
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_evaluate(cs_phys_prop_type_t   property,
+                int                   n0,
+                int                   n1,
+                const double          v_min[2],
+                const double          dv[2],
+                double                shift,
+                cs_real_t             val[])
+{
+  const cs_lnum_t n_pts = (cs_lnum_t)n0 * (cs_lnum_t)n1;
+
+  /* Block distribution of points among ranks */
+
+  const int n_ranks = CS_MAX(cs_glob_n_ranks, 1);
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_lnum_t s_id = (n_pts * rank_id) / n_ranks;
+  cs_lnum_t e_id = (n_pts * (rank_id + 1)) / n_ranks;
+  cs_lnum_t n_loc = e_id - s_id;
+
+  cs_real_t *var1, *var2;
+  BFT_MALLOC(var1, n_loc, cs_real_t);
+  BFT_MALLOC(var2, n_loc, cs_real_t);
+
+  for (cs_lnum_t k = 0; k < n_loc; k++) {
+    cs_lnum_t i = (s_id + k) / n1;
+    cs_lnum_t j = (s_id + k) % n1;
+    var1[k] = v_min[0] + (i + shift)*dv[0];
+    var2[k] = v_min[1] + (j + shift)*dv[1];
+  }
+
+  if (n_loc > 0)
+    _phys_prop_library_compute(property, n_loc, var1, var2, val + s_id);
+
+  BFT_FREE(var2);
+  BFT_FREE(var1);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    int *counts, *displs;
+    BFT_MALLOC(counts, n_ranks, int);
+    BFT_MALLOC(displs, n_ranks, int);
+
+    for (int r = 0; r < n_ranks; r++) {
+      cs_lnum_t r_s_id = (n_pts * r) / n_ranks;
+      cs_lnum_t r_e_id = (n_pts * (r + 1)) / n_ranks;
+      displs[r] = r_s_id;
+      counts[r] = r_e_id - r_s_id;
+    }
+
+    MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                   val, counts, displs, CS_MPI_REAL,
+                   cs_glob_mpi_comm);
+
+    BFT_FREE(displs);
+    BFT_FREE(counts);
+
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Interpolate tabulated values.
+ *
+ * Values outside the table range are not computed, and their ids are
+ * returned so that they may be computed by the property library.
+ *
+ * parameters:
+ *   t        <-- pointer to table structure
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> interpolated property values
+ *   out_ids  --> ids of values outside table range
+ *
+ * returns:
+ *   number of values outside table range
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_table_interpolate(const cs_phys_prop_table_t  *t,
+                   cs_lnum_t                    n_vals,
+                   const cs_real_t              var1[],
+                   const cs_real_t              var2[],
+                   cs_real_t                    val[],
+                   cs_lnum_t                    out_ids[])
+{
+  const int n0 = t->n[0], n1 = t->n[1];
+  const double v_min0 = t->v_min[0], v_min1 = t->v_min[1];
+  const double dv_inv0 = t->dv_inv[0], dv_inv1 = t->dv_inv[1];
+  const cs_real_t *restrict f = t->val;
+
+  /* Bilinear interpolation, which is monotone, and does not overshoot
+     near saturation lines, where properties have steep variations */
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t k = 0; k < n_vals; k++) {
+
+    double x0 = (var1[k] - v_min0) * dv_inv0;
+    double x1 = (var2[k] - v_min1) * dv_inv1;
+
+    if (!(x0 >= 0. && x0 <= n0 - 1 && x1 >= 0. && x1 <= n1 - 1))
+      continue;
+
+    int i = CS_MIN((int)x0, n0 - 2);
+    int j = CS_MIN((int)x1, n1 - 2);
+    double a = x0 - i, b = x1 - j;
+
+    const cs_real_t *f0 = f + (cs_lnum_t)i*n1 + j;
+    const cs_real_t *f1 = f0 + n1;
+
+    val[k] =   (1.-a) * ((1.-b)*f0[0] + b*f0[1])
+             +     a  * ((1.-b)*f1[0] + b*f1[1]);
+
+  }
+
+  /* Values outside of table range */
+
+  cs_lnum_t n_out = 0;
+
+  for (cs_lnum_t k = 0; k < n_vals; k++) {
+    double x0 = (var1[k] - v_min0) * dv_inv0;
+    double x1 = (var2[k] - v_min1) * dv_inv1;
+    if (!(x0 >= 0. && x0 <= n0 - 1 && x1 >= 0. && x1 <= n1 - 1))
+      out_ids[n_out++] = k;
+  }
+
+  return n_out;
+}
+
+/*----------------------------------------------------------------------------
+ * Build identifier of the property library used for tabulation
+ * (method and reference), usable in a file name.
+ *
+ * parameters:
+ *   lib_id  --> library identifier
+ *   l       <-- maximum identifier length
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_library_id(char    lib_id[],
+                  size_t  l)
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+
+  const char *method = (tt->method != NULL) ? tt->method : "user";
+  const char *reference = (tt->reference != NULL) ? tt->reference : "";
+
+  if (strlen(reference) > 0)
+    snprintf(lib_id, l, "%s_%s", method, reference);
+  else
+    snprintf(lib_id, l, "%s", method);
+  lib_id[l-1] = '\0';
+
+  for (size_t i = 0; lib_id[i] != '\0'; i++) {
+    char c = lib_id[i];
+    if (!(   (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+          || (c >= '0' && c <= '9') || c == '-' || c == '.'))
+      lib_id[i] = '_';
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build cache file name for a tabulated property.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   name     --> file name
+ *   l        <-- maximum name length
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_file_name(cs_phys_prop_type_t   property,
+                 char                  name[],
+                 size_t                l)
+{
+  char lib_id[128];
+  _table_library_id(lib_id, 128);
+
+  snprintf(name, l, "property_table_%s_%s_%s_%d.bin",
+           lib_id,
+           cs_glob_thermal_table->material,
+           _phys_prop_name[property],
+           (int)(cs_glob_thermal_table->thermo_plane));
+  name[l-1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Try reading a tabulated property from a cache file.
+ *
+ * The file is read on rank 0 and values are broadcast to other ranks.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   t        <-> pointer to table structure, with options already set
+ *
+ * returns:
+ *   true if the table was read, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_table_read(cs_phys_prop_type_t    property,
+            cs_phys_prop_table_t  *t)
+{
+  int retval = 0;
+
+  if (cs_glob_rank_id < 1) {
+
+    char name[256], magic[sizeof(_table_magic)];
+    char lib_id[128], ref_lib_id[128];
+    int header_i[2];
+    double header_r[5];
+    const int ref_i[2] = {_table_options.n_min, _table_options.n_max};
+    const double ref_r[5] = {t->v_min[0], t->v_max[0],
+                             t->v_min[1], t->v_max[1],
+                             _table_options.tolerance};
+
+    _table_file_name(property, name, 256);
+
+    memset(ref_lib_id, 0, 128);
+    _table_library_id(ref_lib_id, 128);
+
+    FILE *f = fopen(name, "rb");
+
+    if (f != NULL) {
+      if (   fread(magic, 1, sizeof(magic), f) == sizeof(magic)
+          && fread(lib_id, 1, 128, f) == 128
+          && fread(header_i, sizeof(int), 2, f) == 2
+          && fread(header_r, sizeof(double), 5, f) == 5) {
+        if (   strncmp(magic, _table_magic, sizeof(magic)) == 0
+            && memcmp(lib_id, ref_lib_id, 128) == 0
+            && memcmp(header_i, ref_i, sizeof(ref_i)) == 0
+            && memcmp(header_r, ref_r, sizeof(ref_r)) == 0
+            && fread(t->n, sizeof(int), 2, f) == 2
+            && fread(&(t->max_err), sizeof(double), 1, f) == 1) {
+          cs_lnum_t _n_nodes = (cs_lnum_t)(t->n[0]) * (cs_lnum_t)(t->n[1]);
+          BFT_MALLOC(t->val, _n_nodes, cs_real_t);
+          if (fread(t->val, sizeof(cs_real_t), _n_nodes, f)
+              == (size_t)_n_nodes)
+            retval = 1;
+          else
+            BFT_FREE(t->val);
+        }
+      }
+      fclose(f);
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Bcast(&retval, 1, MPI_INT, 0, cs_glob_mpi_comm);
+    if (retval == 1) {
+      MPI_Bcast(t->n, 2, MPI_INT, 0, cs_glob_mpi_comm);
+      MPI_Bcast(&(t->max_err), 1, MPI_DOUBLE, 0, cs_glob_mpi_comm);
+      cs_lnum_t _n_nodes = (cs_lnum_t)(t->n[0]) * (cs_lnum_t)(t->n[1]);
+      if (cs_glob_rank_id > 0)
+        BFT_MALLOC(t->val, _n_nodes, cs_real_t);
+      MPI_Bcast(t->val, _n_nodes, CS_MPI_REAL, 0, cs_glob_mpi_comm);
+    }
+  }
+#endif
+
+  return (retval == 1) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a tabulated property to a cache file (on rank 0).
+ *
+ * parameters:
+ *   property <-- property queried
+ *   t        <-- pointer to table structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_write(cs_phys_prop_type_t          property,
+             const cs_phys_prop_table_t  *t)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  char name[256], lib_id[128];
+  int header_i[2] = {_table_options.n_min, _table_options.n_max};
+  double header_r[5] = {t->v_min[0], t->v_max[0],
+                        t->v_min[1], t->v_max[1],
+                        _table_options.tolerance};
+  const cs_lnum_t n_nodes = (cs_lnum_t)(t->n[0]) * (cs_lnum_t)(t->n[1]);
+
+  _table_file_name(property, name, 256);
+
+  memset(lib_id, 0, 128);
+  _table_library_id(lib_id, 128);
+
+  FILE *f = fopen(name, "wb");
+
+  if (f == NULL) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Unable to write property table file \"%s\".\n"), name);
+    return;
+  }
+
+  size_t n_written = 0;
+  n_written += fwrite(_table_magic, 1, sizeof(_table_magic), f);
+  n_written += fwrite(lib_id, 1, 128, f);
+  n_written += fwrite(header_i, sizeof(int), 2, f);
+  n_written += fwrite(header_r, sizeof(double), 5, f);
+  n_written += fwrite(t->n, sizeof(int), 2, f);
+  n_written += fwrite(&(t->max_err), sizeof(double), 1, f);
+  n_written += fwrite(t->val, sizeof(cs_real_t), n_nodes, f);
+
+  if (n_written !=   sizeof(_table_magic) + 128
+                   + 2 + 5 + 2 + 1 + (size_t)n_nodes) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Error writing property table file \"%s\".\n"), name);
+  }
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a tabulated property.
+ *
+ * The grid spacing along each axis is halved until the maximum
+ * interpolation error at cell centers is below the tolerance,
+ * or the maximum number of nodes is reached.
+ *
+ * This function is collective.
+ *
+ * parameters:
+ *   property <-- property queried
+ *
+ * returns:
+ *   pointer to new table structure
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_build(cs_phys_prop_type_t  property)
+{
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_phys_prop_table_t *t;
+  BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+
+  for (int k = 0; k < 2; k++) {
+    t->v_min[k] = _table_options.v_min[k];
+    t->v_max[k] = _table_options.v_max[k];
+  }
+  t->val = NULL;
+  t->max_err = -1.;
+
+  bool from_cache = false;
+
+  if (_table_options.use_cache)
+    from_cache = _table_read(property, t);
+
+  if (from_cache == false) {
+
+    int n = CS_MAX(_table_options.n_min, 2);
+
+    while (true) {
+
+      double dv[2];
+      for (int k = 0; k < 2; k++)
+        dv[k] = (t->v_max[k] - t->v_min[k]) / (n - 1);
+
+      t->n[0] = n;
+      t->n[1] = n;
+      for (int k = 0; k < 2; k++)
+        t->dv_inv[k] = 1. / dv[k];
+
+      BFT_REALLOC(t->val, (cs_lnum_t)n*n, cs_real_t);
+      _table_evaluate(property, n, n, t->v_min, dv, 0., t->val);
+
+      /* Estimate error at cell centers */
+
+      cs_lnum_t n_c = (cs_lnum_t)(n-1)*(n-1);
+      cs_real_t *c_val, *c_ref, *c1, *c2;
+      cs_lnum_t *c_out;
+      BFT_MALLOC(c_val, n_c, cs_real_t);
+      BFT_MALLOC(c_ref, n_c, cs_real_t);
+      BFT_MALLOC(c1, n_c, cs_real_t);
+      BFT_MALLOC(c2, n_c, cs_real_t);
+      BFT_MALLOC(c_out, n_c, cs_lnum_t);
+
+      _table_evaluate(property, n-1, n-1, t->v_min, dv, 0.5, c_ref);
+
+      for (cs_lnum_t k = 0; k < n_c; k++) {
+        c1[k] = t->v_min[0] + (k/(n-1) + 0.5)*dv[0];
+        c2[k] = t->v_min[1] + (k%(n-1) + 0.5)*dv[1];
+      }
+      _table_interpolate(t, n_c, c1, c2, c_val, c_out);
+
+      /* Relative error, or absolute error scaled by the table's
+         magnitude for small values */
+
+      double max_ref = 0.;
+      for (cs_lnum_t k = 0; k < n_c; k++)
+        max_ref = CS_MAX(max_ref, CS_ABS(c_ref[k]));
+
+      const double r_min = CS_MAX(_table_abs_err_fraction*max_ref, 1.e-30);
+
+      double max_err = 0.;
+      for (cs_lnum_t k = 0; k < n_c; k++) {
+        double d = CS_ABS(c_val[k] - c_ref[k]);
+        double r = CS_MAX(CS_ABS(c_ref[k]), r_min);
+        max_err = CS_MAX(max_err, d/r);
+      }
+      t->max_err = max_err;
+
+      BFT_FREE(c_out);
+      BFT_FREE(c2);
+      BFT_FREE(c1);
+      BFT_FREE(c_ref);
+      BFT_FREE(c_val);
+
+      if (max_err <= _table_options.tolerance || 2*n - 1 > _table_options.n_max)
+        break;
+
+      n = 2*n - 1;
+
+    }
+
+    if (_table_options.use_cache)
+      _table_write(property, t);
+
+  }
+
+  for (int k = 0; k < 2; k++)
+    t->dv_inv[k] = (t->n[k] - 1) / (t->v_max[k] - t->v_min[k]);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt;
+  CS_TIMER_COUNTER_INIT(dt);
+  cs_timer_counter_add_diff(&dt, &t0, &t1);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n Tabulated property \"%s\" (%s):\n"
+                  "   %d x %d nodes, max. error: %10.3e\n"
+                  "   setup time: %.3g s\n"),
+                _phys_prop_name[property],
+                (from_cache) ? _("read from file") : _("computed"),
+                t->n[0], t->n[1], t->max_err,
+                dt.wall_nsec*1e-9);
+
+  if (t->max_err > _table_options.tolerance) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Tabulated property \"%s\": maximum number of nodes"
+                 " reached\n"
+                 "with an error of %g (tolerance: %g).\n"),
+               _phys_prop_name[property], t->max_err,
+               _table_options.tolerance);
+  }
+
+  return t;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -297,6 +890,13 @@ cs_thermal_table_set(const char *material,
 void
 cs_thermal_table_finalize(void)
 {
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++) {
+    if (_tables[i] != NULL) {
+      BFT_FREE(_tables[i]->val);
+      BFT_FREE(_tables[i]);
+    }
+  }
+
   if (cs_glob_thermal_table != NULL) {
 #if defined(HAVE_EOS)
     if (cs_glob_thermal_table->type == 2) {
@@ -354,6 +954,19 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
   cs_real_t        *_var1_c = NULL, *_var2_c = NULL;
   const cs_real_t  *var1_c = var1, *var2_c = var2;
 
+  /* Build tabulated property on first call with non-constant values
+     (collective, before local early returns) */
+
+  bool use_table = false;
+
+  if (   _table_options.active
+      && cs_glob_thermal_table->type > 0
+      && (var1_stride != 0 || var2_stride != 0)) {
+    if (_tables[property] == NULL)
+      _tables[property] = _table_build(property);
+    use_table = true;
+  }
+
   if (n_vals < 1)
     return;
 
@@ -390,37 +1003,42 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
     }
   }
 
-  /* Compute proper */
+  /* Compute property */
+
+  if (use_table && _n_vals > 1) {
+
+    /* Interpolate, using the property library outside the table range */
+
+    cs_lnum_t *out_ids;
+    BFT_MALLOC(out_ids, _n_vals, cs_lnum_t);
+
+    cs_lnum_t n_out = _table_interpolate(_tables[property],
+                                         _n_vals,
+                                         var1_c,
+                                         var2_c,
+                                         val,
+                                         out_ids);
+
+    if (n_out > 0) {
+      cs_real_t *o_var;
+      BFT_MALLOC(o_var, n_out*3, cs_real_t);
+      for (cs_lnum_t k = 0; k < n_out; k++) {
+        o_var[k] = var1_c[out_ids[k]];
+        o_var[n_out + k] = var2_c[out_ids[k]];
+      }
+      _phys_prop_library_compute(property, n_out,
+                                 o_var, o_var + n_out, o_var + 2*n_out);
+      for (cs_lnum_t k = 0; k < n_out; k++)
+        val[out_ids[k]] = o_var[2*n_out + k];
+      BFT_FREE(o_var);
+    }
+
+    BFT_FREE(out_ids);
 
-  if (cs_glob_thermal_table->type == 1) {
-    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#if defined(HAVE_EOS)
-  else if (cs_glob_thermal_table->type == 2) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  else if (cs_glob_thermal_table->type == 3) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
   }
-#endif
+  else
+    _phys_prop_library_compute(property, _n_vals, var1_c, var2_c, val);
+
   BFT_FREE(_var1_c);
   BFT_FREE(_var2_c);
 
@@ -433,6 +1051,75 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of physical properties.
+ *
+ * Properties computed with cs_phys_prop_compute using a property library
+ * (freesteam, EOS, or CoolProp) are then interpolated from tables built
+ * on first use. Values outside the given bounds are still computed
+ * using the property library.
+ *
+ * Tables are defined on a uniform grid of the thermodynamic plane
+ * (in the units used by the property library, so temperatures are in
+ * Kelvin). Starting from n_min nodes per axis, the grid spacing is halved
+ * until the interpolation error estimated at grid cell centers is below
+ * the given tolerance, or n_max is reached. This error is relative, except
+ * for values smaller than 1e-3 times the maximum absolute value over the
+ * table, for which it is relative to that threshold.
+ *
+ * When use_cache is true, tables are written to and read from files
+ * named property_table_<library>_<material>_<property>_<plane>.bin in the
+ * execution directory, where <library> is built from the property
+ * library method and reference, which are also checked when reading.
+ *
+ * \param[in]  var1_min   lower bound along first plane axis
+ * \param[in]  var1_max   upper bound along first plane axis
+ * \param[in]  var2_min   lower bound along second plane axis
+ * \param[in]  var2_max   upper bound along second plane axis
+ * \param[in]  n_min      initial number of nodes per axis
+ * \param[in]  n_max      maximum number of nodes per axis
+ * \param[in]  tolerance  target maximum interpolation error
+ * \param[in]  use_cache  read/write tables from/to files if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_set_options(double  var1_min,
+                               double  var1_max,
+                               double  var2_min,
+                               double  var2_max,
+                               int     n_min,
+                               int     n_max,
+                               double  tolerance,
+                               bool    use_cache)
+{
+  if (!(var1_max > var1_min && var2_max > var2_min))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Property tabulation bounds must be increasing:\n"
+                "  var1: [%g, %g], var2: [%g, %g]"),
+              var1_min, var1_max, var2_min, var2_max);
+
+  _table_options.active = 1;
+  _table_options.v_min[0] = var1_min;
+  _table_options.v_max[0] = var1_max;
+  _table_options.v_min[1] = var2_min;
+  _table_options.v_max[1] = var2_max;
+  _table_options.n_min = CS_MAX(n_min, 2);
+  _table_options.n_max = CS_MAX(n_max, _table_options.n_min);
+  _table_options.tolerance = tolerance;
+  _table_options.use_cache = use_cache;
+
+  /* Tables built with previous options are discarded */
+
+  for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++) {
+    if (_tables[i] != NULL) {
+      BFT_FREE(_tables[i]->val);
+      BFT_FREE(_tables[i]);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute properties with Freesteam in a defined thermal plane.
@@ -117,6 +117,48 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
                      const cs_real_t              var2[],
                      cs_real_t                    val[]);
 
+/*----------------------------------------------------------------------------
+ * Activate tabulation of physical properties.
+ *
+ * Properties computed with cs_phys_prop_compute using a property library
+ * (freesteam, EOS, or CoolProp) are then interpolated from tables built
+ * on first use. Values outside the given bounds are still computed
+ * using the property library.
+ *
+ * Tables are defined on a uniform grid of the thermodynamic plane
+ * (in the units used by the property library, so temperatures are in
+ * Kelvin). Starting from n_min nodes per axis, the grid spacing is halved
+ * until the interpolation error estimated at grid cell centers is below
+ * the given tolerance, or n_max is reached. This error is relative, except
+ * for values smaller than 1e-3 times the maximum absolute value over the
+ * table, for which it is relative to that threshold.
+ *
+ * When use_cache is true, tables are written to and read from files
+ * named property_table_<library>_<material>_<property>_<plane>.bin in the
+ * execution directory, where <library> is built from the property
+ * library method and reference, which are also checked when reading.
+ *
+ * parameters:
+ *   var1_min  <-- lower bound along first plane axis
+ *   var1_max  <-- upper bound along first plane axis
+ *   var2_min  <-- lower bound along second plane axis
+ *   var2_max  <-- upper bound along second plane axis
+ *   n_min     <-- initial number of nodes per axis
+ *   n_max     <-- maximum number of nodes per axis
+ *   tolerance <-- target maximum interpolation error
+ *   use_cache <-- read/write tables from/to files if true
+ *----------------------------------------------------------------------------*/
+
+void
+cs_phys_prop_table_set_options(double  var1_min,
+                               double  var1_max,
+                               double  var2_min,
+                               double  var2_max,
+                               int     n_min,
+                               int     n_max,
+                               double  tolerance,
+                               bool    use_cache);
+
 /*----------------------------------------------------------------------------
  * Compute properties with Freesteam in a defined thermal plane.
  *
@@ -3381,6 +3381,8 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
  * - \c \b plot (comma or whitespace separated 2d plot files)
  * - \c \b time_plot (comma or whitespace separated time plot files)
+ * - \c \b XDMF (XML description with binary data written using
+ *         parallel IO when available)
  *
  * The format name is case-sensitive, so \c \b ensight or \c \b cgns are also valid.
  *
@@ -3391,6 +3393,8 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b big_endian to force outputs to be in \c \b big-endian mode
  *         (for \c \b EnSight).
  * - \c \b text for a text format version (for \c \b EnSight).
+ * - \c \b double to output field values in double precision
+ *         (for \c \b XDMF).
  * - \c \b adf for ADF file type (for \c \b CGNS).
  * - \c \b hdf5 for HDF5 file type (for \c \b CGNS, normally the default if
  *         HDF5 support is available).
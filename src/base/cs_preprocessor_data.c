@@ -58,6 +58,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
+#include "cs_mesh_read_gmsh.h"
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_io.h"
@@ -86,6 +87,8 @@ typedef struct {
   const char         *filename;   /* File name */
   cs_file_off_t       offset;     /* File offsets for re-opening */
   const double       *matrix;     /* Coordinate transformation matrix */
+  bool                gmsh;       /* Gmsh file read directly, or
+                                     Preprocessor output */
 
   size_t              n_group_renames;
   const char  *const *old_group_names;
@@ -243,6 +246,18 @@ _mesh_reader_create(int                 *n_mesh_files,
   for (i = 0; i < mr->n_files; i++)
     mr->gc_id_shift[i] = 0;
 
+  /* Detect files which may be read directly */
+
+  for (i = 0; i < mr->n_files; i++) {
+    _mesh_file_info_t  *f = mr->file_info + i;
+    f->gmsh = cs_mesh_read_gmsh_check(f->filename);
+    if (f->gmsh && mr->n_files > 1)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\" is read directly,\n"
+                  "and may not be combined with other mesh inputs."),
+                f->filename);
+  }
+
   mr->n_perio_read = 0;
   mr->n_cells_read = 0;
   mr->n_faces_read = 0;
@@ -2043,8 +2058,20 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
   mr = _cs_glob_mesh_reader;
 
-  for (file_id = 0; file_id < mr->n_files; file_id++)
-    _read_dimensions(mesh, mesh_builder, mr, file_id);
+  for (file_id = 0; file_id < mr->n_files; file_id++) {
+    _mesh_file_info_t  *f = mr->file_info + file_id;
+    if (f->gmsh) {
+      cs_mesh_read_gmsh_headers(f->filename, mesh, mesh_builder);
+      if (f->n_group_renames > 0)
+        _mesh_groups_rename(mesh,
+                            0,
+                            f->n_group_renames,
+                            f->old_group_names,
+                            f->new_group_names);
+    }
+    else
+      _read_dimensions(mesh, mesh_builder, mr, file_id);
+  }
 
   /* Return values */
 
@@ -2133,8 +2160,21 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   else
     _set_block_ranges(mesh, mesh_builder);
 
-  for (file_id = 0; file_id < mr->n_files; file_id++)
-    _read_data(file_id, mesh, mesh_builder, mr, echo);
+  for (file_id = 0; file_id < mr->n_files; file_id++) {
+    _mesh_file_info_t  *f = mr->file_info + file_id;
+    if (f->gmsh) {
+      cs_mesh_read_gmsh_data(f->filename, mesh, mesh_builder);
+      if (f->matrix != NULL) {
+        const cs_gnum_t *range = mesh_builder->vertex_bi.gnum_range;
+        _transform_coords(range[1] - range[0],
+                          mesh_builder->vertex_coords,
+                          f->matrix);
+        mesh->modified = 1;
+      }
+    }
+    else
+      _read_data(file_id, mesh, mesh_builder, mr, echo);
+  }
 
   if (mr->n_files > 1)
     mesh->modified = 1;
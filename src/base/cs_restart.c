@@ -104,6 +104,13 @@ typedef struct _location_t {
   cs_gnum_t        *_ent_global_num;  /* Private global entity numbers,
                                          or NULL */
 
+#if defined(HAVE_MPI)
+  cs_block_dist_info_t  bi;           /* Block distribution for reading */
+  cs_block_to_part_t   *d;            /* Block to partition distributor
+                                         shared by sections read on this
+                                         location, or NULL */
+#endif
+
 } _location_t;
 
 struct _cs_restart_t {
@@ -187,6 +194,27 @@ _compute_n_ents(const cs_restart_t  *r,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Free the block to partition distributor associated with a location.
+ *
+ * This must be called whenever the location's partition or global
+ * numbering changes.
+ *
+ * parameters:
+ *   loc <-> pointer to location
+ *----------------------------------------------------------------------------*/
+
+static void
+_location_free_distributor(_location_t  *loc)
+{
+#if defined(HAVE_MPI)
+  if (loc->d != NULL)
+    cs_block_to_part_destroy(&(loc->d));
+#else
+  CS_UNUSED(loc);
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Analyze the content of a restart file to build locations
  *
@@ -240,6 +268,10 @@ _locations_from_index(cs_restart_t  *r)
       loc->ent_global_num = NULL;
       loc->_ent_global_num = NULL;
 
+#if defined(HAVE_MPI)
+      loc->d = NULL;
+#endif
+
       r->n_locations += 1;
     }
 
@@ -334,12 +366,15 @@ _add_file(cs_restart_t  *r)
 /*----------------------------------------------------------------------------
  * Read variable values defined on a mesh location.
  *
+ * The block distribution and block to partition distributor are built
+ * on the first read for a given location, and reused for all following
+ * sections on that location, whatever their type or number of values
+ * per entity.
+ *
  * parameters:
- *   r           <-> associated restart file pointer
+ *   r               <-> associated restart file pointer
+ *   loc             <-> associated location
  *   header          <-- header associated with current position in file
- *   n_glob_ents     <-- global number of entities
- *   n_ents          <-- local number of entities
- *   ent_global_num  <-- global entity numbers (1 to n numbering)
  *   n_location_vals <-- number of values par location
  *   val_type        <-- data type
  *   vals            --> array of values
@@ -347,10 +382,8 @@ _add_file(cs_restart_t  *r)
 
 static void
 _read_ent_values(cs_restart_t           *r,
+                 _location_t            *loc,
                  cs_io_sec_header_t     *header,
-                 cs_gnum_t               n_glob_ents,
-                 cs_lnum_t               n_ents,
-                 const cs_gnum_t         ent_global_num[],
                  int                     n_location_vals,
                  cs_restart_val_type_t   val_type,
                  cs_byte_t               vals[])
@@ -359,11 +392,7 @@ _read_ent_values(cs_restart_t           *r,
 
   cs_lnum_t  block_buf_size = 0;
 
-  size_t  nbr_byte_ent;
-
-  cs_block_dist_info_t bi;
-
-  cs_block_to_part_t *d = NULL;
+  size_t  nbr_byte_ent = 0;
 
   /* Initialization */
 
@@ -383,36 +412,48 @@ _read_ent_values(cs_restart_t           *r,
     nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
     break;
   default:
-    assert(0);
+    bft_error(__FILE__, __LINE__, 0,
+              _("Restart file \"%s\": unhandled value type %d."),
+              r->name, (int)val_type);
   }
 
-  bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
-                                   cs_glob_n_ranks,
-                                   r->rank_step,
-                                   r->min_block_size / nbr_byte_ent,
-                                   n_glob_ents);
+  /* Build distribution on first use for this location; the minimum
+     block size is based on one real value per entity, so that the same
+     distribution may be used for all sections. */
 
-  d = cs_block_to_part_create_by_gnum(cs_glob_mpi_comm,
-                                      bi,
-                                      n_ents,
-                                      ent_global_num);
+  if (loc->d == NULL) {
+
+    loc->bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                          cs_glob_n_ranks,
+                                          r->rank_step,
+                                          r->min_block_size
+                                          / sizeof(cs_real_t),
+                                          loc->n_glob_ents);
+
+    loc->d = cs_block_to_part_create_by_gnum(cs_glob_mpi_comm,
+                                             loc->bi,
+                                             loc->n_ents,
+                                             loc->ent_global_num);
+
+  }
 
   /* Read blocks */
 
-  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+  block_buf_size = (loc->bi.gnum_range[1] - loc->bi.gnum_range[0])
+                   * nbr_byte_ent;
 
   if (block_buf_size > 0)
     BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
 
   cs_io_read_block(header,
-                   bi.gnum_range[0],
-                   bi.gnum_range[1],
+                   loc->bi.gnum_range[0],
+                   loc->bi.gnum_range[1],
                    buffer,
                    r->fh);
 
  /* Distribute blocks on ranks */
 
-  cs_block_to_part_copy_array(d,
+  cs_block_to_part_copy_array(loc->d,
                               header->elt_type,
                               n_location_vals,
                               buffer,
@@ -421,8 +462,6 @@ _read_ent_values(cs_restart_t           *r,
   /* Free buffer */
 
   BFT_FREE(buffer);
-
-  cs_block_to_part_destroy(&d);
 }
 
 /*----------------------------------------------------------------------------
@@ -454,7 +493,7 @@ _write_ent_values(const cs_restart_t     *r,
   cs_lnum_t  block_buf_size = 0;
 
   cs_datatype_t elt_type = CS_DATATYPE_NULL;
-  size_t      nbr_byte_ent;
+  size_t      nbr_byte_ent = 0;
   cs_byte_t  *buffer = NULL;
 
   cs_block_dist_info_t bi;
@@ -482,7 +521,9 @@ _write_ent_values(const cs_restart_t     *r,
                ? CS_DOUBLE : CS_FLOAT;
     break;
   default:
-    assert(0);
+    bft_error(__FILE__, __LINE__, 0,
+              _("Restart file \"%s\": unhandled value type %d."),
+              r->name, (int)val_type);
   }
 
   bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
@@ -1380,6 +1421,7 @@ cs_restart_destroy(cs_restart_t  **restart)
     for (loc_id = 0; loc_id < r->n_locations; loc_id++) {
       BFT_FREE((r->location[loc_id]).name);
       BFT_FREE((r->location[loc_id])._ent_global_num);
+      _location_free_distributor(r->location + loc_id);
     }
   }
   if (r->location != NULL)
@@ -1489,6 +1531,8 @@ cs_restart_add_location(cs_restart_t     *restart,
 
       if ((strcmp((restart->location[loc_id]).name, location_name) == 0)) {
 
+        _location_free_distributor(restart->location + loc_id);
+
         (restart->location[loc_id]).n_glob_ents = n_glob_ents;
 
         (restart->location[loc_id]).n_ents  = n_ents;
@@ -1534,6 +1578,10 @@ cs_restart_add_location(cs_restart_t     *restart,
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = NULL;
 
+#if defined(HAVE_MPI)
+    (restart->location[restart->n_locations-1]).d = NULL;
+#endif
+
     cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
                        gnum_type, &n_glob_ents,
                        restart->fh);
@@ -1925,10 +1973,8 @@ cs_restart_read_section(cs_restart_t           *restart,
 
   else
     _read_ent_values(restart,
+                     restart->location + location_id - 1,
                      &header,
-                     n_glob_ents,
-                     n_ents,
-                     ent_global_num,
                      _n_location_vals,
                      val_type,
                      (cs_byte_t *)val);
@@ -2226,6 +2272,9 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
 
     BFT_FREE(b_cell_rank);
 
+    _location_free_distributor(restart->location + loc_id);
+    BFT_FREE((restart->location[loc_id])._ent_global_num);
+
     (restart->location[loc_id])._ent_global_num
       = cs_block_to_part_transfer_gnum(d);
     (restart->location[loc_id]).ent_global_num
@@ -2234,7 +2283,10 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
     (restart->location[loc_id]).n_glob_ents = n_glob_particles;
     (restart->location[loc_id]).n_ents = cs_block_to_part_get_n_part_ents(d);
 
-    cs_block_to_part_destroy(&d);
+    /* Keep distributor for reading of particle sections */
+
+    (restart->location[loc_id]).bi = part_bi;
+    (restart->location[loc_id]).d = d;
 
     BFT_FREE(part_cell_num);
 
@@ -42,7 +42,10 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
@@ -53,7 +56,9 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_log.h"
 #include "cs_map.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 
@@ -84,6 +89,12 @@ BEGIN_C_DECLS
   Timer statistics also allow for incrementing results from base timers
   (in addition to starting/stopping their own timers), so they may be used
   to assist logging and plotting of other timers.
+
+  In addition, communication wait times may be attributed to the active
+  statistic of the operations tree, per-thread timings may be added for
+  OpenMP regions, and events may be traced for selected time steps.
+  The distribution of these timings over ranks and threads is logged
+  at the end of the computation.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -108,6 +119,9 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  cs_timer_counter_t   t_wait;          /* Attributed communication wait */
+  cs_timer_counter_t  *t_thread;        /* Per-thread counters, or NULL */
+
 } cs_timer_stats_t;
 
 /*-------------------------------------------------------------------------------
@@ -140,10 +154,216 @@ static cs_timer_stats_t  *_stats= NULL;
 
 static cs_map_name_to_id_t  *_name_map = NULL;
 
+/* Communication wait times */
+
+static cs_timer_counter_t  _wait_tot[CS_TIMER_STATS_N_WAIT_TYPES];
+
+static const char *_wait_name[] = {N_("halo synchronization"),
+                                   N_("global reductions")};
+
+/* Event trace (events are stored as (id, start, duration) triplets,
+   in microseconds, with negative ids for communication waits) */
+
+static int          _trace_start_id = -1;
+static int          _trace_end_id = -1;
+static bool         _trace_active = false;
+static int          _n_trace_events = 0;
+static int          _n_trace_events_max = 0;
+static int          _n_trace_events_written = 0;
+static double      *_trace_events = NULL;
+static cs_timer_t   _trace_t_ref;
+static FILE        *_trace_file = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add an event to the trace if tracing is active.
+ *
+ * parameters:
+ *   id  <-- id of statistic, or -1 - wait type for communication waits
+ *   t0  <-- event start time
+ *   t1  <-- event end time
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_add(int                id,
+           const cs_timer_t  *t0,
+           const cs_timer_t  *t1)
+{
+  if (_trace_active == false)
+    return;
+
+  if (_n_trace_events >= _n_trace_events_max) {
+    _n_trace_events_max = CS_MAX(_n_trace_events_max*2, 256);
+    BFT_REALLOC(_trace_events, _n_trace_events_max*3, double);
+  }
+
+  double *e = _trace_events + _n_trace_events*3;
+
+  e[0] = id;
+  e[1] = (  (t0->wall_sec - _trace_t_ref.wall_sec)*1e6
+          + (t0->wall_nsec - _trace_t_ref.wall_nsec)*1e-3);
+  e[2] = (  (t1->wall_sec - t0->wall_sec)*1e6
+          + (t1->wall_nsec - t0->wall_nsec)*1e-3);
+
+  _n_trace_events += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Gather traced events on rank 0 and write them.
+ *
+ * This function is collective.
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_write(void)
+{
+  int n_ranks = 1;
+  int *counts = NULL, *displs = NULL;
+  double *g_events = _trace_events;
+
+  int n_vals = _n_trace_events*3;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    n_ranks = cs_glob_n_ranks;
+
+    if (cs_glob_rank_id == 0) {
+      BFT_MALLOC(counts, n_ranks, int);
+      BFT_MALLOC(displs, n_ranks, int);
+    }
+
+    MPI_Gather(&n_vals, 1, MPI_INT, counts, 1, MPI_INT, 0, cs_glob_mpi_comm);
+
+    g_events = NULL;
+    if (cs_glob_rank_id == 0) {
+      displs[0] = 0;
+      for (int i = 1; i < n_ranks; i++)
+        displs[i] = displs[i-1] + counts[i-1];
+      BFT_MALLOC(g_events, displs[n_ranks-1] + counts[n_ranks-1], double);
+    }
+
+    MPI_Gatherv(_trace_events, n_vals, MPI_DOUBLE,
+                g_events, counts, displs, MPI_DOUBLE,
+                0, cs_glob_mpi_comm);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (counts == NULL) {
+    BFT_MALLOC(counts, 1, int);
+    BFT_MALLOC(displs, 1, int);
+    counts[0] = n_vals;
+    displs[0] = 0;
+  }
+
+  if (cs_glob_rank_id < 1) {
+
+    if (_trace_file == NULL) {
+      _trace_file = fopen("timer_stats_trace.json", "w");
+      if (_trace_file == NULL)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error opening file: \"%s\""), "timer_stats_trace.json");
+      fprintf(_trace_file, "[");
+    }
+
+    for (int rank_id = 0; rank_id < n_ranks; rank_id++) {
+      const double *e = g_events + displs[rank_id];
+      for (int i = 0; i < counts[rank_id]/3; i++) {
+        const int id = e[i*3];
+        const char *name = NULL, *cat = NULL;
+        int tid = _n_roots;
+        if (id > -1) {
+          const cs_timer_stats_t  *s = _stats + id;
+          name = s->label;
+          int r_id = id;
+          while ((_stats + r_id)->parent_id > -1)
+            r_id = (_stats + r_id)->parent_id;
+          tid = s->root_id;
+          cat = (_stats + r_id)->label;
+        }
+        else {
+          name = _(_wait_name[-1 - id]);
+          cat = _("communication wait");
+        }
+        fprintf(_trace_file,
+                "%s\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+                "\"pid\": %d, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                (_n_trace_events_written > 0) ? "," : "",
+                name, cat, rank_id, tid, e[i*3 + 1], e[i*3 + 2]);
+        _n_trace_events_written += 1;
+      }
+    }
+
+    fflush(_trace_file);
+
+  }
+
+  if (g_events != _trace_events)
+    BFT_FREE(g_events);
+  BFT_FREE(displs);
+  BFT_FREE(counts);
+
+  _n_trace_events = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Build depth-first ordering of statistics trees.
+ *
+ * parameters:
+ *   parent_id <-- id of parent statistic, or -1 for roots
+ *   n         <-- number of statistics already ordered
+ *   order     <-> ordered statistic ids
+ *
+ * return:
+ *   updated number of ordered statistics
+ *----------------------------------------------------------------------------*/
+
+static int
+_tree_order(int  parent_id,
+            int  n,
+            int  order[])
+{
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    if ((_stats + stats_id)->parent_id == parent_id) {
+      order[n++] = stats_id;
+      n = _tree_order(stats_id, n, order);
+    }
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Return total wall-clock time of a statistic, including running time
+ * for active statistics.
+ *
+ * parameters:
+ *   s      <-- pointer to statistic
+ *   t_now  <-- current time
+ *
+ * return:
+ *   total time, in seconds
+ *----------------------------------------------------------------------------*/
+
+static double
+_total_wtime(const cs_timer_stats_t  *s,
+             const cs_timer_t        *t_now)
+{
+  cs_timer_counter_t t;
+
+  CS_TIMER_COUNTER_ADD(t, s->t_tot, s->t_cur);
+  if (s->active)
+    cs_timer_counter_add_diff(&t, &(s->t_start), t_now);
+
+  return t.wall_nsec*1e-9;
+}
+
 /*----------------------------------------------------------------------------
  * Check if a timer is a parent of another
  *
@@ -290,6 +510,10 @@ _output_time_plot(void)
  * This creates 2 statistic timer trees, whose roots ids are:
  * - 0 for computational operations
  * - 1 for computational stages
+ *
+ * If the CS_TIMER_STATS_TRACE environment variable is set, its value
+ * ("start_time_id" or "start_time_id:end_time_id") defines the range of
+ * traced time steps (see \ref cs_timer_stats_set_trace_options).
  */
 /*----------------------------------------------------------------------------*/
 
@@ -301,11 +525,28 @@ cs_timer_stats_initialize(void)
   _time_id = 0;
   _start_time_id = 0;
 
+  const char *p = getenv("CS_TIMER_STATS_TRACE");
+
+  if (p != NULL) {
+    int t_ids[2] = {-1, -1};
+    int n = sscanf(p, "%d:%d", t_ids, t_ids + 1);
+    if (n == 1)
+      t_ids[1] = t_ids[0];
+    if (n > 0)
+      cs_timer_stats_set_trace_options(t_ids[0], t_ids[1]);
+  }
+
   if (_name_map != NULL)
     cs_timer_stats_finalize();
 
   _name_map = cs_map_name_to_id_create();
 
+  for (int i = 0; i < CS_TIMER_STATS_N_WAIT_TYPES; i++)
+    CS_TIMER_COUNTER_INIT(_wait_tot[i]);
+
+  _trace_t_ref = cs_timer_time();
+  _trace_active = (_time_id >= _trace_start_id && _time_id <= _trace_end_id);
+
   id = cs_timer_stats_create(NULL, "operations", "total");
   cs_timer_stats_start(id);
 
@@ -329,11 +570,22 @@ cs_timer_stats_finalize(void)
   if (_time_plot != NULL)
     cs_time_plot_finalize(&_time_plot);
 
+  if (_trace_file != NULL) {
+    fprintf(_trace_file, "\n]\n");
+    fclose(_trace_file);
+    _trace_file = NULL;
+  }
+  BFT_FREE(_trace_events);
+  _n_trace_events = 0;
+  _n_trace_events_max = 0;
+  _trace_active = false;
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
     cs_timer_stats_t  *s = _stats + stats_id;
     BFT_FREE(s->label);
+    BFT_FREE(s->t_thread);
   }
 
   BFT_FREE(_stats);
@@ -364,6 +616,8 @@ cs_timer_stats_set_start_time(int time_id)
   if (_time_id <= 0 && _start_time_id <= 0) {
     _time_id = time_id;
     _start_time_id = time_id;
+    _trace_active = (   _time_id >= _trace_start_id
+                     && _time_id <= _trace_end_id);
   }
 }
 
@@ -396,6 +650,35 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
   _plot_flush_wtime = flush_wtime;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set timer statistics event trace options.
+ *
+ * Events are traced for time ids in the [start_time_id, end_time_id]
+ * range, and written at the end of each traced time step to the
+ * "timer_stats_trace.json" file, using the Chrome trace event format
+ * (with one process per rank and one thread per statistics tree).
+ *
+ * This may also be set using the CS_TIMER_STATS_TRACE environment
+ * variable (see \ref cs_timer_stats_initialize).
+ *
+ * \param[in]  start_time_id  first traced time id, or -1 for no trace
+ * \param[in]  end_time_id    last traced time id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace_options(int  start_time_id,
+                                 int  end_time_id)
+{
+  _trace_start_id = start_time_id;
+  _trace_end_id = (start_time_id > -1) ? end_time_id : -1;
+
+  _trace_active = (   _time_id > -1
+                   && _time_id >= _trace_start_id
+                   && _time_id <= _trace_end_id);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -413,11 +696,17 @@ cs_timer_stats_increment_time_step(void)
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
     cs_timer_stats_t  *s = _stats + stats_id;
     if (s->active) {
+      _trace_add(stats_id, &(s->t_start), &t_incr);
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
       s->t_start = t_incr;
     }
   }
 
+  /* Write traced events */
+
+  if (_trace_active)
+    _trace_write();
+
   /* Now output data */
 
   if (   _time_plot == NULL && _time_id < _start_time_id + 1
@@ -438,6 +727,8 @@ cs_timer_stats_increment_time_step(void)
   }
 
   _time_id += 1;
+
+  _trace_active = (_time_id >= _trace_start_id && _time_id <= _trace_end_id);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -537,6 +828,14 @@ cs_timer_stats_create(const char  *parent_name,
 
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
+  CS_TIMER_COUNTER_INIT(s->t_wait);
+
+  s->t_thread = NULL;
+  if (cs_glob_n_threads > 1) {
+    BFT_MALLOC(s->t_thread, cs_glob_n_threads, cs_timer_counter_t);
+    for (int i = 0; i < cs_glob_n_threads; i++)
+      CS_TIMER_COUNTER_INIT(s->t_thread[i]);
+  }
 
   return stats_id;
 }
@@ -683,6 +982,7 @@ cs_timer_stats_stop(int  id)
     s = _stats + _active_id[root_id];
 
     if (s->active == true) {
+      _trace_add(_active_id[root_id], &(s->t_start), &t_stop);
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
@@ -731,6 +1031,7 @@ cs_timer_stats_switch(int  id)
     s = _stats + _active_id[root_id];
 
     if (s->active == true) {
+      _trace_add(_active_id[root_id], &(s->t_start), &t_switch);
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
@@ -779,8 +1080,255 @@ cs_timer_stats_add_diff(int                id,
 
   cs_timer_stats_t  *s = _stats + id;
 
-  if (s->active == false)
+  if (s->active == false) {
+    _trace_add(id, t0, t1);
     cs_timer_counter_add_diff(&(s->t_cur), t0, t1);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a timing range for a given thread to a timer statistic.
+ *
+ * This is intended for timing of OpenMP regions, and may be called by
+ * each thread in a parallel region, using its own thread id. The main
+ * timer of the statistic is not modified.
+ *
+ * \param[in]  id         id of statistic
+ * \param[in]  thread_id  id of calling thread
+ * \param[in]  t0         oldest timer value
+ * \param[in]  t1         most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_thread_diff(int                id,
+                               int                thread_id,
+                               const cs_timer_t  *t0,
+                               const cs_timer_t  *t1)
+{
+  if (id < 0 || id >= _n_stats) return;
+
+  cs_timer_stats_t  *s = _stats + id;
+
+  if (s->t_thread != NULL && thread_id < cs_glob_n_threads)
+    cs_timer_counter_add_diff(s->t_thread + thread_id, t0, t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a communication wait time range.
+ *
+ * The wait time is accounted for its category, and attributed to the
+ * currently active statistic of the operations tree.
+ *
+ * \param[in]  type  wait time category
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_wait(cs_timer_stats_wait_t   type,
+                        const cs_timer_t       *t0,
+                        const cs_timer_t       *t1)
+{
+  if (_n_stats < 1) return;
+
+  cs_timer_counter_add_diff(_wait_tot + type, t0, t1);
+
+  int id = _active_id[0];
+  if (id > -1)
+    cs_timer_counter_add_diff(&((_stats + id)->t_wait), t0, t1);
+
+  _trace_add(-1 - (int)type, t0, t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log distribution of timer statistics over ranks and threads,
+ *        and communication wait times.
+ *
+ * This function is collective, and should be called before
+ * \ref cs_timer_stats_finalize.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_log_finalize(void)
+{
+  if (_n_stats < 1)
+    return;
+
+  const int n_ranks = CS_MAX(cs_glob_n_ranks, 1);
+  const int n_threads = cs_glob_n_threads;
+  const int n_wait = CS_TIMER_STATS_N_WAIT_TYPES;
+
+  cs_timer_t t_now = cs_timer_time();
+
+  /* Local values: minimum, maximum and sum over ranks of statistic time,
+     sum of attributed wait time, and maximum thread imbalance;
+     minimum, maximum, and sum of wait time by category */
+
+  double *vals;
+  BFT_MALLOC(vals, _n_stats*5 + n_wait*3, double);
+
+  double *t_min = vals, *t_max = vals + _n_stats, *t_sum = vals + _n_stats*2;
+  double *w_sum = vals + _n_stats*3, *th_imb = vals + _n_stats*4;
+  double *c_min = vals + _n_stats*5;
+  double *c_max = c_min + n_wait, *c_sum = c_min + n_wait*2;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+    const cs_timer_stats_t  *s = _stats + stats_id;
+
+    double t = _total_wtime(s, &t_now);
+    t_min[stats_id] = t;
+    t_max[stats_id] = t;
+    t_sum[stats_id] = t;
+    w_sum[stats_id] = s->t_wait.wall_nsec*1e-9;
+
+    th_imb[stats_id] = 0;
+    if (s->t_thread != NULL) {
+      double th_max = 0, th_sum = 0;
+      for (int i = 0; i < n_threads; i++) {
+        double th_t = s->t_thread[i].wall_nsec*1e-9;
+        th_max = CS_MAX(th_max, th_t);
+        th_sum += th_t;
+      }
+      if (th_sum > 0)
+        th_imb[stats_id] = th_max / (th_sum/n_threads);
+    }
+
+  }
+
+  for (int i = 0; i < n_wait; i++) {
+    c_min[i] = _wait_tot[i].wall_nsec*1e-9;
+    c_max[i] = c_min[i];
+    c_sum[i] = c_min[i];
+  }
+
+  cs_parall_reduce_t *r = cs_parall_reduce_create();
+
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, _n_stats, CS_DOUBLE, t_min);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, _n_stats, CS_DOUBLE, t_max);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, _n_stats*2, CS_DOUBLE, t_sum);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, _n_stats, CS_DOUBLE, th_imb);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, n_wait, CS_DOUBLE, c_min);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, n_wait, CS_DOUBLE, c_max);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, n_wait, CS_DOUBLE, c_sum);
+
+  cs_parall_reduce_start(r);
+  cs_parall_reduce_finish(r);
+
+  cs_parall_reduce_destroy(&r);
+
+  /* Determine label width (root statistics are printed under their
+     tree name, others under their indented label) */
+
+  size_t name_width = 0;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    const cs_timer_stats_t  *s = _stats + stats_id;
+    size_t l = 0;
+    if (s->parent_id < 0)
+      l = cs_log_strlen(cs_map_name_to_id_reverse(_name_map, stats_id));
+    else {
+      l = cs_log_strlen(s->label);
+      for (int p_id = s->parent_id;
+           p_id > -1;
+           p_id = (_stats + p_id)->parent_id)
+        l += 2;
+    }
+    name_width = CS_MAX(name_width, l);
+  }
+  for (int i = 0; i < n_wait; i++) {
+    size_t l = cs_log_strlen(_(_wait_name[i]));
+    name_width = CS_MAX(name_width, l);
+  }
+  name_width = CS_MIN(name_width, 63);
+
+  /* Print timer statistics */
+
+  char tmp_s[64];
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nTimer statistics (elapsed time over ranks):\n\n"));
+
+  cs_log_strpad(tmp_s, "", name_width, 64);
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  %s        mean     minimum     maximum  imbalance"
+                  "   MPI wait"),
+                tmp_s);
+  if (n_threads > 1)
+    cs_log_printf(CS_LOG_PERFORMANCE, _("   threads"));
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+  /* Print trees in depth-first order, with root statistics named
+     by their tree (as their labels are usually identical) */
+
+  int *order;
+  BFT_MALLOC(order, _n_stats, int);
+  _tree_order(-1, 0, order);
+
+  for (int o_id = 0; o_id < _n_stats; o_id++) {
+
+    const int stats_id = order[o_id];
+    const cs_timer_stats_t  *s = _stats + stats_id;
+
+    char label[64];
+    int depth = 0;
+    for (int p_id = s->parent_id; p_id > -1; p_id = (_stats + p_id)->parent_id)
+      depth++;
+    if (depth == 0) {
+      if (o_id > 0)
+        cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+      snprintf(label, 63, "%s",
+               cs_map_name_to_id_reverse(_name_map, stats_id));
+    }
+    else
+      snprintf(label, 63, "%*s%s", depth*2, "", s->label);
+    label[63] = '\0';
+    cs_log_strpad(tmp_s, label, name_width, 64);
+
+    double t_mean = t_sum[stats_id] / n_ranks;
+    double imb = (t_mean > 0) ? t_max[stats_id] / t_mean : 1;
+    double w_pct = (t_sum[stats_id] > 0) ?
+      100. * w_sum[stats_id] / t_sum[stats_id] : 0;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %s %11.3f %11.3f %11.3f %10.3f %9.1f %%",
+                  tmp_s, t_mean, t_min[stats_id], t_max[stats_id],
+                  imb, w_pct);
+    if (n_threads > 1)
+      cs_log_printf(CS_LOG_PERFORMANCE, " %9.3f", th_imb[stats_id]);
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+  }
+
+  BFT_FREE(order);
+
+  /* Print communication wait times */
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nCommunication wait time (over ranks):\n\n"));
+
+  cs_log_strpad(tmp_s, "", name_width, 64);
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  %s        mean     minimum     maximum\n"),
+                tmp_s);
+
+  for (int i = 0; i < n_wait; i++) {
+    cs_log_strpad(tmp_s, _(_wait_name[i]), name_width, 64);
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %s %11.3f %11.3f %11.3f\n",
+                  tmp_s, c_sum[i] / n_ranks, c_min[i], c_max[i]);
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(vals);
 }
 
 /*----------------------------------------------------------------------------*/
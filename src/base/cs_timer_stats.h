@@ -43,6 +43,17 @@ BEGIN_C_DECLS
  * Public types
  *============================================================================*/
 
+/* Communication wait time categories */
+
+typedef enum {
+
+  CS_TIMER_STATS_WAIT_HALO,        /* halo synchronization */
+  CS_TIMER_STATS_WAIT_REDUCTION,   /* global reductions */
+
+  CS_TIMER_STATS_N_WAIT_TYPES
+
+} cs_timer_stats_wait_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -54,6 +65,10 @@ BEGIN_C_DECLS
  * This creates 2 statistic timer trees, whose roots ids are:
  * - 0 for computational operations
  * - 1 for computational stages
+ *
+ * If the CS_TIMER_STATS_TRACE environment variable is set, its value
+ * ("start_time_id" or "start_time_id:end_time_id") defines the range of
+ * traced time steps (see \ref cs_timer_stats_set_trace_options).
  */
 /*----------------------------------------------------------------------------*/
 
@@ -105,6 +120,27 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
                                 int                     n_buffer_steps,
                                 double                  flush_wtime);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set timer statistics event trace options.
+ *
+ * Events are traced for time ids in the [start_time_id, end_time_id]
+ * range, and written at the end of each traced time step to the
+ * "timer_stats_trace.json" file, using the Chrome trace event format
+ * (with one process per rank and one thread per statistics tree).
+ *
+ * This may also be set using the CS_TIMER_STATS_TRACE environment
+ * variable (see \ref cs_timer_stats_initialize).
+ *
+ * \param[in]  start_time_id  first traced time id, or -1 for no trace
+ * \param[in]  end_time_id    last traced time id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace_options(int  start_time_id,
+                                 int  end_time_id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -241,6 +277,58 @@ cs_timer_stats_add_diff(int  id,
                         const cs_timer_t    *t0,
                         const cs_timer_t    *t1);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a timing range for a given thread to a timer statistic.
+ *
+ * This is intended for timing of OpenMP regions, and may be called by
+ * each thread in a parallel region, using its own thread id. The main
+ * timer of the statistic is not modified.
+ *
+ * \param[in]  id         id of statistic
+ * \param[in]  thread_id  id of calling thread
+ * \param[in]  t0         oldest timer value
+ * \param[in]  t1         most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_thread_diff(int                id,
+                               int                thread_id,
+                               const cs_timer_t  *t0,
+                               const cs_timer_t  *t1);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a communication wait time range.
+ *
+ * The wait time is accounted for its category, and attributed to the
+ * currently active statistic of the operations tree.
+ *
+ * \param[in]  type  wait time category
+ * \param[in]  t0    oldest timer value
+ * \param[in]  t1    most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_wait(cs_timer_stats_wait_t   type,
+                        const cs_timer_t       *t0,
+                        const cs_timer_t       *t1);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log distribution of timer statistics over ranks and threads,
+ *        and communication wait times.
+ *
+ * This function is collective, and should be called before
+ * \ref cs_timer_stats_finalize.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_log_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define default timer statistics
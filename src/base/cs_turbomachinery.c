@@ -56,6 +56,7 @@
 #include "cs_join.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
+#include "cs_internal_coupling.h"
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
@@ -121,6 +122,18 @@ typedef struct {
                                                    boundary faces */
 
   int                       *cell_rotor_num;    /* cell rotation axis number */
+  int                       *vtx_rotor_num;     /* reference mesh vertex
+                                                   rotation axis number */
+
+  double                    *q_angle;           /* rotor angles associated
+                                                   with current mesh
+                                                   quantities */
+  int                        n_max_incr_updates; /* maximum number of
+                                                    successive incremental
+                                                    quantities updates */
+  int                        n_incr_updates;    /* current number of
+                                                   successive incremental
+                                                   quantities updates */
 
   bool active;
 
@@ -279,6 +292,10 @@ _turbomachinery_create(void)
   tbm->reference_mesh = cs_mesh_create();
   tbm->n_b_faces_ref = -1;
   tbm->cell_rotor_num = NULL;
+  tbm->vtx_rotor_num = NULL;
+  tbm->q_angle = NULL;
+  tbm->n_max_incr_updates = 100;
+  tbm->n_incr_updates = 0;
   tbm->model = CS_TURBOMACHINERY_NONE;
   tbm->n_couplings = 0;
 
@@ -383,6 +400,32 @@ _apply_sym_tensor_rotation(cs_real_t  matrix[3][4],
   t[5] = _t0[2][0];
 }
 
+/*----------------------------------------------------------------------------
+ * Apply a rotation to a (non-symmetric) 3x3 tensor: t <- R.t.Rt
+ *
+ * parameters:
+ *   m[3][4] <-- matrix of the transformation in homogeneous coord.
+ *               last line = [0; 0; 0; 1] (Not used here)
+ *   t[3][3] <-> tensor
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_apply_tensor_rotation(double     m[3][4],
+                       cs_real_t  t[3][3])
+{
+  double  _t[3][3];
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++)
+      _t[i][j] = m[i][0]*t[0][j] + m[i][1]*t[1][j] + m[i][2]*t[2][j];
+  }
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++)
+      t[i][j] = _t[i][0]*m[j][0] + _t[i][1]*m[j][1] + _t[i][2]*m[j][2];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute velocity relative to fixed coordinates at a given point
  *
@@ -617,26 +660,28 @@ _update_angle(cs_real_t  t)
 }
 
 /*----------------------------------------------------------------------------
- * Update mesh vertex positions
+ * Mark vertices belonging to rotors.
+ *
+ * As rotors and stators are disjoint in the reference mesh, and the
+ * reference mesh's topology does not change, this only needs to be done
+ * once; vertex numbering is identical for the reference mesh and its copies.
  *
  * parameters:
- *   mesh <-> mesh to update
- *   dt   <-- associated time delta (0 for current, unmodified time)
+ *   tbm  <-> turbomachinery options structure
+ *   mesh <-- reference mesh
  *----------------------------------------------------------------------------*/
 
 static void
-_update_geometry(cs_mesh_t  *mesh,
-                 cs_real_t   dt)
+_mark_rotor_vertices(cs_turbomachinery_t  *tbm,
+                     const cs_mesh_t      *mesh)
 {
-  cs_turbomachinery_t *tbm = _turbomachinery;
-
   cs_lnum_t  f_id, v_id;
 
-  cs_lnum_t  *vtx_rotor_num = NULL;
-
   const int  *cell_flag = tbm->cell_rotor_num;
 
-  BFT_MALLOC(vtx_rotor_num, mesh->n_vertices, cs_lnum_t);
+  BFT_REALLOC(tbm->vtx_rotor_num, mesh->n_vertices, int);
+
+  int *vtx_rotor_num = tbm->vtx_rotor_num;
 
   for (v_id = 0; v_id < mesh->n_vertices; v_id++)
     vtx_rotor_num[v_id] = 0;
@@ -673,6 +718,31 @@ _update_geometry(cs_mesh_t  *mesh,
         vtx_rotor_num[mesh->b_face_vtx_lst[i]] = cell_flag[c_id];
     }
   }
+}
+
+/*----------------------------------------------------------------------------
+ * Update mesh vertex positions
+ *
+ * Only rotor vertices are modified; their position is reset from the
+ * reference coordinates before rotation, so stator vertices are untouched.
+ *
+ * parameters:
+ *   mesh          <-> mesh to update
+ *   vtx_coord_ref <-- reference vertex coordinates (may be mesh->vtx_coord
+ *                     when the mesh is a fresh copy of the reference mesh)
+ *   dt            <-- associated time delta (0 for current, unmodified time)
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_geometry(cs_mesh_t        *mesh,
+                 const cs_real_t   vtx_coord_ref[],
+                 cs_real_t         dt)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  const int  *vtx_rotor_num = tbm->vtx_rotor_num;
+
+  assert(vtx_rotor_num != NULL);
 
   /* Now update coordinates */
 
@@ -689,14 +759,383 @@ _update_geometry(cs_mesh_t  *mesh,
                        m[j]);
   }
 
-  for (v_id = 0; v_id < mesh->n_vertices; v_id++) {
-    if (vtx_rotor_num[v_id] > 0)
-      _apply_vector_transfo(m[vtx_rotor_num[v_id]],
-                            &(mesh->vtx_coord[3*v_id]));
+  for (cs_lnum_t v_id = 0; v_id < mesh->n_vertices; v_id++) {
+    if (vtx_rotor_num[v_id] > 0) {
+      cs_real_t *c = mesh->vtx_coord + 3*v_id;
+      for (int k = 0; k < 3; k++)
+        c[k] = vtx_coord_ref[3*v_id + k];
+      _apply_vector_transfo(m[vtx_rotor_num[v_id]], c);
+    }
   }
 
   BFT_FREE(m);
-  BFT_FREE(vtx_rotor_num);
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether mesh quantities may be updated incrementally (by rigid
+ * rotation of rotor-related values) rather than fully recomputed.
+ *
+ * This requires that no quantity depends on values from both sides of
+ * a rotor/stator interface, and that no quantity undergoes other
+ * (periodic, porous, or corrective) transformations. Storage-related
+ * mesh quantity flags (reduced precision, memory-lean mode) do not
+ * prevent incremental updates.
+ *
+ * parameters:
+ *   tbm  <-- turbomachinery options structure
+ *   mesh <-- mesh
+ *   mq   <-- mesh quantities
+ *
+ * returns:
+ *   true if incremental update is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_incremental_quantities_update_ok(const cs_turbomachinery_t   *tbm,
+                                  const cs_mesh_t             *mesh,
+                                  const cs_mesh_quantities_t  *mq)
+{
+  bool retval = true;
+
+  /* Bad cell correction options (quantities depend on neighborhoods) */
+
+  const unsigned  correction_mask =   CS_BAD_CELLS_WARPED_CORRECTION
+                                    | CS_BAD_CELLS_REGULARISATION
+                                    | CS_CELL_FACE_CENTER_CORRECTION
+                                    | CS_CELL_CENTER_CORRECTION
+                                    | CS_FACE_DISTANCE_CLIP
+                                    | CS_FACE_RECONSTRUCTION_CLIP
+                                    | CS_CELL_VOLUME_RATIO_CORRECTION;
+
+  if (   tbm->q_angle == NULL
+      || tbm->n_incr_updates >= tbm->n_max_incr_updates
+      || mq->cell_cen == NULL)
+    retval = false;
+
+  else if (   mesh->n_init_perio > 0
+           || cs_glob_porous_model > 0
+           || (cs_glob_mesh_quantities_flag & correction_mask)
+           || cs_internal_coupling_n_couplings() > 0)
+    retval = false;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute rotation matrices from the rotor angles associated with current
+ * mesh quantities to the current rotor angles.
+ *
+ * parameters:
+ *   tbm   <-- turbomachinery options structure
+ *   m     --> incremental rotation matrix for each rotor
+ *   moved --> true for rotors which have moved
+ *----------------------------------------------------------------------------*/
+
+static void
+_incremental_rotations(const cs_turbomachinery_t  *tbm,
+                       cs_real_34_t                m[],
+                       bool                        moved[])
+{
+  moved[0] = false;
+
+  for (int j = 1; j < tbm->n_rotors+1; j++) {
+    cs_rotation_t *r = tbm->rotation + j;
+    double d_theta = r->angle - tbm->q_angle[j];
+    moved[j] = (fabs(d_theta) > 0) ? true : false;
+    cs_rotation_matrix(d_theta, r->axis, r->invariant, m[j]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Rotate cell-based mesh quantities (cell centers and gradient coupling
+ * tensors) of rotor cells.
+ *
+ * parameters:
+ *   tbm     <-- turbomachinery options structure
+ *   m       <-- incremental rotation matrix for each rotor
+ *   moved   <-- true for rotors which have moved
+ *   mesh    <-- mesh
+ *   n_cells <-- number of cells to handle (with or without ghosts)
+ *   mq      <-> mesh quantities
+ *----------------------------------------------------------------------------*/
+
+static void
+_rotate_cell_quantities(const cs_turbomachinery_t  *tbm,
+                        cs_real_34_t                m[],
+                        const bool                  moved[],
+                        const cs_mesh_t            *mesh,
+                        cs_lnum_t                   n_cells,
+                        cs_mesh_quantities_t       *mq)
+{
+  const int  *c_r_num = tbm->cell_rotor_num;
+
+  cs_real_3_t *cell_cen = (cs_real_3_t *)mq->cell_cen;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    int r_num = c_r_num[c_id];
+    if (moved[r_num] == false)
+      continue;
+    _apply_vector_transfo(m[r_num], cell_cen[c_id]);
+    if (mq->cocg_s_it != NULL)
+      _apply_tensor_rotation(m[r_num], mq->cocg_s_it[c_id]);
+    if (mq->cocg_it != NULL)
+      _apply_tensor_rotation(m[r_num], mq->cocg_it[c_id]);
+    if (mq->cocg_lsq != NULL)
+      _apply_tensor_rotation(m[r_num], mq->cocg_lsq[c_id]);
+    if (mq->cocg_lsq_r != NULL) {
+      cs_real_t t[3][3];
+      cs_mesh_quantities_sym_33_from_r(mq->cocg_lsq_r + 6*c_id, t);
+      _apply_tensor_rotation(m[r_num], t);
+      cs_mesh_quantities_sym_33_to_r((const cs_real_t (*)[3])t,
+                                     mq->cocg_lsq_r + 6*c_id);
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < mesh->n_b_cells; i++) {
+    int r_num = c_r_num[mesh->b_cells[i]];
+    if (moved[r_num] == false)
+      continue;
+    if (mq->cocgb_s_it != NULL)
+      _apply_tensor_rotation(m[r_num], mq->cocgb_s_it[i]);
+    if (mq->cocgb_s_lsq != NULL)
+      _apply_tensor_rotation(m[r_num], mq->cocgb_s_lsq[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update mesh quantities by rigid rotation of rotor-related values.
+ *
+ * Rotors and stators being disjoint, each cell and face moves rigidly with
+ * the rotor it belongs to, so scalar quantities (volumes, surfaces,
+ * distances, weights) are unchanged, points and vectors are rotated,
+ * and gradient coupling tensors are transformed as R.t.Rt. Stator
+ * quantities are untouched.
+ *
+ * The mesh quantities computation count is incremented, so that values
+ * cached on the mesh geometry (radiative transfer sweep orderings, ...)
+ * are updated. As cocg matrices (including their boundary conditions
+ * dependent part) are rotated consistently, the cocg computation count
+ * is not incremented, so gradient computations keep using them as is.
+ *
+ * parameters:
+ *   tbm  <-> turbomachinery options structure
+ *   mesh <-- mesh
+ *   mq   <-> mesh quantities
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_quantities_rigid(cs_turbomachinery_t   *tbm,
+                         const cs_mesh_t       *mesh,
+                         cs_mesh_quantities_t  *mq)
+{
+  const int  *c_r_num = tbm->cell_rotor_num;
+
+  /* Incremental rotation matrices (from angle of current quantities) */
+
+  cs_real_34_t  *m;
+  bool  *moved;
+
+  BFT_MALLOC(m, tbm->n_rotors+1, cs_real_34_t);
+  BFT_MALLOC(moved, tbm->n_rotors+1, bool);
+
+  _incremental_rotations(tbm, m, moved);
+
+  /* Cell-based quantities (including ghost cells) */
+
+  _rotate_cell_quantities(tbm,
+                          m,
+                          moved,
+                          mesh,
+                          mesh->n_cells_with_ghosts,
+                          mq);
+
+  /* Interior face quantities (both adjacent cells belong to the same rotor) */
+
+  cs_real_3_t *i_face_cog = (cs_real_3_t *)mq->i_face_cog;
+  cs_real_3_t *i_face_normal = (cs_real_3_t *)mq->i_face_normal;
+  cs_real_3_t *dijpf = (cs_real_3_t *)mq->dijpf;
+  cs_real_3_t *dofij = (cs_real_3_t *)mq->dofij;
+  cs_real_3_t *diipf = (cs_real_3_t *)mq->diipf;
+  cs_real_3_t *djjpf = (cs_real_3_t *)mq->djjpf;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    int r_num = c_r_num[mesh->i_face_cells[f_id][0]];
+    if (moved[r_num] == false)
+      continue;
+    _apply_vector_transfo(m[r_num], i_face_cog[f_id]);
+    _apply_vector_rotation(m[r_num], i_face_normal[f_id]);
+    _apply_vector_rotation(m[r_num], dijpf[f_id]);
+    _apply_vector_rotation(m[r_num], dofij[f_id]);
+    _apply_vector_rotation(m[r_num], diipf[f_id]);
+    _apply_vector_rotation(m[r_num], djjpf[f_id]);
+  }
+
+  /* Boundary face quantities */
+
+  cs_real_3_t *b_face_cog = (cs_real_3_t *)mq->b_face_cog;
+  cs_real_3_t *b_face_normal = (cs_real_3_t *)mq->b_face_normal;
+  cs_real_3_t *diipb = (cs_real_3_t *)mq->diipb;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+    int r_num = c_r_num[mesh->b_face_cells[f_id]];
+    if (moved[r_num] == false)
+      continue;
+    _apply_vector_transfo(m[r_num], b_face_cog[f_id]);
+    _apply_vector_rotation(m[r_num], b_face_normal[f_id]);
+    _apply_vector_rotation(m[r_num], diipb[f_id]);
+  }
+
+  BFT_FREE(moved);
+  BFT_FREE(m);
+
+  cs_mesh_quantities_increment_compute_count();
+}
+
+/*----------------------------------------------------------------------------
+ * Detach cell-based mesh quantities which may be reused after the next
+ * joining, rotating them to the current rotor angles.
+ *
+ * Joining modifies neither cells nor their numbering, so cell centers,
+ * volumes, and cocg matrices of owned cells remain valid once rotated
+ * for cells whose neighborhood is not modified by the new joining.
+ *
+ * parameters:
+ *   tbm  <-- turbomachinery options structure
+ *   mesh <-- mesh
+ *   mq   <-> mesh quantities (cell-based arrays are detached)
+ *
+ * returns:
+ *   quantities structure containing only the detached arrays
+ *----------------------------------------------------------------------------*/
+
+static cs_mesh_quantities_t *
+_detach_cell_quantities(const cs_turbomachinery_t  *tbm,
+                        const cs_mesh_t            *mesh,
+                        cs_mesh_quantities_t       *mq)
+{
+  cs_mesh_quantities_t *mq_prev = cs_mesh_quantities_create();
+
+  mq_prev->cell_cen = mq->cell_cen;
+  mq_prev->cell_vol = mq->cell_vol;
+  mq_prev->cocg_s_it = mq->cocg_s_it;
+  mq_prev->cocgb_s_it = mq->cocgb_s_it;
+  mq_prev->cocg_it = mq->cocg_it;
+  mq_prev->cocg_lsq = mq->cocg_lsq;
+  mq_prev->cocg_lsq_r = mq->cocg_lsq_r;
+  mq_prev->cocgb_s_lsq = mq->cocgb_s_lsq;
+
+  mq->cell_cen = NULL;
+  mq->cell_vol = NULL;
+  mq->cell_f_vol = NULL;
+  mq->cocg_s_it = NULL;
+  mq->cocgb_s_it = NULL;
+  mq->cocg_it = NULL;
+  mq->cocg_lsq = NULL;
+  mq->cocg_lsq_r = NULL;
+  mq->cocgb_s_lsq = NULL;
+
+  cs_real_34_t  *m;
+  bool  *moved;
+
+  BFT_MALLOC(m, tbm->n_rotors+1, cs_real_34_t);
+  BFT_MALLOC(moved, tbm->n_rotors+1, bool);
+
+  _incremental_rotations(tbm, m, moved);
+
+  _rotate_cell_quantities(tbm, m, moved, mesh, mesh->n_cells, mq_prev);
+
+  BFT_FREE(moved);
+  BFT_FREE(m);
+
+  return mq_prev;
+}
+
+/*----------------------------------------------------------------------------
+ * Flag cells adjacent to joined faces.
+ *
+ * Joining converts the selected boundary faces of the reference mesh
+ * to interior faces, so those cells are the ones whose number of
+ * boundary faces differs from that of the reference mesh.
+ *
+ * parameters:
+ *   tbm  <-- turbomachinery options structure
+ *   mesh <-- joined mesh
+ *
+ * returns:
+ *   newly allocated flag array (size: mesh->n_cells)
+ *----------------------------------------------------------------------------*/
+
+static bool *
+_joined_cells(const cs_turbomachinery_t  *tbm,
+              const cs_mesh_t            *mesh)
+{
+  const cs_mesh_t *r_mesh = tbm->reference_mesh;
+
+  int *n_c_b_faces;
+  BFT_MALLOC(n_c_b_faces, mesh->n_cells, int);
+
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++)
+    n_c_b_faces[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < r_mesh->n_b_faces; f_id++)
+    n_c_b_faces[r_mesh->b_face_cells[f_id]] += 1;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++)
+    n_c_b_faces[mesh->b_face_cells[f_id]] -= 1;
+
+  bool *c_joined;
+  BFT_MALLOC(c_joined, mesh->n_cells, bool);
+
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++)
+    c_joined[c_id] = (n_c_b_faces[c_id] != 0) ? true : false;
+
+  BFT_FREE(n_c_b_faces);
+
+  return c_joined;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether any rotor has moved since mesh quantities were last updated.
+ *
+ * parameters:
+ *   tbm  <-- turbomachinery options structure
+ *
+ * returns:
+ *   true if at least one rotor has moved, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_rotors_moved(const cs_turbomachinery_t  *tbm)
+{
+  bool retval = false;
+
+  if (tbm->q_angle == NULL)
+    retval = true;
+
+  else {
+    for (int j = 1; j < tbm->n_rotors+1; j++) {
+      if (fabs(tbm->rotation[j].angle - tbm->q_angle[j]) > 0)
+        retval = true;
+    }
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Save rotor angles associated with the current mesh quantities.
+ *
+ * parameters:
+ *   tbm  <-> turbomachinery options structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_save_quantities_angle(cs_turbomachinery_t  *tbm)
+{
+  BFT_REALLOC(tbm->q_angle, tbm->n_rotors+1, double);
+
+  for (int j = 0; j < tbm->n_rotors+1; j++)
+    tbm->q_angle[j] = tbm->rotation[j].angle;
 }
 
 /*----------------------------------------------------------------------------
@@ -815,21 +1254,30 @@ _update_mesh_coupling(double   t_cur_mob,
 
   tbm->active = true;
 
-  /* Cell and boundary face numberings can be moved from old mesh
-     to new one, as the corresponding parts of the mesh should not change */
-
-  _copy_mesh(tbm->reference_mesh, cs_glob_mesh);
-
-  /* Update geometry, if necessary */
+  /* Without joining, the mesh topology does not change, so only
+     rotor vertices need to be updated from the reference mesh */
 
   _update_angle(t_cur_mob);
 
   if (tbm->n_rotors > 0)
-    _update_geometry(cs_glob_mesh, 0);
+    _update_geometry(cs_glob_mesh, tbm->reference_mesh->vtx_coord, 0);
 
-  /* Recompute geometric quantities related to the mesh */
+  /* Update geometric quantities related to the mesh; rotor quantities
+     may simply be rotated, but are periodically fully recomputed to
+     avoid accumulating truncation errors */
 
-  cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+  if (_incremental_quantities_update_ok(tbm,
+                                        cs_glob_mesh,
+                                        cs_glob_mesh_quantities)) {
+    _update_quantities_rigid(tbm, cs_glob_mesh, cs_glob_mesh_quantities);
+    tbm->n_incr_updates += 1;
+  }
+  else {
+    cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+    tbm->n_incr_updates = 0;
+  }
+
+  _save_quantities_angle(tbm);
 
   /* Update linear algebra APIs relative to mesh */
 
@@ -879,6 +1327,20 @@ _update_mesh(bool     restart_mode,
     return;
   }
 
+  /* If no rotor has moved since the last update, the joined mesh and
+     all its related structures are unchanged, and may be kept as is */
+
+  _update_angle(t_cur_mob);
+
+  if (   restart_mode == false
+      && tbm->n_b_faces_ref > -1
+      && _rotors_moved(tbm) == false) {
+    t_end = cs_timer_wtime();
+    *t_elapsed = t_end - t_start;
+    cs_timer_stats_switch(t_top_id);
+    return;
+  }
+
   /* Cell and boundary face numberings can be moved from old mesh
      to new one, as the corresponding parts of the mesh should not change */
 
@@ -889,6 +1351,20 @@ _update_mesh(bool     restart_mode,
     cs_glob_mesh->cell_numbering = NULL;
   }
 
+  /* Similarly, cell-based quantities away from the joined faces
+     may be kept (up to rotation) */
+
+  cs_mesh_quantities_t *mq_prev = NULL;
+  cs_lnum_t n_b_cells_prev = cs_glob_mesh->n_b_cells;
+
+  if (   restart_mode == false
+      && _incremental_quantities_update_ok(tbm,
+                                           cs_glob_mesh,
+                                           cs_glob_mesh_quantities))
+    mq_prev = _detach_cell_quantities(tbm,
+                                      cs_glob_mesh,
+                                      cs_glob_mesh_quantities);
+
   /* Destroy previous global mesh and related entities */
 
   cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
@@ -902,8 +1378,6 @@ _update_mesh(bool     restart_mode,
   cs_glob_mesh_builder = cs_mesh_builder_create();
   cs_glob_mesh_quantities = cs_mesh_quantities_create();
 
-  _update_angle(t_cur_mob);
-
   if (restart_mode == false) {
 
     int n_retry = CS_MIN(tbm->n_max_join_tries, 1);
@@ -919,7 +1393,7 @@ _update_mesh(bool     restart_mode,
       /* Update geometry, if necessary */
 
       if (tbm->n_rotors > 0)
-        _update_geometry(cs_glob_mesh, eps_dt);
+        _update_geometry(cs_glob_mesh, cs_glob_mesh->vtx_coord, eps_dt);
 
       /* Reset the interior faces -> cells connectivity */
       /* (in order to properly build the halo of the joined mesh) */
@@ -1075,12 +1549,32 @@ _update_mesh(bool     restart_mode,
   if (cs_glob_mesh->verbosity > 0)
     cs_mesh_print_info(cs_glob_mesh, _("Mesh"));
 
-  /* Compute geometric quantities related to the mesh */
-
-  cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+  /* Compute geometric quantities related to the mesh; gradient
+     matrices are only recomputed near joined faces, but are periodically
+     fully recomputed to avoid accumulating truncation errors */
+
+  if (mq_prev != NULL && cs_glob_mesh->n_b_cells != n_b_cells_prev)
+    mq_prev = cs_mesh_quantities_destroy(mq_prev);
+
+  if (mq_prev != NULL) {
+    bool *c_joined = _joined_cells(tbm, cs_glob_mesh);
+    cs_mesh_quantities_compute_incremental(cs_glob_mesh,
+                                           cs_glob_mesh_quantities,
+                                           mq_prev,
+                                           c_joined);
+    BFT_FREE(c_joined);
+    mq_prev = cs_mesh_quantities_destroy(mq_prev);
+    tbm->n_incr_updates += 1;
+  }
+  else {
+    cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+    tbm->n_incr_updates = 0;
+  }
   cs_mesh_bad_cells_detect(cs_glob_mesh, cs_glob_mesh_quantities);
   cs_user_mesh_bad_cells_tag(cs_glob_mesh, cs_glob_mesh_quantities);
 
+  _save_quantities_angle(tbm);
+
   /* Initialize selectors and locations for the mesh */
 
   cs_mesh_init_selectors();
@@ -1419,6 +1913,11 @@ cs_turbomachinery_initialize(void)
 
   _select_rotor_cells(tbm);
 
+  /* Mark rotor vertices (vertex numbering is shared by the current
+     and reference meshes) */
+
+  _mark_rotor_vertices(tbm, cs_glob_mesh);
+
   /* Build the reference mesh that duplicates the global mesh before joining;
      first remove the boundary face numbering, as it will need to be
      rebuilt after the first joining */
@@ -1480,6 +1979,8 @@ cs_turbomachinery_finalize(void)
     BFT_FREE(tbm->rotation);
 
     BFT_FREE(tbm->cell_rotor_num);
+    BFT_FREE(tbm->vtx_rotor_num);
+    BFT_FREE(tbm->q_angle);
 
     if (tbm->reference_mesh != NULL)
       cs_mesh_destroy(tbm->reference_mesh);
@@ -1663,6 +2164,30 @@ cs_turbomachinery_set_rotation_retry(int     n_max_join_retries,
   tbm->dt_retry = dt_retry_multiplier;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set turbomachinery incremental mesh quantities update parameters.
+ *
+ * When no joining is used, the mesh topology is fixed, so mesh quantities
+ * related to rotors may be updated by a rigid rotation instead of being
+ * fully recomputed. With joining, gradient matrices of cells away from
+ * the joined faces are similarly rotated instead of being recomputed.
+ * A full recomputation is still done periodically to avoid accumulation
+ * of truncation errors.
+ *
+ * param[in]  n_max_incr_updates  maximum number of successive incremental
+ *                                updates (0 to always fully recompute)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbomachinery_set_incremental_update(int  n_max_incr_updates)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  tbm->n_max_incr_updates = n_max_incr_updates;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Rotation of vector and tensor fields.
@@ -268,6 +268,25 @@ void
 cs_turbomachinery_set_rotation_retry(int     n_max_join_retries,
                                      double  dt_retry_multiplier);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set turbomachinery incremental mesh quantities update parameters.
+ *
+ * When no joining is used, the mesh topology is fixed, so mesh quantities
+ * related to rotors may be updated by a rigid rotation instead of being
+ * fully recomputed. With joining, gradient matrices of cells away from
+ * the joined faces are similarly rotated instead of being recomputed.
+ * A full recomputation is still done periodically to avoid accumulation
+ * of truncation errors.
+ *
+ * param[in]  n_max_incr_updates  maximum number of successive incremental
+ *                                updates (0 to always fully recompute)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbomachinery_set_incremental_update(int  n_max_incr_updates);
+
 /*----------------------------------------------------------------------------
  * Rotation of vector and tensor fields.
  *
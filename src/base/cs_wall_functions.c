@@ -459,6 +459,165 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the friction velocity and \f$y^+\f$ / \f$u^+\f$ for
+ *        a batch of faces.
+ *
+ * This is equivalent to calling \ref cs_wall_functions_velocity for each
+ * face, with inputs and outputs given as arrays (of size n_faces),
+ * indexed by the position of the face in the batch. The wall function type
+ * is selected once for the whole batch, and faces are distributed
+ * among threads.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_faces       number of faces in batch
+ * \param[in]     face_ids      ids of faces in batch (for messages),
+ *                              or NULL
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     roughness     roughness
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cell in the viscous sublayer
+ * \param[in,out] nlogla        counter of cell in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_batch(cs_wall_f_type_t  iwallf,
+                                 cs_lnum_t         n_faces,
+                                 const cs_lnum_t   face_ids[],
+                                 const cs_real_t   l_visc[],
+                                 const cs_real_t   t_visc[],
+                                 const cs_real_t   vel[],
+                                 const cs_real_t   y[],
+                                 const cs_real_t   roughness[],
+                                 const cs_real_t   rnnb[],
+                                 const cs_real_t   kinetic_en[],
+                                 int               iuntur[],
+                                 cs_lnum_t        *nsubla,
+                                 cs_lnum_t        *nlogla,
+                                 cs_real_t         ustar[],
+                                 cs_real_t         uk[],
+                                 cs_real_t         yplus[],
+                                 cs_real_t         ypup[],
+                                 cs_real_t         cofimp[],
+                                 cs_real_t         dplus[])
+{
+  cs_lnum_t _nsubla = 0, _nlogla = 0;
+
+  /* Pseudo shift of the wall, 0 by default;
+     activation of wall function by default */
+
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    dplus[i] = 0.;
+    iuntur[i] = 1;
+  }
+
+  switch (iwallf) {
+
+  case CS_WALL_F_DISABLED:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      cs_wall_functions_disabled(l_visc[i], t_visc[i], vel[i], y[i],
+                                 iuntur + i, &_nsubla, &_nlogla,
+                                 ustar + i, uk + i, yplus + i, dplus + i,
+                                 ypup + i, cofimp + i);
+    break;
+
+  case CS_WALL_F_1SCALE_POWER:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      cs_wall_functions_1scale_power(l_visc[i], vel[i], y[i],
+                                     iuntur + i, &_nsubla, &_nlogla,
+                                     ustar + i, uk + i, yplus + i,
+                                     ypup + i, cofimp + i);
+    break;
+
+  case CS_WALL_F_1SCALE_LOG:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+      cs_lnum_t f_num = (face_ids != NULL) ? face_ids[i] + 1 : i + 1;
+      cs_wall_functions_1scale_log(f_num, l_visc[i], vel[i], y[i],
+                                   iuntur + i, &_nsubla, &_nlogla,
+                                   ustar + i, uk + i, yplus + i,
+                                   ypup + i, cofimp + i);
+    }
+    break;
+
+  case CS_WALL_F_2SCALES_LOG:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      cs_wall_functions_2scales_log(l_visc[i], t_visc[i], vel[i], y[i],
+                                    kinetic_en[i],
+                                    iuntur + i, &_nsubla, &_nlogla,
+                                    ustar + i, uk + i, yplus + i,
+                                    ypup + i, cofimp + i);
+    break;
+
+  case CS_WALL_F_SCALABLE_2SCALES_LOG:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      cs_wall_functions_2scales_scalable(l_visc[i], t_visc[i], vel[i], y[i],
+                                         kinetic_en[i],
+                                         iuntur + i, &_nsubla, &_nlogla,
+                                         ustar + i, uk + i, yplus + i,
+                                         dplus + i, ypup + i, cofimp + i);
+    break;
+
+  case CS_WALL_F_2SCALES_VDRIEST:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++) {
+      cs_real_t lmk;
+      cs_wall_functions_2scales_vdriest(rnnb[i], l_visc[i], vel[i], y[i],
+                                        kinetic_en[i],
+                                        iuntur + i, &_nsubla, &_nlogla,
+                                        ustar + i, uk + i, yplus + i,
+                                        ypup + i, cofimp + i,
+                                        &lmk, roughness[i], true);
+    }
+    break;
+
+  case CS_WALL_F_2SCALES_SMOOTH_ROUGH:
+#   pragma omp parallel for reduction(+:_nsubla, _nlogla) \
+                            if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      cs_wall_functions_2scales_smooth_rough(l_visc[i], t_visc[i], vel[i],
+                                             y[i], roughness[i],
+                                             kinetic_en[i],
+                                             iuntur + i, &_nsubla, &_nlogla,
+                                             ustar + i, uk + i, yplus + i,
+                                             dplus + i, ypup + i,
+                                             cofimp + i);
+    break;
+
+  default:
+    break;
+  }
+
+  *nsubla += _nsubla;
+  *nlogla += _nlogla;
+}
+
 /*-------------------------------------------------------------------------------*/
 
 /*!
@@ -258,7 +258,11 @@ cs_wall_functions_1scale_log(cs_lnum_t    ifac,
              / (log(ydvisc * ustaro) + cs_turb_xkappa * cs_turb_cstlog + 1.);
     }
 
+    /* Log output is not thread-safe (may be called from a threaded loop,
+       see cs_wall_functions_velocity_batch) */
+
     if (iter >= niter_max) {
+#     pragma omp critical
       bft_printf(_("WARNING: non-convergence in the computation\n"
                    "******** of the friction velocity\n\n"
                    "face number: %d \n"
@@ -1082,6 +1086,63 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
                            cs_real_t        *cofimp,
                            cs_real_t        *dplus);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the friction velocity and \f$y^+\f$ / \f$u^+\f$ for
+ *        a batch of faces.
+ *
+ * This is equivalent to calling \ref cs_wall_functions_velocity for each
+ * face, with inputs and outputs given as arrays (of size n_faces),
+ * indexed by the position of the face in the batch. The wall function type
+ * is selected once for the whole batch, and faces are distributed
+ * among threads.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_faces       number of faces in batch
+ * \param[in]     face_ids      ids of faces in batch (for messages),
+ *                              or NULL
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     roughness     roughness
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cell in the viscous sublayer
+ * \param[in,out] nlogla        counter of cell in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_batch(cs_wall_f_type_t  iwallf,
+                                 cs_lnum_t         n_faces,
+                                 const cs_lnum_t   face_ids[],
+                                 const cs_real_t   l_visc[],
+                                 const cs_real_t   t_visc[],
+                                 const cs_real_t   vel[],
+                                 const cs_real_t   y[],
+                                 const cs_real_t   roughness[],
+                                 const cs_real_t   rnnb[],
+                                 const cs_real_t   kinetic_en[],
+                                 int               iuntur[],
+                                 cs_lnum_t        *nsubla,
+                                 cs_lnum_t        *nlogla,
+                                 cs_real_t         ustar[],
+                                 cs_real_t         uk[],
+                                 cs_real_t         yplus[],
+                                 cs_real_t         ypup[],
+                                 cs_real_t         cofimp[],
+                                 cs_real_t         dplus[]);
+
 /*-------------------------------------------------------------------------------*/
 
 /*!
@@ -1023,8 +1023,10 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
                        connect->interfaces + CS_CDO_CONNECT_VTX_VECT,
                        connect->range_sets + CS_CDO_CONNECT_VTX_VECT);
 
-  /* CDO face-based schemes or HHO schemes with k=0 */
+  /* CDO face-based schemes or HHO schemes with k=0. The Navier-Stokes
+     solver relies on a face-based range set with 3 interlaced values */
   if ((fb_scheme_flag & CS_FLAG_SCHEME_SCALAR) ||
+      (fb_scheme_flag & CS_FLAG_SCHEME_NAVSTO) ||
       cs_flag_test(hho_scheme_flag,
                    CS_FLAG_SCHEME_SCALAR | CS_FLAG_SCHEME_POLY0))
     _assign_face_ifs_rs(mesh, n_faces, 1,
@@ -55,7 +55,9 @@
 #include "cs_math.h"
 #include "cs_navsto_coupling.h"
 #include "cs_navsto_param.h"
+#include "cs_parall.h"
 #include "cs_post.h"
+#include "cs_sles.h"
 #include "cs_source_term.h"
 #include "cs_timer.h"
 
@@ -90,6 +92,10 @@ BEGIN_C_DECLS
 #define CS_CDOFB_NAVSTO_DBG      0
 #define CS_CDOFB_NAVSTO_MODULO  10
 
+/* Size of the Krylov subspace before a restart of the flexible GMRES used
+   to solve the coupled velocity-pressure system */
+#define CS_CDOFB_NAVSTO_KRYLOV_RESTART  30
+
 /*! \struct cs_cdofb_navsto_t
  *  \brief Context related to CDO face-based discretization when dealing with
  *  vector-valued unknows
@@ -140,6 +146,14 @@ typedef struct {
 
   cs_real_t  *face_pressure;
 
+  /* \var div_op
+   * Cellwise discrete divergence operator (size 3*c2f->idx[n_cells]).
+   * Minus the outward area-weighted normal of each face of a cell. Only
+   * allocated when the velocity-pressure system is solved in a monolithic way
+   */
+
+  cs_real_t  *div_op;
+
   /*!
    * @}
    * @name Parameters of the algorithm
@@ -171,6 +185,42 @@ typedef struct {
 
 } cs_cdofb_navsto_t;
 
+/* Algebraic view of the coupled velocity-pressure system
+ *
+ *   | A   Bt | | u |   | f |
+ *   |        | |   | = |   |    with B = -div (face -> cell)
+ *   | B   0  | | p |   | 0 |
+ *
+ * Velocity DoFs are the (gathered) face DoFs of the momentum equation after
+ * static condensation. Pressure DoFs are located at cells. A vector of the
+ * coupled system is stored as [u (n_u values) | p (n_p values)]
+ */
+
+typedef struct {
+
+  cs_lnum_t              n_u;         /* number of gathered velocity DoFs */
+  cs_lnum_t              n_p;         /* number of pressure DoFs */
+  cs_lnum_t              n_u_scatter; /* number of local velocity DoFs */
+  cs_lnum_t              n_u_alloc;   /* allocated size of velocity buffers */
+
+  const cs_matrix_t     *a;           /* velocity block */
+  const cs_range_set_t  *rset;        /* parallel management of faces
+                                         (3 interlaced values per face) */
+  const cs_real_t       *div_op;      /* cellwise divergence operator */
+
+  cs_sles_t             *a_sles;      /* inner solver for the velocity block */
+  double                 a_eps;       /* tolerance of the inner solver */
+  int                    n_inner_iter;/* cumulated number of inner iter. */
+
+  cs_real_t             *inv_schur;   /* inverse of the diagonal approximation
+                                         of the pressure Schur complement */
+
+  cs_real_t             *u_buf;       /* velocity work buffers */
+  cs_real_t             *v_buf;
+  cs_real_t             *f_buf;
+
+} _saddle_system_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -216,6 +266,7 @@ _create_navsto_context(const cs_navsto_param_t  *nsp)
 
   nssc->face_velocity = NULL;
   nssc->face_pressure = NULL;
+  nssc->div_op = NULL;
 
   nssc->is_zeta_uniform = true;
 
@@ -225,6 +276,461 @@ _create_navsto_context(const cs_navsto_param_t  *nsp)
   return nssc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the cellwise discrete divergence operator. For each couple
+ *         (c, f), store minus the area-weighted normal of f oriented outward
+ *         with respect to c. Thus (B.u)_c = sum_f div_op(c,f).u_f
+ *
+ * \param[in]  quant     pointer to a \ref cs_cdo_quantities_t structure
+ * \param[in]  connect   pointer to a \ref cs_cdo_connect_t structure
+ *
+ * \return a pointer to a new allocated array
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_build_div_op(const cs_cdo_quantities_t   *quant,
+              const cs_cdo_connect_t      *connect)
+{
+  const cs_adjacency_t  *c2f = connect->c2f;
+
+  cs_real_t  *div_op = NULL;
+  BFT_MALLOC(div_op, 3*c2f->idx[quant->n_cells], cs_real_t);
+
+# pragma omp parallel for if (quant->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++) {
+
+      const cs_lnum_t  f_id = c2f->ids[j];
+      const cs_real_t  *nf = (f_id < quant->n_i_faces) ?
+        quant->i_face_normal + 3*f_id :
+        quant->b_face_normal + 3*(f_id - quant->n_i_faces);
+
+      for (int k = 0; k < 3; k++)
+        div_op[3*j+k] = -c2f->sgn[j] * nf[k];
+
+    }
+  }
+
+  return div_op;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the dot product of two vectors of the coupled system.
+ *         Velocity DoFs are gathered so that each DoF is owned by only one
+ *         rank and pressure DoFs are cellwise.
+ *
+ * \param[in]  sys    pointer to a _saddle_system_t structure
+ * \param[in]  x      first vector
+ * \param[in]  y      second vector
+ *
+ * \return the (global) value of the dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_saddle_dot(const _saddle_system_t   *sys,
+            const cs_real_t          *x,
+            const cs_real_t          *y)
+{
+  const cs_lnum_t  n = sys->n_u + sys->n_p;
+
+  double  s = 0;
+
+# pragma omp parallel for reduction(+:s) if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++)
+    s += x[i]*y[i];
+
+  cs_parall_sum(1, CS_DOUBLE, &s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the volume-weighted mean value of the pressure to zero
+ *
+ * \param[in, out] p     pressure values at cells
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_remove_pressure_mean(cs_real_t    *p)
+{
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+
+  double  s = 0;
+
+# pragma omp parallel for reduction(+:s) if (quant->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++)
+    s += quant->cell_vol[c_id]*p[c_id];
+
+  cs_parall_sum(1, CS_DOUBLE, &s);
+
+  const cs_real_t  mean = s/quant->vol_tot;
+
+# pragma omp parallel for if (quant->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++)
+    p[c_id] -= mean;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute b = B.u (minus the divergence of the face velocity)
+ *
+ * \param[in, out] sys    pointer to a _saddle_system_t structure
+ * \param[in]      u      gathered velocity DoFs
+ * \param[in, out] b      resulting values at cells
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_apply_div(_saddle_system_t     *sys,
+           const cs_real_t      *u,
+           cs_real_t            *b)
+{
+  const cs_adjacency_t  *c2f = cs_shared_connect->c2f;
+  const cs_real_t  *uf = u;
+
+  if (cs_glob_n_ranks > 1) { /* Values at shared faces are needed */
+
+    memcpy(sys->f_buf, u, sys->n_u*sizeof(cs_real_t));
+    cs_range_set_scatter(sys->rset,
+                         CS_REAL_TYPE, 3, // type and stride
+                         sys->f_buf,      // in: size = n_u
+                         sys->f_buf);     // out: size = n_u_scatter
+    uf = sys->f_buf;
+
+  }
+
+# pragma omp parallel for if (sys->n_p > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < sys->n_p; c_id++) {
+
+    cs_real_t  _b = 0;
+    for (cs_lnum_t j = c2f->idx[c_id]; j < c2f->idx[c_id+1]; j++)
+      _b += cs_math_3_dot_product(sys->div_op + 3*j,
+                                  uf + 3*c2f->ids[j]);
+
+    b[c_id] = _b;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute g = Bt.p (gradient of a cellwise pressure at faces)
+ *
+ * \param[in, out] sys    pointer to a _saddle_system_t structure
+ * \param[in]      p      pressure values at cells
+ * \param[in, out] g      resulting gathered velocity DoFs
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_apply_grad(_saddle_system_t     *sys,
+            const cs_real_t      *p,
+            cs_real_t            *g)
+{
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_adjacency_t  *f2c = cs_shared_connect->f2c;
+
+  cs_real_t  *gf = (cs_glob_n_ranks > 1) ? sys->f_buf : g;
+
+  /* Loop on faces so that each face value is written by only one thread.
+     The contribution of the couple (c, f) is -sgn(c,f).nf.p_c, which is
+     consistent with the cellwise divergence operator */
+# pragma omp parallel for if (quant->n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < quant->n_faces; f_id++) {
+
+    const cs_real_t  *nf = (f_id < quant->n_i_faces) ?
+      quant->i_face_normal + 3*f_id :
+      quant->b_face_normal + 3*(f_id - quant->n_i_faces);
+
+    cs_real_t  sp = 0;
+    for (cs_lnum_t j = f2c->idx[f_id]; j < f2c->idx[f_id+1]; j++)
+      sp -= f2c->sgn[j] * p[f2c->ids[j]];
+
+    cs_real_t  *_g = gf + 3*f_id;
+    for (int k = 0; k < 3; k++)
+      _g[k] = sp * nf[k];
+
+  }
+
+  if (cs_glob_n_ranks > 1) { /* Parallel mode */
+
+    cs_interface_set_sum(sys->rset->ifs,
+                         quant->n_faces, 3, true, CS_REAL_TYPE,
+                         gf);
+
+    cs_range_set_gather(sys->rset,
+                        CS_REAL_TYPE, 3, // type and stride
+                        gf,              // in: size = n_u_scatter
+                        g);              // out: size = n_u
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute y = K.x where K is the matrix of the coupled system
+ *
+ * \param[in, out] sys    pointer to a _saddle_system_t structure
+ * \param[in]      x      vector of the coupled system
+ * \param[in, out] y      resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_matvec(_saddle_system_t     *sys,
+               const cs_real_t      *x,
+               cs_real_t            *y)
+{
+  const cs_lnum_t  n_u = sys->n_u;
+
+  /* Velocity block (the input array may be synchronized) */
+  memcpy(sys->u_buf, x, n_u*sizeof(cs_real_t));
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_IGNORE, sys->a, sys->u_buf, y);
+
+  /* Pressure gradient */
+  _apply_grad(sys, x + n_u, sys->v_buf);
+
+# pragma omp parallel for if (n_u > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_u; i++)
+    y[i] += sys->v_buf[i];
+
+  /* Mass balance */
+  _apply_div(sys, x, y + n_u);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the block upper-triangular preconditioner
+ *
+ *           | A   Bt |
+ *           |        |    with S ~ B.A^-1.Bt = (1/mu) M_p
+ *           | 0   -S |
+ *
+ *         where M_p is the (diagonal) pressure mass matrix. The velocity
+ *         block is inverted inexactly thanks to the solver attached to the
+ *         momentum equation.
+ *
+ * \param[in, out] sys    pointer to a _saddle_system_t structure
+ * \param[in]      r      vector to precondition
+ * \param[in, out] z      preconditioned vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_saddle_precond(_saddle_system_t     *sys,
+                const cs_real_t      *r,
+                cs_real_t            *z)
+{
+  const cs_lnum_t  n_u = sys->n_u;
+  const cs_real_t  *r_p = r + n_u;
+
+  cs_real_t  *z_p = z + n_u;
+
+  /* Pressure block. The pressure is defined up to a constant */
+# pragma omp parallel for if (sys->n_p > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < sys->n_p; c_id++)
+    z_p[c_id] = -sys->inv_schur[c_id] * r_p[c_id];
+
+  _remove_pressure_mean(z_p);
+
+  /* Velocity block: A.z_u = r_u - Bt.z_p */
+  _apply_grad(sys, z_p, sys->v_buf);
+
+# pragma omp parallel for if (n_u > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_u; i++)
+    sys->v_buf[i] = r[i] - sys->v_buf[i];
+
+  memset(sys->u_buf, 0, sys->n_u_alloc*sizeof(cs_real_t));
+
+  int  n_iters = 0;
+  double  residual = DBL_MAX;
+
+  cs_sles_solve(sys->a_sles,
+                sys->a,
+                CS_HALO_ROTATION_IGNORE,
+                sys->a_eps,
+                1.0,       // r_norm
+                &n_iters,
+                &residual,
+                sys->v_buf,
+                sys->u_buf,
+                0,         // aux. size
+                NULL);     // aux. buffers
+
+  sys->n_inner_iter += n_iters;
+
+  memcpy(z, sys->u_buf, n_u*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve the coupled velocity-pressure system with a (right)
+ *         preconditioned flexible GMRES algorithm. The flexible variant
+ *         allows an inexact (iterative) inversion of the velocity block
+ *         inside the preconditioner.
+ *
+ * \param[in, out] sys        pointer to a _saddle_system_t structure
+ * \param[in]      b          right-hand side
+ * \param[in]      tol        relative tolerance on the residual
+ * \param[in]      n_max_iter max. number of iterations
+ * \param[in, out] x          initial guess (in) and solution (out)
+ * \param[out]     p_res      relative residual reached
+ *
+ * \return the number of iterations done
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_saddle_fgmres(_saddle_system_t     *sys,
+               const cs_real_t      *b,
+               double                tol,
+               int                   n_max_iter,
+               cs_real_t            *x,
+               double               *p_res)
+{
+  const int  m = CS_CDOFB_NAVSTO_KRYLOV_RESTART;
+  const cs_lnum_t  n = sys->n_u + sys->n_p;
+
+  int  n_iter = 0;
+  double  res = 0;
+
+  const double  b_norm = sqrt(_saddle_dot(sys, b, b));
+
+  if (b_norm < DBL_MIN) { /* Trivial solution */
+    memset(x, 0, n*sizeof(cs_real_t));
+    *p_res = 0;
+    return 0;
+  }
+
+  cs_real_t  *v = NULL, *z = NULL, *w = NULL;
+  BFT_MALLOC(v, (m+1)*n, cs_real_t);
+  BFT_MALLOC(z, m*n, cs_real_t);
+  BFT_MALLOC(w, n, cs_real_t);
+
+  double  *h = NULL, *g = NULL, *cs = NULL, *sn = NULL, *y = NULL;
+  BFT_MALLOC(h, (m+1)*m, double);
+  BFT_MALLOC(g, m+1, double);
+  BFT_MALLOC(cs, m, double);
+  BFT_MALLOC(sn, m, double);
+  BFT_MALLOC(y, m, double);
+
+  while (true) {
+
+    /* Residual: r = b - K.x stored in v_0 */
+    _saddle_matvec(sys, x, w);
+
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++)
+      v[i] = b[i] - w[i];
+
+    const double  beta = sqrt(_saddle_dot(sys, v, v));
+
+    res = beta/b_norm;
+    if (res < tol || n_iter >= n_max_iter)
+      break;
+
+    const double  inv_beta = 1./beta;
+#   pragma omp parallel for if (n > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n; i++)
+      v[i] *= inv_beta;
+
+    g[0] = beta;
+    for (int i = 1; i < m + 1; i++) g[i] = 0;
+
+    int  k = 0;
+    while (k < m && n_iter < n_max_iter) {
+
+      cs_real_t  *vk = v + k*n, *vk1 = v + (k+1)*n, *zk = z + k*n;
+
+      _saddle_precond(sys, vk, zk);
+      _saddle_matvec(sys, zk, w);
+
+      /* Modified Gram-Schmidt orthogonalization */
+      for (int i = 0; i < k + 1; i++) {
+
+        const cs_real_t  *vi = v + i*n;
+        const double  hik = _saddle_dot(sys, w, vi);
+
+#       pragma omp parallel for if (n > CS_THR_MIN)
+        for (cs_lnum_t l = 0; l < n; l++)
+          w[l] -= hik*vi[l];
+
+        h[i*m + k] = hik;
+
+      }
+
+      const double  hk1 = sqrt(_saddle_dot(sys, w, w));
+      h[(k+1)*m + k] = hk1;
+
+      if (hk1 > DBL_MIN) {
+        const double  inv_hk1 = 1./hk1;
+#       pragma omp parallel for if (n > CS_THR_MIN)
+        for (cs_lnum_t l = 0; l < n; l++)
+          vk1[l] = inv_hk1*w[l];
+      }
+
+      /* Apply the previous Givens rotations to the new column */
+      for (int i = 0; i < k; i++) {
+        const double  hi = h[i*m + k], hi1 = h[(i+1)*m + k];
+        h[i*m + k] = cs[i]*hi + sn[i]*hi1;
+        h[(i+1)*m + k] = -sn[i]*hi + cs[i]*hi1;
+      }
+
+      /* Compute and apply the new Givens rotation */
+      const double  hkk = h[k*m + k];
+      const double  nrm = sqrt(hkk*hkk + hk1*hk1);
+
+      cs[k] = hkk/nrm, sn[k] = hk1/nrm;
+      h[k*m + k] = nrm;
+      h[(k+1)*m + k] = 0;
+      g[k+1] = -sn[k]*g[k];
+      g[k] = cs[k]*g[k];
+
+      n_iter++, k++;
+
+      if (fabs(g[k])/b_norm < tol || hk1 <= DBL_MIN)
+        break;
+
+    } /* Arnoldi process */
+
+    /* Solve the upper triangular system H.y = g */
+    for (int i = k - 1; i > -1; i--) {
+      double  _y = g[i];
+      for (int j = i + 1; j < k; j++)
+        _y -= h[i*m + j]*y[j];
+      y[i] = _y/h[i*m + i];
+    }
+
+    /* Update the solution: x = x + Z.y */
+    for (int i = 0; i < k; i++) {
+      const cs_real_t  *zi = z + i*n;
+#     pragma omp parallel for if (n > CS_THR_MIN)
+      for (cs_lnum_t l = 0; l < n; l++)
+        x[l] += y[i]*zi[l];
+    }
+
+  } /* Restart loop */
+
+  BFT_FREE(v);
+  BFT_FREE(z);
+  BFT_FREE(w);
+  BFT_FREE(h);
+  BFT_FREE(g);
+  BFT_FREE(cs);
+  BFT_FREE(sn);
+  BFT_FREE(y);
+
+  *p_res = res;
+
+  return n_iter;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -293,6 +799,15 @@ cs_cdofb_navsto_init_uzawa_context(const cs_navsto_param_t     *nsp,
     (const cs_navsto_coupling_uzawa_t  *)nsc_input;
 
   cs_cdofb_navsto_context = nssc;
+
+  /* Face velocities are stored in the context of the momentum equation. The
+     mass balance is taken into account through the divergence operator */
+  if (!cs_equation_param_has_diffusion(cs_equation_get_param(nsc->momentum)))
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: A viscous term is needed in the momentum equation.\n",
+              __func__);
+
+  nssc->div_op = _build_div_op(cs_shared_quant, cs_shared_connect);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -423,6 +938,7 @@ cs_cdofb_navsto_free_context(const cs_navsto_param_t      *nsp)
   /* Free temporary buffers */
   if (nssc->face_velocity != NULL) BFT_FREE(nssc->face_velocity);
   if (nssc->face_pressure != NULL) BFT_FREE(nssc->face_pressure);
+  if (nssc->div_op != NULL) BFT_FREE(nssc->div_op);
 
   BFT_FREE(nssc);
 }
@@ -431,6 +947,10 @@ cs_cdofb_navsto_free_context(const cs_navsto_param_t      *nsp)
 /*!
  * \brief  Solve the Navier-Stokes system with a CDO face-based scheme using
  *         a Uzawa-Lagrangian Augmented approach.
+ *         The velocity-pressure system is solved in a monolithic way with a
+ *         flexible GMRES algorithm preconditioned by a block upper-triangular
+ *         operator (inexact velocity block and diagonal approximation of the
+ *         pressure Schur complement).
  *
  * \param[in]      mesh        pointer to a \ref cs_mesh_t structure
  * \param[in]      dt_cur      current value of the time step
@@ -446,14 +966,164 @@ cs_cdofb_navsto_uzawa_compute(const cs_mesh_t              *mesh,
                               const cs_navsto_param_t      *nsp,
                               void                         *nsc_input)
 {
-  CS_UNUSED(dt_cur);
-
   cs_cdofb_navsto_t  *nssc = cs_cdofb_navsto_context;
   cs_navsto_coupling_uzawa_t  *nscc = (cs_navsto_coupling_uzawa_t  *)nsc_input;
 
   cs_timer_t  t0 = cs_timer_time();
 
-  /* TODO */
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_lnum_t  n_cells = quant->n_cells;
+
+  cs_equation_t  *mom_eq = nscc->momentum;
+  const cs_equation_param_t  *mom_eqp = mom_eq->param;
+
+  /* Build the velocity block (after static condensation) and its right-hand
+     side. The pressure gradient and the mass balance are applied in a
+     matrix-free way. */
+  cs_equation_build_system(mesh, cs_shared_time_step, dt_cur, mom_eq);
+
+  _saddle_system_t  sys;
+
+  /* Face-based range set: one entity per face with 3 interlaced values.
+     Its ownership and ordering match those of the range set of the momentum
+     equation (one entity per velocity component). */
+  sys.rset = cs_shared_connect->range_sets[CS_CDO_CONNECT_FACE_SP0];
+
+  if (cs_glob_n_ranks > 1 && sys.rset == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: No face range set is available.\n", __func__);
+
+  sys.n_u = (cs_glob_n_ranks > 1) ?
+    3*sys.rset->n_elts[0] : mom_eq->n_sles_gather_elts;
+  sys.n_p = n_cells;
+  sys.n_u_scatter = 3*quant->n_faces;
+  sys.n_u_alloc = CS_MAX(sys.n_u_scatter,
+                         cs_matrix_get_n_columns(mom_eq->matrix));
+  sys.a = mom_eq->matrix;
+
+  assert(sys.n_u == mom_eq->n_sles_gather_elts);
+  assert(sys.n_u_scatter == mom_eq->n_sles_scatter_elts);
+  sys.div_op = nssc->div_op;
+  sys.a_sles = cs_sles_find_or_add(mom_eq->field_id, NULL);
+  sys.a_eps = mom_eqp->itsol_info.eps;
+  sys.n_inner_iter = 0;
+
+  BFT_MALLOC(sys.u_buf, sys.n_u_alloc, cs_real_t);
+  BFT_MALLOC(sys.v_buf, sys.n_u_alloc, cs_real_t);
+  BFT_MALLOC(sys.f_buf, sys.n_u_scatter, cs_real_t);
+
+  /* Diagonal approximation of the pressure Schur complement: the pressure
+     mass matrix scaled by the inverse of the viscosity */
+  const cs_property_t  *visc = mom_eqp->diffusion_property;
+
+  BFT_MALLOC(sys.inv_schur, n_cells, cs_real_t);
+
+  if (cs_property_is_uniform(visc)) {
+
+    const cs_real_t  mu = cs_property_get_cell_value(0, visc);
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      sys.inv_schur[c_id] = mu/quant->cell_vol[c_id];
+
+  }
+  else {
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      sys.inv_schur[c_id] =
+        cs_property_get_cell_value(c_id, visc)/quant->cell_vol[c_id];
+
+  }
+
+  /* Initial guess and right-hand side of the coupled system */
+  const cs_lnum_t  n_tot = sys.n_u + sys.n_p;
+
+  cs_real_t  *x = NULL, *b = NULL;
+  BFT_MALLOC(x, n_tot, cs_real_t);
+  BFT_MALLOC(b, CS_MAX(n_tot, sys.n_u_scatter), cs_real_t);
+
+  const cs_real_t  *f_values = mom_eq->get_extra_values(mom_eq->scheme_context);
+
+  memcpy(sys.f_buf, f_values, sys.n_u_scatter*sizeof(cs_real_t));
+  memcpy(b, mom_eq->rhs, sys.n_u_scatter*sizeof(cs_real_t));
+
+  if (cs_glob_n_ranks > 1) { /* Parallel mode */
+
+    cs_range_set_gather(sys.rset,
+                        CS_REAL_TYPE, 3, // type and stride
+                        sys.f_buf,       // in: size = n_u_scatter
+                        sys.f_buf);      // out: size = n_u
+
+    /* Contributions from distant ranks may contribute to an element owned by
+       the local rank */
+    cs_interface_set_sum(sys.rset->ifs,
+                         quant->n_faces, 3, true, CS_REAL_TYPE,
+                         b);
+
+    cs_range_set_gather(sys.rset,
+                        CS_REAL_TYPE, 3, // type and stride
+                        b,               // in: size = n_u_scatter
+                        b);              // out: size = n_u
+
+  }
+
+  memcpy(x, sys.f_buf, sys.n_u*sizeof(cs_real_t));
+  memcpy(x + sys.n_u, nssc->pressure->val, n_cells*sizeof(cs_real_t));
+  memset(b + sys.n_u, 0, n_cells*sizeof(cs_real_t));
+
+  /* Solve the coupled system */
+  double  residual = DBL_MAX;
+  int  n_iters = _saddle_fgmres(&sys, b,
+                                nsp->residual_tolerance,
+                                nsp->n_max_algo_iter,
+                                x,
+                                &residual);
+
+  _remove_pressure_mean(x + sys.n_u);
+
+  if (nsp->verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "  <NavSto/Uzawa> n_iters %d residual % -8.4e"
+                  " velocity block n_iters %d\n",
+                  n_iters, residual, sys.n_inner_iter);
+
+  if (residual > nsp->residual_tolerance)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  " %s: Warning: the coupled velocity-pressure system has not"
+                  " converged (residual % -8.4e)\n", __func__, residual);
+
+  /* Update the velocity field (face and cell values) */
+  cs_real_t  *u_sol = sys.f_buf;
+  memcpy(u_sol, x, sys.n_u*sizeof(cs_real_t));
+
+  if (cs_glob_n_ranks > 1)  /* Parallel mode */
+    cs_range_set_scatter(sys.rset,
+                         CS_REAL_TYPE, 3, // type and stride
+                         u_sol,
+                         u_sol);
+
+  cs_field_current_to_previous(nssc->velocity);
+
+  mom_eq->update_field(u_sol, mom_eq->rhs, mom_eqp,
+                       mom_eq->builder, mom_eq->scheme_context,
+                       nssc->velocity->val);
+
+  if (mom_eqp->flag & CS_EQUATION_UNSTEADY)
+    mom_eq->do_build = true;
+
+  /* Update the pressure field */
+  cs_field_current_to_previous(nssc->pressure);
+  memcpy(nssc->pressure->val, x + sys.n_u, n_cells*sizeof(cs_real_t));
+
+  /* Free memory */
+  BFT_FREE(x);
+  BFT_FREE(b);
+  BFT_FREE(sys.u_buf);
+  BFT_FREE(sys.v_buf);
+  BFT_FREE(sys.f_buf);
+  BFT_FREE(sys.inv_schur);
+  BFT_FREE(mom_eq->rhs);
+  cs_sles_free(sys.a_sles);
+  cs_matrix_destroy(&(mom_eq->matrix));
 
   cs_timer_t  t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(nssc->timer), &t0, &t1);
@@ -159,6 +159,10 @@ cs_cdofb_navsto_free_context(const cs_navsto_param_t      *nsp);
 /*!
  * \brief  Solve the Navier-Stokes system with a CDO face-based scheme using
  *         a Uzawa-Lagrangian Augmented approach.
+ *         The velocity-pressure system is solved in a monolithic way with a
+ *         flexible GMRES algorithm preconditioned by a block upper-triangular
+ *         operator (inexact velocity block and diagonal approximation of the
+ *         pressure Schur complement).
  *
  * \param[in]      mesh        pointer to a \ref cs_mesh_t structure
  * \param[in]      dt_cur      current value of the time step
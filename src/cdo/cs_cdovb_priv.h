@@ -54,6 +54,10 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Cache of cellwise stiffness matrices (defined in cs_cdovb_scaleq.c) */
+
+typedef struct _cs_cdovb_stiffness_cache_t cs_cdovb_stiffness_cache_t;
+
 /*=============================================================================
  * Structure definitions
  *============================================================================*/
@@ -74,6 +78,10 @@ struct _cs_cdovb_t {
   cs_cdo_diffusion_enforce_dir_t  *enforce_dirichlet;
   cs_cdo_diffusion_flux_trace_t   *boundary_flux_op;
 
+  /* Cache of the cellwise stiffness matrices. Only used for scalar-valued
+     equations when the diffusion property is steady (NULL otherwise) */
+  cs_cdovb_stiffness_cache_t      *stiffness_cache;
+
   /* Pointer of function to build the advection term */
   cs_cdo_advection_t              *get_advection_matrix;
   cs_cdo_advection_bc_t           *add_advection_bc;
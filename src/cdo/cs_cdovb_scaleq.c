@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <float.h>
+#include <limits.h>
 #include <assert.h>
 #include <string.h>
 
@@ -55,6 +56,7 @@
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
 #include "cs_param.h"
 #include "cs_post.h"
 #include "cs_quadrature.h"
@@ -124,6 +126,30 @@ struct _cs_cdovb_scaleq_t {
 
 };
 
+/* Cache of the cellwise stiffness matrices (only the upper triangular part
+   of each matrix is stored). The first n_cells cells are cached according
+   to the memory budget. Cached matrices are reset when the mesh quantities
+   or the values defining the diffusion property change. */
+
+struct _cs_cdovb_stiffness_cache_t {
+
+  bool                         is_filled;   /* true if values may be used */
+  cs_lnum_t                    n_cells;     /* number of cached cells */
+  cs_lnum_t                   *idx;         /* size: n_cells + 1 */
+  cs_real_t                   *val;         /* size: idx[n_cells] */
+
+  /* State used to build the cached matrices */
+
+  const cs_cdo_quantities_t   *quant;       /* associated mesh quantities */
+  int                          fvq_count;   /* mesh quantities computation
+                                               count (changes with in-place
+                                               geometry updates) */
+  int                          n_pty_vals;  /* number of property values */
+  cs_real_t                   *pty_vals;    /* values of property definitions
+                                               (all defined by value) */
+
+};
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -186,6 +212,217 @@ _cell_builder_create(const cs_cdo_connect_t   *connect)
   return cb;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Allocate the cache of cellwise stiffness matrices according to the
+ *          memory budget set in the equation parameters
+ *
+ * \param[in]      eqp       pointer to a cs_equation_param_t structure
+ * \param[in]      connect   pointer to a cs_cdo_connect_t structure
+ * \param[in, out] eqc       pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_init_stiffness_cache(const cs_equation_param_t   *eqp,
+                      const cs_cdo_connect_t      *connect,
+                      cs_cdovb_scaleq_t           *eqc)
+{
+  const cs_lnum_t  n_cells = connect->n_cells;
+  const cs_lnum_t  *c2v_idx = connect->c2v->idx;
+
+  cs_lnum_t  max_size = -1;
+  if (eqp->diffusion_cache_mb > 0) {
+    double  _max_size = eqp->diffusion_cache_mb*1048576./sizeof(cs_real_t);
+    max_size = (_max_size > INT_MAX) ? -1 : (cs_lnum_t)_max_size;
+  }
+
+  cs_cdovb_stiffness_cache_t  *cache = NULL;
+  BFT_MALLOC(cache, 1, cs_cdovb_stiffness_cache_t);
+
+  cache->is_filled = false;
+  cache->quant = NULL;
+  cache->fvq_count = -1;
+  cache->n_pty_vals = 0;
+  cache->pty_vals = NULL;
+
+  BFT_MALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+  cache->idx[0] = 0;
+
+  cs_lnum_t  c_id = 0;
+  for (c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n_vc = c2v_idx[c_id+1] - c2v_idx[c_id];
+    const cs_lnum_t  end = cache->idx[c_id] + n_vc*(n_vc+1)/2;
+    if (max_size > -1 && end > max_size)
+      break;
+    cache->idx[c_id+1] = end;
+  }
+
+  cache->n_cells = c_id;
+  BFT_REALLOC(cache->idx, cache->n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(cache->val, cache->idx[cache->n_cells], cs_real_t);
+
+  if (cache->n_cells < n_cells)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  " %s: Cache of stiffness matrices limited to %ld cells"
+                  " out of %ld (memory budget: %.1f MiB)\n",
+                  __func__, (long)cache->n_cells, (long)n_cells,
+                  eqp->diffusion_cache_mb);
+
+  eqc->stiffness_cache = cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the cache of cellwise stiffness matrices
+ *
+ * \param[in, out] eqc       pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_stiffness_cache(cs_cdovb_scaleq_t           *eqc)
+{
+  cs_cdovb_stiffness_cache_t  *cache = eqc->stiffness_cache;
+
+  if (cache == NULL)
+    return;
+
+  BFT_FREE(cache->idx);
+  BFT_FREE(cache->val);
+  BFT_FREE(cache->pty_vals);
+  BFT_FREE(eqc->stiffness_cache);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if the cached stiffness matrices were built with the
+ *          current mesh quantities and diffusion property values.
+ *          If not, the cache is reset and the current state is saved.
+ *
+ * \param[in]      eqp       pointer to a cs_equation_param_t structure
+ * \param[in]      quant     pointer to a cs_cdo_quantities_t structure
+ * \param[in, out] eqc       pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_check_stiffness_cache(const cs_equation_param_t   *eqp,
+                       const cs_cdo_quantities_t   *quant,
+                       cs_cdovb_scaleq_t           *eqc)
+{
+  cs_cdovb_stiffness_cache_t  *cache = eqc->stiffness_cache;
+
+  if (cache == NULL)
+    return;
+
+  const cs_property_t  *pty = eqp->diffusion_property;
+
+  /* The property is not only defined by values anymore: stop using
+     the cache */
+  for (int i = 0; i < pty->n_definitions; i++) {
+    if (pty->defs[i]->type != CS_XDEF_BY_VALUE) {
+      _free_stiffness_cache(eqc);
+      return;
+    }
+  }
+
+  int  n_pty_vals = 0;
+  for (int i = 0; i < pty->n_definitions; i++)
+    n_pty_vals += pty->defs[i]->dim;
+
+  /* Geometry may be updated in place (mesh deformation, rotor motion),
+     so also check the count of mesh quantities computations */
+  const int  fvq_count = cs_mesh_quantities_compute_count();
+
+  bool  is_same = (   cache->quant == quant
+                   && cache->fvq_count == fvq_count
+                   && cache->n_pty_vals == n_pty_vals);
+
+  for (int i = 0, shift = 0; i < pty->n_definitions && is_same; i++) {
+    const cs_xdef_t  *def = pty->defs[i];
+    if (memcmp(cache->pty_vals + shift, def->input,
+               def->dim*sizeof(cs_real_t)) != 0)
+      is_same = false;
+    shift += def->dim;
+  }
+
+  if (is_same)
+    return;
+
+  cs_cdovb_scaleq_reset_stiffness_cache(eqc);
+
+  cache->quant = quant;
+  cache->fvq_count = fvq_count;
+  cache->n_pty_vals = n_pty_vals;
+  BFT_REALLOC(cache->pty_vals, n_pty_vals, cs_real_t);
+
+  for (int i = 0, shift = 0; i < pty->n_definitions; i++) {
+    const cs_xdef_t  *def = pty->defs[i];
+    memcpy(cache->pty_vals + shift, def->input, def->dim*sizeof(cs_real_t));
+    shift += def->dim;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Store the upper triangular part of a local stiffness matrix in
+ *          the cache
+ *
+ * \param[in]      c_id    id of the current cell
+ * \param[in]      loc     local stiffness matrix
+ * \param[in, out] eqc     pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_store_stiffness(cs_lnum_t                c_id,
+                 const cs_sdm_t          *loc,
+                 cs_cdovb_scaleq_t       *eqc)
+{
+  const cs_cdovb_stiffness_cache_t  *cache = eqc->stiffness_cache;
+  const int  n = loc->n_rows;
+  cs_real_t  *val = cache->val + cache->idx[c_id];
+
+  for (int i = 0; i < n; i++) {
+    const cs_real_t  *row = loc->val + i*n;
+    for (int j = i; j < n; j++)
+      *val++ = row[j];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Retrieve a local stiffness matrix from the cache
+ *
+ * \param[in]      c_id    id of the current cell
+ * \param[in]      n_vc    number of vertices in the current cell
+ * \param[in]      eqc     pointer to a cs_cdovb_scaleq_t structure
+ * \param[in, out] loc     local stiffness matrix to set
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_load_stiffness(cs_lnum_t                  c_id,
+                int                        n_vc,
+                const cs_cdovb_scaleq_t   *eqc,
+                cs_sdm_t                  *loc)
+{
+  const cs_cdovb_stiffness_cache_t  *cache = eqc->stiffness_cache;
+  const cs_real_t  *val = cache->val + cache->idx[c_id];
+
+  cs_sdm_square_init(n_vc, loc);
+
+  for (int i = 0; i < n_vc; i++) {
+    cs_real_t  *row = loc->val + i*n_vc;
+    row[i] = *val++;
+    for (int j = i + 1; j < n_vc; j++) {
+      row[j] = *val;
+      loc->val[j*n_vc + i] = *val++;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Initialize the local structure for the current cell
@@ -448,6 +685,8 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
   eqc->boundary_flux_op = NULL;
   eqc->enforce_dirichlet = NULL;
 
+  eqc->stiffness_cache = NULL;
+
   if (cs_equation_param_has_diffusion(eqp)) {
 
     switch (eqp->diffusion_hodge.algo) {
@@ -499,6 +738,12 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
     }
 
+    /* Stiffness matrices are kept from one time step to another only if the
+       diffusion property does not vary in time */
+    if (eqp->diffusion_cache &&
+        cs_property_is_steady(eqp->diffusion_property))
+      _init_stiffness_cache(eqp, connect, eqc);
+
   } // Has diffusion
 
   /* Advection part */
@@ -674,6 +919,7 @@ cs_cdovb_scaleq_free_context(void   *builder)
     return eqc;
 
   BFT_FREE(eqc->source_terms);
+  _free_stiffness_cache(eqc);
 
   /* Last free */
   BFT_FREE(eqc);
@@ -681,6 +927,28 @@ cs_cdovb_scaleq_free_context(void   *builder)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cellwise stiffness matrices kept in cache (if any).
+ *         This is done automatically when building the system if the mesh
+ *         quantities or the diffusion property values changed. The cache is
+ *         filled again during the next build.
+ *
+ * \param[in, out]  data    pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_reset_stiffness_cache(void   *data)
+{
+  cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)data;
+
+  if (eqc == NULL || eqc->stiffness_cache == NULL)
+    return;
+
+  eqc->stiffness_cache->is_filled = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute the contributions of source terms (store inside builder)
@@ -863,6 +1131,17 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
 
   cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)data;
 
+  /* Cached stiffness matrices are reset if the mesh or the diffusion
+     property values changed since they were computed */
+  _check_stiffness_cache(eqp, quant, eqc);
+
+  cs_lnum_t  n_cached_cells = 0;
+  bool  cache_is_filled = false;
+  if (eqc->stiffness_cache != NULL) {
+    n_cached_cells = eqc->stiffness_cache->n_cells;
+    cache_is_filled = eqc->stiffness_cache->is_filled;
+  }
+
   /* Compute the values of the Dirichlet BC */
   cs_real_t  *dir_values =
     cs_equation_compute_dirichlet_vb(mesh,
@@ -895,7 +1174,7 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
 
 #pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
   shared(dt_cur, quant, connect, eqp, eqb, eqc, rhs, matrix, mav,       \
-         dir_values, neu_tags, field_val,                               \
+         dir_values, neu_tags, field_val, n_cached_cells, cache_is_filled, \
          cs_cdovb_cell_sys, cs_cdovb_cell_bld)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -965,7 +1244,17 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
 #endif
 
         // local matrix owned by the cellwise builder (store in cb->loc)
-        eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+        if (c_id < n_cached_cells && cache_is_filled)
+          _load_stiffness(c_id, cm->n_vc, eqc, cb->loc);
+
+        else {
+
+          eqc->get_stiffness_matrix(eqp->diffusion_hodge, cm, cb);
+
+          if (c_id < n_cached_cells)
+            _store_stiffness(c_id, cb->loc, eqc);
+
+        }
 
         // Add the local diffusion operator to the local system
         cs_sdm_add(csys->mat, cb->loc);
@@ -1116,6 +1405,10 @@ cs_cdovb_scaleq_build_system(const cs_mesh_t            *mesh,
 
   } // OPENMP Block
 
+  /* Cached stiffness matrices are valid for the next builds */
+  if (eqc->stiffness_cache != NULL)
+    eqc->stiffness_cache->is_filled = true;
+
   cs_matrix_assembler_values_done(mav); // optional
 
   /* Free temporary buffers and structures */
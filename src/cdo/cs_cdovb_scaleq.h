@@ -145,6 +145,20 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 void *
 cs_cdovb_scaleq_free_context(void   *builder);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cellwise stiffness matrices kept in cache (if any).
+ *         This is done automatically when building the system if the mesh
+ *         quantities or the diffusion property values changed. The cache is
+ *         filled again during the next build.
+ *
+ * \param[in, out]  data    pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_reset_stiffness_cache(void   *data);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute the contributions of source terms (store inside builder)
@@ -280,6 +280,9 @@ cs_cdovb_vecteq_init_context(const cs_equation_param_t   *eqp,
   eqc->boundary_flux_op = NULL;
   eqc->enforce_dirichlet = NULL;
 
+  /* No cache of stiffness matrices for vector-valued equations */
+  eqc->stiffness_cache = NULL;
+
   if (cs_equation_param_has_diffusion(eqp)) {
 
     switch (eqp->diffusion_hodge.algo) {
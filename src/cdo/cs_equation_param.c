@@ -413,6 +413,8 @@ cs_equation_create_param(cs_equation_type_t     type,
   eqp->diffusion_hodge.type = CS_PARAM_HODGE_TYPE_EPFD;
   eqp->diffusion_hodge.algo = CS_PARAM_HODGE_ALGO_COST;
   eqp->diffusion_hodge.coef = 1./3.; // DGA algo.
+  eqp->diffusion_cache = false;
+  eqp->diffusion_cache_mb = 0;
 
   /* Advection term */
   eqp->adv_formulation = CS_PARAM_ADVECTION_FORM_CONSERV;
@@ -617,6 +619,27 @@ cs_equation_set_param(cs_equation_param_t   *eqp,
     }
     break;
 
+  case CS_EQKEY_HODGE_DIFF_CACHE:
+    if (strcmp(val, "false") == 0)
+      eqp->diffusion_cache = false;
+    else if (strcmp(val, "true") == 0) {
+      eqp->diffusion_cache = true;
+      eqp->diffusion_cache_mb = 0;
+    }
+    else {
+      eqp->diffusion_cache_mb = atof(val);
+      if (eqp->diffusion_cache_mb > 0)
+        eqp->diffusion_cache = true;
+      else {
+        const char *_val = val;
+        bft_error(__FILE__, __LINE__, 0,
+                  _(" Invalid val %s related to key CS_EQKEY_HODGE_DIFF_CACHE\n"
+                    " Choice between true, false or a memory size in MiB"),
+                  _val);
+      }
+    }
+    break;
+
   case CS_EQKEY_HODGE_TIME_ALGO:
     if (strcmp(val,"cost") == 0)
       eqp->time_hodge.algo = CS_PARAM_HODGE_ALGO_COST;
@@ -1195,6 +1218,14 @@ cs_equation_summary_param(const char                  *eqname,
         cs_log_printf(CS_LOG_SETUP, "    <%s/Diffusion.Hodge.Coef> %.3e\n",
                       eqname, h_info.coef);
       }
+      if (eqp->diffusion_cache) {
+        if (eqp->diffusion_cache_mb > 0)
+          cs_log_printf(CS_LOG_SETUP, "    <%s/Diffusion.Cache> %.1f MiB\n",
+                        eqname, eqp->diffusion_cache_mb);
+        else
+          cs_log_printf(CS_LOG_SETUP, "    <%s/Diffusion.Cache> no limit\n",
+                        eqname);
+      }
     }
 
   } /* Diffusion term */
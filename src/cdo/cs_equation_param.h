@@ -278,10 +278,20 @@ typedef struct {
    *
    * \var diffusion_property
    * Pointer to the property related to the diffusion term
+   *
+   * \var diffusion_cache
+   * Keep the cellwise stiffness matrices from one build of the algebraic
+   * system to the next one when the diffusion property is steady
+   *
+   * \var diffusion_cache_mb
+   * Maximal memory size (in MiB) devoted to the cache of cellwise stiffness
+   * matrices. A value lower or equal to 0 means no limitation.
    */
 
   cs_param_hodge_t              diffusion_hodge;
   cs_property_t                *diffusion_property;
+  bool                          diffusion_cache;
+  double                        diffusion_cache_mb;
 
   /*!
    * @}
@@ -383,6 +393,15 @@ typedef struct {
  *   potential-like degrees of freedom and needs a correct computation of the
  *   cell barycenter
  *
+ * \var CS_EQKEY_HODGE_DIFF_CACHE
+ * Store the cellwise stiffness matrices related to the diffusion term so that
+ * they are not rebuilt at each time step. Only used with CDO vertex-based
+ * schemes and when the diffusion property is steady. Available choices are:
+ * - "false" (default) --> no cache
+ * - "true" --> cache the stiffness matrices in all cells
+ * - or a value such as "256" --> maximal memory size (in MiB) to devote to the
+ *   cache. Cells beyond this budget are treated as usual.
+ *
  * \var CS_EQKEY_HODGE_TIME_ALGO
  * Set the algorithm used for building the discrete Hodge operator used
  * in the unsteady term. Available choices are:
@@ -546,6 +565,7 @@ typedef enum {
   CS_EQKEY_DOF_REDUCTION,
   CS_EQKEY_EXTRA_OP,
   CS_EQKEY_HODGE_DIFF_ALGO,
+  CS_EQKEY_HODGE_DIFF_CACHE,
   CS_EQKEY_HODGE_DIFF_COEF,
   CS_EQKEY_HODGE_TIME_ALGO,
   CS_EQKEY_HODGE_TIME_COEF,
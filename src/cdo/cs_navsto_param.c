@@ -142,6 +142,10 @@ cs_navsto_param_create(cs_navsto_param_model_t        model,
   param->coupling = algo_coupling;
   param->ac_zeta_coef = 1.0;    /* Default value if not set by the user */
 
+  /* Outer solver of the monolithic velocity-pressure system */
+  param->n_max_algo_iter = 100;
+  param->residual_tolerance = 1e-8;
+
   return param;
 }
 
@@ -211,6 +215,14 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
     }
     break;
 
+  case CS_NSKEY_MAX_ALGO_ITER:
+    nsp->n_max_algo_iter = atoi(val);
+    break;
+
+  case CS_NSKEY_RESIDUAL_TOLERANCE:
+    nsp->residual_tolerance = atof(val);
+    break;
+
   case CS_NSKEY_SPACE_SCHEME:
     if (strcmp(val, "cdo_fb") == 0) {
       nsp->space_scheme = CS_SPACE_SCHEME_CDOFB;
@@ -305,6 +317,10 @@ cs_navsto_param_log(const cs_navsto_param_t    *nsp)
                 cs_navsto_param_time_state_name[nsp->time_state]);
   cs_log_printf(CS_LOG_SETUP, " <NavSto/Coupling> %s\n",
                 cs_navsto_param_coupling_name[nsp->coupling]);
+  if (nsp->coupling == CS_NAVSTO_COUPLING_UZAWA)
+    cs_log_printf(CS_LOG_SETUP,
+                  " <NavSto/Coupling> max. iter: %d; tolerance: %5.3e\n",
+                  nsp->n_max_algo_iter, nsp->residual_tolerance);
   cs_log_printf(CS_LOG_SETUP, " <NavSto/Gravity effect> %s",
                 cs_base_strtf(nsp->has_gravity));
   if (nsp->has_gravity)
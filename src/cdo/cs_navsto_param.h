@@ -180,6 +180,18 @@ typedef struct {
    */
   cs_real_t                     ac_zeta_coef;
 
+  /*!
+   * \var n_max_algo_iter
+   * Maximal number of iterations of the outer (Krylov) solver when the
+   * velocity-pressure system is solved as a whole (Uzawa coupling)
+   *
+   * \var residual_tolerance
+   * Relative tolerance on the residual of the coupled velocity-pressure
+   * system used to stop the outer (Krylov) solver (Uzawa coupling)
+   */
+  int                           n_max_algo_iter;
+  cs_real_t                     residual_tolerance;
+
 } cs_navsto_param_t;
 
 /*! \enum cs_navsto_key_t
@@ -194,6 +206,14 @@ typedef struct {
  * Set how the DoFs are defined (similar to \ref CS_EQKEY_DOF_REDUCTION)
  * Enable to set this type of DoFs definition for all related equations
  *
+ * \var CS_NSKEY_MAX_ALGO_ITER
+ * Set the maximal number of iterations of the outer solver used when the
+ * velocity-pressure system is solved in a monolithic way (Uzawa coupling)
+ *
+ * \var CS_NSKEY_RESIDUAL_TOLERANCE
+ * Set the relative tolerance on the residual of the coupled velocity-pressure
+ * system (Uzawa coupling)
+ *
  * \var CS_NSKEY_SPACE_SCHEME
  * Numerical scheme for the space discretization
  *
@@ -215,6 +235,8 @@ typedef enum {
 
   CS_NSKEY_AC_ZETA_COEF,
   CS_NSKEY_DOF_REDUCTION,
+  CS_NSKEY_MAX_ALGO_ITER,
+  CS_NSKEY_RESIDUAL_TOLERANCE,
   CS_NSKEY_SPACE_SCHEME,
   CS_NSKEY_TIME_SCHEME,
   CS_NSKEY_TIME_THETA,
@@ -223,13 +223,16 @@ _create_uzawa_context(cs_navsto_param_t    *nsp)
                                   3,
                                   CS_PARAM_BC_HMG_DIRICHLET);
 
-  /* Set the default settings */
+  /* Set the default settings. The velocity block is only solved inside the
+     preconditioner of the coupled system: a loose tolerance is enough. Its
+     matrix is not symmetric as soon as an advection term is considered. */
   {
     cs_equation_param_t  *eqp = cs_equation_get_param(nsc->momentum);
 
     /* Solver settings */
     cs_equation_set_param(eqp, CS_EQKEY_PRECOND, "jacobi");
     cs_equation_set_param(eqp, CS_EQKEY_ITSOL, "bicg");
+    cs_equation_set_param(eqp, CS_EQKEY_ITSOL_EPS, "1e-4");
   }
 
   nsc->mass = cs_equation_add("Mass",
@@ -296,13 +299,28 @@ _uzawa_init_setup(cs_navsto_system_t          *ns)
 
   assert(nsp != NULL && nsc != NULL);
 
-  _apply_param(nsp, cs_equation_get_param(nsc->momentum));
+  cs_equation_param_t  *mom_eqp = cs_equation_get_param(nsc->momentum);
+
+  _apply_param(nsp, mom_eqp);
   _apply_param(nsp, cs_equation_get_param(nsc->mass));
 
   if (nsc->energy != NULL)
     _apply_param(nsp, cs_equation_get_param(nsc->energy));
 
-  /* TODO */
+  /* Link the time property to the momentum equation */
+  switch (nsp->time_state) {
+
+  case CS_NAVSTO_TIME_STATE_UNSTEADY:
+  case CS_NAVSTO_TIME_STATE_LIMIT_STEADY:
+    cs_equation_add_time(mom_eqp, cs_property_by_name("unity"));
+    break;
+
+  default: /* Fully steady: nothing to do */
+    break;
+  }
+
+  /* All considered models needs a viscous term */
+  cs_equation_add_diffusion(mom_eqp, ns->lami_viscosity);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -495,6 +495,14 @@ cs_property_finalize_setup(void)
                 " %s: Property \"%s\" exists with no definition.",
                 __func__, pty->name);
 
+    /* A property defined only by values does not vary in time */
+    bool  is_steady = true;
+    for (int id = 0; id < pty->n_definitions; id++)
+      if (pty->defs[id]->type != CS_XDEF_BY_VALUE)
+        is_steady = false;
+    if (is_steady)
+      pty->state_flag |= CS_FLAG_STATE_STEADY;
+
   } // Loop on properties
 
 }
@@ -217,6 +217,29 @@ cs_property_is_uniform(const cs_property_t   *pty)
     return false;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  returns true if the property is steady (i.e. it does not vary in
+ *         time), otherwise false
+ *
+ * \param[in]    pty    pointer to a property to test
+ *
+ * \return  true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+cs_property_is_steady(const cs_property_t   *pty)
+{
+  if (pty == NULL)
+    return false;
+
+  if (pty->state_flag & CS_FLAG_STATE_STEADY)
+    return true;
+  else
+    return false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  returns true if the property is isotropic, otherwise false
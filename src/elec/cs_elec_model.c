@@ -459,6 +459,95 @@ _field_pointer_properties_map_electric_arcs(void)
                        cs_field_by_name_try("electric_field"));
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute gradients of the real and imaginary potentials together.
+ *
+ * Both gradients are computed by a single call to
+ * \ref cs_gradient_scalar_multi when the two potentials share the same
+ * gradient options and use neither weighting nor internal coupling;
+ * otherwise, nothing is done.
+ *
+ * \param[in]   mesh     pointer to mesh
+ * \param[out]  grad_r   gradient of real potential
+ * \param[out]  grad_i   gradient of imaginary potential
+ *
+ * \return  true if gradients were computed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_potential_gradients(const cs_mesh_t  *mesh,
+                     cs_real_3_t      *grad_r,
+                     cs_real_3_t      *grad_i)
+{
+  const cs_field_t *f_p[2] = {CS_F_(potr), CS_F_(poti)};
+
+  if (mesh->have_rotation_perio)
+    return false;
+
+  const int key_cal_opt_id = cs_field_key_id("var_cal_opt");
+  const int key_cpl_id = cs_field_key_id_try("coupling_entity");
+
+  cs_var_cal_opt_t var_cal_opt[2];
+
+  for (int i = 0; i < 2; i++) {
+    cs_field_get_key_struct(f_p[i], key_cal_opt_id, var_cal_opt + i);
+    if (var_cal_opt[i].iwgrec == 1)
+      return false;
+    if (key_cpl_id > -1 && var_cal_opt[i].idiff > 0) {
+      if (cs_field_get_key_int(f_p[i], key_cpl_id) > -1)
+        return false;
+    }
+  }
+
+  if (   var_cal_opt[0].imrgra != var_cal_opt[1].imrgra
+      || var_cal_opt[0].nswrgr != var_cal_opt[1].nswrgr
+      || var_cal_opt[0].imligr != var_cal_opt[1].imligr
+      || var_cal_opt[0].iwarni != var_cal_opt[1].iwarni
+      || var_cal_opt[0].epsrgr < var_cal_opt[1].epsrgr
+      || var_cal_opt[0].epsrgr > var_cal_opt[1].epsrgr
+      || var_cal_opt[0].extrag < var_cal_opt[1].extrag
+      || var_cal_opt[0].extrag > var_cal_opt[1].extrag
+      || var_cal_opt[0].climgr < var_cal_opt[1].climgr
+      || var_cal_opt[0].climgr > var_cal_opt[1].climgr)
+    return false;
+
+  cs_halo_type_t halo_type;
+  cs_gradient_type_t gradient_type;
+
+  cs_gradient_type_by_imrgra(var_cal_opt[0].imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  const char *var_name[2] = {f_p[0]->name, f_p[1]->name};
+  const cs_real_t *bc_coeff_a[2] = {f_p[0]->bc_coeffs->a,
+                                    f_p[1]->bc_coeffs->a};
+  const cs_real_t *bc_coeff_b[2] = {f_p[0]->bc_coeffs->b,
+                                    f_p[1]->bc_coeffs->b};
+  cs_real_t *var[2] = {f_p[0]->val, f_p[1]->val};
+  cs_real_3_t *grad[2] = {grad_r, grad_i};
+
+  cs_gradient_scalar_multi(2,
+                           var_name,
+                           gradient_type,
+                           halo_type,
+                           1,    /* inc */
+                           true, /* recompute_cocg */
+                           var_cal_opt[0].nswrgr,
+                           var_cal_opt[0].iwarni,
+                           var_cal_opt[0].imligr,
+                           var_cal_opt[0].epsrgr,
+                           var_cal_opt[0].extrag,
+                           var_cal_opt[0].climgr,
+                           bc_coeff_a,
+                           bc_coeff_b,
+                           var,
+                           grad);
+
+  return true;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -1412,23 +1501,35 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
   /* ----------------------------------------------------- */
 
   if (call_id == 1) {
-    /* compute grad(potR) */
+
+    /* compute grad(potR), and grad(potI) at the same time when possible */
+
+    cs_real_3_t *grad_i = NULL;
+
+    if (ieljou == 2 || ieljou == 4) {
+      BFT_MALLOC(grad_i, n_cells_ext, cs_real_3_t);
+      if (_potential_gradients(mesh, grad, grad_i) == false)
+        BFT_FREE(grad_i);
+    }
 
     /* Get the calculation option from the field */
     cs_real_3_t *cpro_elefl = (cs_real_3_t *)(CS_F_(elefl)->val);
-    cs_field_get_key_struct(CS_F_(potr), key_cal_opt_id, &var_cal_opt);
 
-    cs_gradient_type_by_imrgra(var_cal_opt.imrgra,
-                               &gradient_type,
-                               &halo_type);
+    if (grad_i == NULL) {
+      cs_field_get_key_struct(CS_F_(potr), key_cal_opt_id, &var_cal_opt);
 
-    cs_field_gradient_scalar(CS_F_(potr),
-                             false, /* use_previous_t */
-                             gradient_type,
-                             halo_type,
-                             1,    /* inc */
-                             true, /* recompute_cocg */
-                             grad);
+      cs_gradient_type_by_imrgra(var_cal_opt.imrgra,
+                                 &gradient_type,
+                                 &halo_type);
+
+      cs_field_gradient_scalar(CS_F_(potr),
+                               false, /* use_previous_t */
+                               gradient_type,
+                               halo_type,
+                               1,    /* inc */
+                               true, /* recompute_cocg */
+                               grad);
+    }
 
     /* compute electric field E = - grad (potR) */
     for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
@@ -1512,22 +1613,31 @@ cs_elec_compute_fields(const cs_mesh_t  *mesh,
     }
 
     if (ieljou == 2 || ieljou == 4) {
-      /* compute grad(potI) */
+      /* compute grad(potI), unless already done */
 
-      /* Get the calculation option from the field */
-      cs_field_get_key_struct(CS_F_(poti), key_cal_opt_id, &var_cal_opt);
+      if (grad_i != NULL) {
+        BFT_FREE(grad);
+        grad = grad_i;
+        grad_i = NULL;
+      }
+      else {
 
-      cs_gradient_type_by_imrgra(var_cal_opt.imrgra,
-                                &gradient_type,
-                                &halo_type);
+        /* Get the calculation option from the field */
+        cs_field_get_key_struct(CS_F_(poti), key_cal_opt_id, &var_cal_opt);
 
-      cs_field_gradient_scalar(CS_F_(poti),
-                               false, /* use_previous_t */
-                               gradient_type,
-                               halo_type,
-                               1,    /* inc */
-                               true, /* recompute_cocg */
-                               grad);
+        cs_gradient_type_by_imrgra(var_cal_opt.imrgra,
+                                  &gradient_type,
+                                  &halo_type);
+
+        cs_field_gradient_scalar(CS_F_(poti),
+                                 false, /* use_previous_t */
+                                 gradient_type,
+                                 halo_type,
+                                 1,    /* inc */
+                                 true, /* recompute_cocg */
+                                 grad);
+
+      }
 
       /* compute electric field E = - grad (potI) */
 
@@ -1938,6 +1938,102 @@ _dump_node(const fvm_box_tree_t  *bt,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Find the leaf containing a given point.
+ *
+ * parameters:
+ *   bt     <-- pointer to box tree structure
+ *   dim    <-- associated spatial dimension
+ *   coords <-- normalized point coordinates
+ *
+ * returns:
+ *   id of the leaf containing the point
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_point_leaf(const fvm_box_tree_t  *bt,
+            int                    dim,
+            const cs_coord_t       coords[])
+{
+  cs_lnum_t  node_id = 0;
+
+  while (bt->nodes[node_id].is_leaf == false) {
+
+    int  i;
+    const cs_lnum_t  *c_id = bt->child_ids + bt->n_children*node_id;
+    fvm_morton_code_t  p_code
+      = fvm_morton_encode(dim, bt->nodes[node_id].morton_code.L + 1, coords);
+
+    for (i = 0; i < bt->n_children; i++) {
+      if (fvm_morton_compare(dim, p_code, bt->nodes[c_id[i]].morton_code)
+          == FVM_MORTON_EQUAL_ID)
+        break;
+    }
+
+    assert(i < bt->n_children);
+    node_id = c_id[i];
+
+  }
+
+  return node_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Count or list the boxes containing a given point.
+ *
+ * parameters:
+ *   bt      <-- pointer to box tree structure
+ *   boxes   <-- pointer to associated (normalized) box set
+ *   coords  <-- point coordinates (interleaved, not normalized)
+ *   box_ids --> ids of boxes containing the point, or NULL to only count
+ *
+ * returns:
+ *   number of boxes containing the point
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_point_boxes(const fvm_box_tree_t  *bt,
+             const fvm_box_set_t   *boxes,
+             const cs_coord_t       coords[],
+             cs_lnum_t              box_ids[])
+{
+  int  j;
+  cs_lnum_t  i, n = 0;
+  cs_coord_t  p[3] = {0., 0., 0.};
+
+  const int  dim = boxes->dim;
+
+  for (j = 0; j < dim; j++) {
+    const int  k = boxes->dimensions[j];
+    p[j] = (coords[k] - boxes->gmin[k]) / (boxes->gmax[k] - boxes->gmin[k]);
+    if (p[j] < 0. || p[j] > 1.)
+      return 0;
+  }
+
+  const _node_t  *node = bt->nodes + _point_leaf(bt, dim, p);
+
+  for (i = 0; i < node->n_boxes; i++) {
+
+    const cs_lnum_t  box_id = bt->box_ids[node->start_id + i];
+    const cs_coord_t  *b_min = _box_min(boxes, box_id);
+    const cs_coord_t  *b_max = _box_max(boxes, box_id);
+
+    for (j = 0; j < dim; j++) {
+      if (p[j] < b_min[j] || p[j] > b_max[j])
+        break;
+    }
+
+    if (j == dim) {
+      if (box_ids != NULL)
+        box_ids[n] = box_id;
+      n++;
+    }
+
+  }
+
+  return n;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2396,6 +2492,80 @@ fvm_box_tree_get_intersects(fvm_box_tree_t       *bt,
   *box_g_num = _g_num;
 }
 
+/*----------------------------------------------------------------------------
+ * Build an indexed list of boxes containing given points.
+ *
+ * The box set must have been created with normalization. Points
+ * are given with their global (non-normalized) coordinates, using
+ * a 3D interleaved layout; points outside the box set's global extents
+ * are not contained in any box.
+ *
+ * The point_index and box_ids arrays are allocated by this function,
+ * and it is the caller's responsibility to free them.
+ *
+ * Upon return, point_index[i] points to the first position in box_ids
+ * relative to boxes containing point i, while box_ids contains the
+ * local ids of those boxes in the box set.
+ *
+ * parameters:
+ *   bt           <-- pointer to box tree structure to query
+ *   boxes        <-- pointer to a associated box set
+ *   n_points     <-- number of points
+ *   point_coords <-- point coordinates (size: n_points*3)
+ *   point_index  --> pointer to the index array on points
+ *   box_ids      --> pointer to the list of boxes containing points
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_box_tree_get_point_intersects(const fvm_box_tree_t  *bt,
+                                  const fvm_box_set_t   *boxes,
+                                  cs_lnum_t              n_points,
+                                  const cs_coord_t       point_coords[],
+                                  cs_lnum_t             *point_index[],
+                                  cs_lnum_t             *box_ids[])
+{
+  cs_lnum_t  i;
+
+  cs_lnum_t  *_index = NULL;
+  cs_lnum_t  *_box_ids = NULL;
+
+  BFT_MALLOC(_index, n_points + 1, cs_lnum_t);
+
+  _index[0] = 0;
+
+  if (boxes->n_boxes > 0) {
+
+#   pragma omp parallel for if (n_points > CS_THR_MIN)
+    for (i = 0; i < n_points; i++)
+      _index[i+1] = _point_boxes(bt, boxes, point_coords + 3*i, NULL);
+
+  }
+  else {
+
+    for (i = 0; i < n_points; i++)
+      _index[i+1] = 0;
+
+  }
+
+  for (i = 0; i < n_points; i++)
+    _index[i+1] += _index[i];
+
+  BFT_MALLOC(_box_ids, _index[n_points], cs_lnum_t);
+
+  if (_index[n_points] > 0) {
+
+#   pragma omp parallel for if (n_points > CS_THR_MIN)
+    for (i = 0; i < n_points; i++)
+      _point_boxes(bt, boxes, point_coords + 3*i, _box_ids + _index[i]);
+
+  }
+
+  /* Return pointers */
+
+  *point_index = _index;
+  *box_ids = _box_ids;
+}
+
 /*----------------------------------------------------------------------------
  * Get global box tree statistics.
  *
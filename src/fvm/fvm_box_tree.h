@@ -175,6 +175,38 @@ fvm_box_tree_get_intersects(fvm_box_tree_t       *bt,
                             cs_lnum_t            *box_index[],
                             cs_gnum_t            *box_g_num[]);
 
+/*----------------------------------------------------------------------------
+ * Build an indexed list of boxes containing given points.
+ *
+ * The box set must have been created with normalization. Points
+ * are given with their global (non-normalized) coordinates, using
+ * a 3D interleaved layout; points outside the box set's global extents
+ * are not contained in any box.
+ *
+ * The point_index and box_ids arrays are allocated by this function,
+ * and it is the caller's responsibility to free them.
+ *
+ * Upon return, point_index[i] points to the first position in box_ids
+ * relative to boxes containing point i, while box_ids contains the
+ * local ids of those boxes in the box set.
+ *
+ * parameters:
+ *   bt           <-- pointer to box tree structure to query
+ *   boxes        <-- pointer to a associated box set
+ *   n_points     <-- number of points
+ *   point_coords <-- point coordinates (size: n_points*3)
+ *   point_index  --> pointer to the index array on points
+ *   box_ids      --> pointer to the list of boxes containing points
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_box_tree_get_point_intersects(const fvm_box_tree_t  *bt,
+                                  const fvm_box_set_t   *boxes,
+                                  cs_lnum_t              n_points,
+                                  const cs_coord_t       point_coords[],
+                                  cs_lnum_t             *point_index[],
+                                  cs_lnum_t             *box_ids[]);
+
 /*----------------------------------------------------------------------------
  * Get global box tree statistics.
  *
@@ -0,0 +1,1552 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to XDMF files (XML description with raw binary data)
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_defs.h"
+#include "fvm_io_num.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_part_to_block.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_xdmf.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Reference to a dataset written to a binary data file
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char                  *name;         /* Field name */
+  int                    dim;          /* Output dimension */
+  fvm_writer_var_loc_t   location;     /* Field location */
+  cs_datatype_t          datatype;     /* Output datatype */
+
+  cs_gnum_t              n_g_ents;     /* Global number of entities */
+  int                    file_id;      /* Associated data file id */
+  cs_file_off_t          offset;       /* Offset in data file */
+
+} _xdmf_field_t;
+
+/*----------------------------------------------------------------------------
+ * Geometry (coordinates and connectivity) written for a given mesh
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_gnum_t       n_g_vertices;        /* Global number of vertices */
+  cs_gnum_t       n_g_elements;        /* Global number of elements */
+  cs_gnum_t       connect_size;        /* Global mixed connectivity size */
+
+  int             file_id;             /* Associated data file id */
+  cs_file_off_t   coords_offset;       /* Coordinates offset in data file */
+  cs_file_off_t   connect_offset;      /* Connectivity offset in data file */
+
+} _xdmf_geom_t;
+
+/*----------------------------------------------------------------------------
+ * Output time step for a given mesh
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int              time_step;          /* Time step number */
+  double           time_value;         /* Associated time value */
+  int              geom_id;            /* Associated geometry id */
+
+  int              n_fields;           /* Number of fields */
+  _xdmf_field_t   *fields;             /* Field references */
+
+} _xdmf_step_t;
+
+/*----------------------------------------------------------------------------
+ * Mesh output history
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char            *name;               /* Mesh name */
+
+  int              n_geoms;            /* Number of geometry outputs */
+  _xdmf_geom_t    *geoms;              /* Geometry outputs */
+
+  int              n_steps;            /* Number of time step outputs */
+  _xdmf_step_t    *steps;              /* Time step outputs */
+
+  int              n_const_fields;     /* Number of time-independent fields */
+  _xdmf_field_t   *const_fields;       /* Time-independent field references */
+
+} _xdmf_mesh_t;
+
+/*----------------------------------------------------------------------------
+ * XDMF writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char          *name;               /* Writer name */
+  char          *path;               /* Output path, with trailing '/' */
+
+  int            rank;               /* Rank of current process in comm. */
+  int            n_ranks;            /* Number of processes in communicator */
+
+  bool           double_precision;   /* Output field values as double */
+  bool           discard_polygons;   /* Option to discard polygonal elements */
+  bool           discard_polyhedra;  /* Option to discard polyhedral elements */
+
+  fvm_writer_time_dep_t   time_dependency;  /* Mesh time dependency */
+
+  int            time_step;          /* Current mesh time step */
+  double         time_value;         /* Current mesh time value */
+
+  int            n_data_files;       /* Number of data files */
+  char         **data_file_name;     /* Data file names (without path) */
+
+  cs_file_t     *data_file;          /* Current data file, or NULL */
+  int            data_file_ts;       /* Time step of current data file */
+  cs_file_off_t  data_offset;        /* Current offset in data file */
+
+  int            n_meshes;           /* Number of associated meshes */
+  _xdmf_mesh_t  *meshes;             /* Associated mesh output histories */
+
+  bool           modified;           /* Has XML file to be rewritten ? */
+
+#if defined(HAVE_MPI)
+  int            min_rank_step;      /* Minimum rank step */
+  int            min_block_size;     /* Minimum block buffer size */
+  MPI_Comm       block_comm;         /* Associated MPI block communicator */
+  MPI_Comm       comm;               /* Associated MPI communicator */
+#endif
+
+} fvm_to_xdmf_writer_t;
+
+/*----------------------------------------------------------------------------
+ * Context structure for fvm_writer_field_helper_output_* functions.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  fvm_to_xdmf_writer_t  *writer;     /* Pointer to writer structure */
+
+} _xdmf_context_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* XDMF mixed topology element type codes */
+
+static const int  _xdmf_type_code[] = {2,      /* FVM_EDGE (polyline) */
+                                       4,      /* FVM_FACE_TRIA */
+                                       5,      /* FVM_FACE_QUAD */
+                                       3,      /* FVM_FACE_POLY */
+                                       6,      /* FVM_CELL_TETRA */
+                                       7,      /* FVM_CELL_PYRAM */
+                                       8,      /* FVM_CELL_PRISM */
+                                       9,      /* FVM_CELL_HEXA */
+                                       16};    /* FVM_CELL_POLY */
+
+/* Vertex order for prisms (XDMF wedges) */
+
+static const int  _xdmf_prism_order[6] = {0, 2, 1, 3, 5, 4};
+
+/* Symmetric tensor component order (xx, xy, xz, yy, yz, zz) */
+
+static const int  _xdmf_c_order_6[6] = {0, 3, 5, 1, 4, 2};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return global vertex id (0 to n-1) associated with a local vertex number.
+ *
+ * parameters:
+ *   g_vtx_num <-- global vertex numbers, or NULL
+ *   vtx_num   <-- local vertex number (1 to n)
+ *
+ * returns:
+ *   global vertex id
+ *----------------------------------------------------------------------------*/
+
+static inline int64_t
+_g_vtx_id(const cs_gnum_t  *g_vtx_num,
+          cs_lnum_t         vtx_num)
+{
+  if (g_vtx_num != NULL)
+    return (int64_t)(g_vtx_num[vtx_num - 1]) - 1;
+  else
+    return (int64_t)vtx_num - 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Free field reference structures in an array.
+ *
+ * parameters:
+ *   n_fields <-- number of fields
+ *   fields   <-> array of field references
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_fields(int             n_fields,
+             _xdmf_field_t  *fields)
+{
+  for (int i = 0; i < n_fields; i++)
+    BFT_FREE(fields[i].name);
+}
+
+/*----------------------------------------------------------------------------
+ * Add or replace a field reference in an array.
+ *
+ * parameters:
+ *   n_fields <-> number of fields
+ *   fields   <-> array of field references
+ *   field    <-- field reference to add
+ *   name     <-- field name (copied)
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_field(int             *n_fields,
+           _xdmf_field_t  **fields,
+           _xdmf_field_t    field,
+           const char      *name)
+{
+  int i;
+  _xdmf_field_t *_fields = *fields;
+
+  for (i = 0; i < *n_fields; i++) {
+    if (strcmp(_fields[i].name, name) == 0)
+      break;
+  }
+
+  if (i < *n_fields)
+    BFT_FREE(_fields[i].name);
+  else {
+    *n_fields += 1;
+    BFT_REALLOC(_fields, *n_fields, _xdmf_field_t);
+    *fields = _fields;
+  }
+
+  _fields[i] = field;
+  BFT_MALLOC(_fields[i].name, strlen(name) + 1, char);
+  strcpy(_fields[i].name, name);
+}
+
+/*----------------------------------------------------------------------------
+ * Return mesh output history structure associated with a mesh name,
+ * adding it if not present.
+ *
+ * parameters:
+ *   w    <-> pointer to XDMF writer structure
+ *   name <-- mesh name
+ *
+ * returns:
+ *   pointer to mesh output history structure
+ *----------------------------------------------------------------------------*/
+
+static _xdmf_mesh_t *
+_get_mesh(fvm_to_xdmf_writer_t  *w,
+          const char            *name)
+{
+  for (int i = 0; i < w->n_meshes; i++) {
+    if (strcmp(w->meshes[i].name, name) == 0)
+      return w->meshes + i;
+  }
+
+  BFT_REALLOC(w->meshes, w->n_meshes + 1, _xdmf_mesh_t);
+
+  _xdmf_mesh_t *m = w->meshes + w->n_meshes;
+  w->n_meshes += 1;
+
+  BFT_MALLOC(m->name, strlen(name) + 1, char);
+  strcpy(m->name, name);
+
+  m->n_geoms = 0;
+  m->geoms = NULL;
+  m->n_steps = 0;
+  m->steps = NULL;
+  m->n_const_fields = 0;
+  m->const_fields = NULL;
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------
+ * Return time step output structure associated with a mesh, adding
+ * it if not present.
+ *
+ * parameters:
+ *   m          <-> pointer to mesh output history structure
+ *   time_step  <-- time step number
+ *   time_value <-- time value
+ *
+ * returns:
+ *   pointer to time step output structure
+ *----------------------------------------------------------------------------*/
+
+static _xdmf_step_t *
+_get_step(_xdmf_mesh_t  *m,
+          int            time_step,
+          double         time_value)
+{
+  if (m->n_steps > 0) {
+    if (m->steps[m->n_steps - 1].time_step == time_step)
+      return m->steps + m->n_steps - 1;
+    else if (m->steps[m->n_steps - 1].time_step > time_step)
+      bft_error(__FILE__, __LINE__, 0,
+                _("The time step number %d for mesh \"%s\" is lower than\n"
+                  "the previous output time step number (%d)."),
+                time_step, m->name, m->steps[m->n_steps - 1].time_step);
+  }
+
+  BFT_REALLOC(m->steps, m->n_steps + 1, _xdmf_step_t);
+
+  _xdmf_step_t *s = m->steps + m->n_steps;
+  m->n_steps += 1;
+
+  s->time_step = time_step;
+  s->time_value = time_value;
+  s->geom_id = m->n_geoms - 1;
+  s->n_fields = 0;
+  s->fields = NULL;
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Close current binary data file if open.
+ *
+ * parameters:
+ *   w <-> pointer to XDMF writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_close_data_file(fvm_to_xdmf_writer_t  *w)
+{
+  if (w->data_file != NULL)
+    w->data_file = cs_file_free(w->data_file);
+
+  w->data_offset = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure a binary data file matching the given time step is open.
+ *
+ * Time-independent data (time_step < 0) is appended to the current
+ * data file if one is open. A given data file is never reopened, so
+ * already written data is never overwritten.
+ *
+ * parameters:
+ *   w         <-> pointer to XDMF writer structure
+ *   time_step <-- time step number
+ *
+ * returns:
+ *   id of the current data file
+ *----------------------------------------------------------------------------*/
+
+static int
+_open_data_file(fvm_to_xdmf_writer_t  *w,
+                int                    time_step)
+{
+  if (w->data_file != NULL) {
+    if (time_step < 0 || time_step == w->data_file_ts)
+      return w->n_data_files - 1;
+    _close_data_file(w);
+  }
+
+  /* Build file name, ensuring it was not used previously */
+
+  size_t l = strlen(w->name) + 32;
+  char *file_name;
+
+  BFT_MALLOC(file_name, l, char);
+
+  if (time_step > -1)
+    sprintf(file_name, "%s.%05d.bin", w->name, time_step);
+  else
+    sprintf(file_name, "%s.bin", w->name);
+
+  for (int i = 0, j = 1; i < w->n_data_files; i++) {
+    if (strcmp(w->data_file_name[i], file_name) == 0) {
+      if (time_step > -1)
+        sprintf(file_name, "%s.%05d_%d.bin", w->name, time_step, j++);
+      else
+        sprintf(file_name, "%s_%d.bin", w->name, j++);
+      i = -1;
+    }
+  }
+
+  BFT_REALLOC(w->data_file_name, w->n_data_files + 1, char *);
+  w->data_file_name[w->n_data_files] = file_name;
+  w->n_data_files += 1;
+
+  /* Now open file */
+
+  char *full_name;
+  BFT_MALLOC(full_name, strlen(w->path) + strlen(file_name) + 1, char);
+  sprintf(full_name, "%s%s", w->path, file_name);
+
+  cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+
+  MPI_Info hints;
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+  w->data_file = cs_file_open(full_name,
+                              CS_FILE_MODE_WRITE,
+                              method,
+                              hints,
+                              w->block_comm,
+                              w->comm);
+
+#else
+
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+  w->data_file = cs_file_open(full_name, CS_FILE_MODE_WRITE, method);
+
+#endif
+
+  BFT_FREE(full_name);
+
+  w->data_file_ts = time_step;
+  w->data_offset = 0;
+
+  return w->n_data_files - 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a block of values to the current data file and update the
+ * associated offset.
+ *
+ * Blocks must be contiguous across ranks, starting at global number 1.
+ *
+ * parameters:
+ *   w          <-> pointer to XDMF writer structure
+ *   buf        <-- pointer to values
+ *   size       <-- size of each value
+ *   stride     <-- number of values per entity
+ *   num_start  <-- global number of first entity in block
+ *   num_end    <-- global number of past-the-end entity in block
+ *   n_g_ents   <-- global number of entities
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_block(fvm_to_xdmf_writer_t  *w,
+             void                  *buf,
+             size_t                 size,
+             size_t                 stride,
+             cs_gnum_t              num_start,
+             cs_gnum_t              num_end,
+             cs_gnum_t              n_g_ents)
+{
+  cs_file_write_block_buffer(w->data_file,
+                             buf,
+                             size,
+                             stride,
+                             num_start,
+                             num_end);
+
+  w->data_offset += (cs_file_off_t)(n_g_ents*size*stride);
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and file context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(component_id);
+
+  _xdmf_context_t *c = context;
+
+  cs_file_write_block_buffer(c->writer->data_file,
+                             buffer,
+                             cs_datatype_size[datatype],
+                             dimension,
+                             block_start,
+                             block_end);
+}
+
+/*----------------------------------------------------------------------------
+ * Build mixed (XDMF type code prefixed) connectivity for a nodal section.
+ *
+ * parameters:
+ *   section     <-- pointer to nodal mesh section
+ *   g_vtx_num   <-- global vertex numbers, or NULL
+ *   elt_index   --> element -> connectivity index (size: n_elements + 1)
+ *   elt_connect --> mixed connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_section_connect(const fvm_nodal_section_t   *section,
+                 const cs_gnum_t             *g_vtx_num,
+                 cs_lnum_t                  **elt_index,
+                 int64_t                    **elt_connect)
+{
+  cs_lnum_t  *_index;
+  int64_t    *_connect;
+
+  const cs_lnum_t  n_elts = section->n_elements;
+  const int64_t type_code = _xdmf_type_code[section->type];
+
+  BFT_MALLOC(_index, n_elts + 1, cs_lnum_t);
+
+  /* Count sizes */
+
+  _index[0] = 0;
+
+  if (section->type == FVM_CELL_POLY) {
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      cs_lnum_t n = 2;
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+        cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+        n += 1 + section->vertex_index[f_id+1] - section->vertex_index[f_id];
+      }
+      _index[i+1] = _index[i] + n;
+    }
+  }
+  else if (section->type == FVM_FACE_POLY) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      _index[i+1] =   _index[i] + 2
+                    + section->vertex_index[i+1] - section->vertex_index[i];
+  }
+  else if (section->type == FVM_EDGE) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      _index[i+1] = _index[i] + 4;
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      _index[i+1] = _index[i] + 1 + section->stride;
+  }
+
+  BFT_MALLOC(_connect, _index[n_elts], int64_t);
+
+  /* Build connectivity */
+
+  if (section->type == FVM_CELL_POLY) {
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      int64_t *c = _connect + _index[i];
+      cs_lnum_t k = 0;
+      c[k++] = type_code;
+      c[k++] = section->face_index[i+1] - section->face_index[i];
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+        cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+        cs_lnum_t s_id = section->vertex_index[f_id];
+        cs_lnum_t e_id = section->vertex_index[f_id+1];
+        c[k++] = e_id - s_id;
+        if (section->face_num[j] > 0) {
+          for (cs_lnum_t l = s_id; l < e_id; l++)
+            c[k++] = _g_vtx_id(g_vtx_num, section->vertex_num[l]);
+        }
+        else { /* Reverse orientation so that normals point outwards */
+          for (cs_lnum_t l = e_id - 1; l >= s_id; l--)
+            c[k++] = _g_vtx_id(g_vtx_num, section->vertex_num[l]);
+        }
+      }
+    }
+  }
+  else if (section->type == FVM_FACE_POLY) {
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      int64_t *c = _connect + _index[i];
+      cs_lnum_t s_id = section->vertex_index[i];
+      cs_lnum_t e_id = section->vertex_index[i+1];
+      c[0] = type_code;
+      c[1] = e_id - s_id;
+      for (cs_lnum_t l = s_id; l < e_id; l++)
+        c[2 + l - s_id] = _g_vtx_id(g_vtx_num, section->vertex_num[l]);
+    }
+  }
+  else {
+    const int stride = section->stride;
+    const int shift = (section->type == FVM_EDGE) ? 2 : 1;
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      int64_t *c = _connect + _index[i];
+      const cs_lnum_t *vtx_num = section->vertex_num + i*stride;
+      c[0] = type_code;
+      if (section->type == FVM_EDGE)
+        c[1] = 2;
+      if (section->type == FVM_CELL_PRISM) {
+        for (int j = 0; j < stride; j++)
+          c[shift + j] = _g_vtx_id(g_vtx_num, vtx_num[_xdmf_prism_order[j]]);
+      }
+      else {
+        for (int j = 0; j < stride; j++)
+          c[shift + j] = _g_vtx_id(g_vtx_num, vtx_num[j]);
+      }
+    }
+  }
+
+  *elt_index = _index;
+  *elt_connect = _connect;
+}
+
+/*----------------------------------------------------------------------------
+ * Write vertex coordinates to the current data file.
+ *
+ * Coordinates are always written as interleaved 3d double precision values.
+ *
+ * parameters:
+ *   w    <-> pointer to XDMF writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_coords(fvm_to_xdmf_writer_t  *w,
+              const fvm_nodal_t     *mesh)
+{
+  const int dim = mesh->dim;
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+  const cs_lnum_t *parent_vertex_num = mesh->parent_vertex_num;
+  const cs_coord_t *vertex_coords = mesh->vertex_coords;
+  const cs_gnum_t n_g_vertices = fvm_nodal_n_g_vertices(mesh);
+
+  double *part_coords;
+  BFT_MALLOC(part_coords, n_vertices*3, double);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    const cs_lnum_t j = (parent_vertex_num != NULL) ?
+      parent_vertex_num[i] - 1 : i;
+    for (int k = 0; k < dim; k++)
+      part_coords[i*3 + k] = vertex_coords[j*dim + k];
+    for (int k = dim; k < 3; k++)
+      part_coords[i*3 + k] = 0.;
+  }
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    cs_block_dist_info_t  bi;
+    cs_part_to_block_t  *d = NULL;
+    double *block_coords;
+
+    fvm_writer_vertex_part_to_block_create(w->min_rank_step,
+                                           w->min_block_size,
+                                           0,
+                                           0,
+                                           mesh,
+                                           &bi,
+                                           &d,
+                                           w->comm);
+
+    BFT_MALLOC(block_coords,
+               (bi.gnum_range[1] - bi.gnum_range[0])*3,
+               double);
+
+    cs_part_to_block_copy_array(d, CS_DOUBLE, 3, part_coords, block_coords);
+
+    cs_part_to_block_destroy(&d);
+
+    _write_block(w, block_coords, sizeof(double), 3,
+                 bi.gnum_range[0], bi.gnum_range[1], n_g_vertices);
+
+    BFT_FREE(block_coords);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (w->n_ranks == 1)
+    _write_block(w, part_coords, sizeof(double), 3,
+                 1, n_vertices + 1, n_g_vertices);
+
+  BFT_FREE(part_coords);
+}
+
+/*----------------------------------------------------------------------------
+ * Write mixed connectivity of a nodal section to the current data file.
+ *
+ * parameters:
+ *   w         <-> pointer to XDMF writer structure
+ *   section   <-- pointer to nodal mesh section
+ *   g_vtx_num <-- global vertex numbers, or NULL
+ *
+ * returns:
+ *   global size of written connectivity
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_write_section_connect(fvm_to_xdmf_writer_t       *w,
+                       const fvm_nodal_section_t  *section,
+                       const cs_gnum_t            *g_vtx_num)
+{
+  cs_lnum_t *part_index = NULL;
+  int64_t *part_connect = NULL;
+
+  cs_gnum_t tot_size = 0;
+
+  _section_connect(section, g_vtx_num, &part_index, &part_connect);
+
+  const cs_lnum_t n_elements = section->n_elements;
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    cs_block_dist_info_t bi;
+    cs_part_to_block_t  *d = NULL;
+    cs_lnum_t *block_index = NULL;
+    int64_t *block_connect = NULL;
+    cs_gnum_t loc_size = part_index[n_elements];
+    cs_gnum_t block_size = 0, block_start = 0, block_end = 0;
+    size_t  min_block_size = w->min_block_size / sizeof(int64_t);
+
+    const cs_gnum_t n_g_elements
+      = fvm_io_num_get_global_count(section->global_element_num);
+    const cs_gnum_t *g_elt_num
+      = fvm_io_num_get_global_num(section->global_element_num);
+
+    MPI_Allreduce(&loc_size, &tot_size, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+
+    if (n_g_elements > 0 && tot_size >= n_g_elements)
+      min_block_size /= (tot_size / n_g_elements);
+
+    bi = cs_block_dist_compute_sizes(w->rank,
+                                     w->n_ranks,
+                                     w->min_rank_step,
+                                     min_block_size,
+                                     n_g_elements);
+
+    BFT_MALLOC(block_index, bi.gnum_range[1] - bi.gnum_range[0] + 1, cs_lnum_t);
+
+    d = cs_part_to_block_create_by_gnum(w->comm, bi, n_elements, g_elt_num);
+
+    cs_part_to_block_copy_index(d, part_index, block_index);
+
+    block_size = block_index[bi.gnum_range[1] - bi.gnum_range[0]];
+
+    BFT_MALLOC(block_connect, block_size, int64_t);
+
+    cs_part_to_block_copy_indexed(d,
+                                  CS_INT64,
+                                  part_index,
+                                  part_connect,
+                                  block_index,
+                                  block_connect);
+
+    cs_part_to_block_destroy(&d);
+    BFT_FREE(block_index);
+
+    /* Blocks are contiguous, so compute ranges in connectivity array */
+
+    MPI_Scan(&block_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+    block_end += 1;
+    block_start = block_end - block_size;
+
+    _write_block(w, block_connect, sizeof(int64_t), 1,
+                 block_start, block_end, tot_size);
+
+    BFT_FREE(block_connect);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (w->n_ranks == 1) {
+    tot_size = part_index[n_elements];
+    _write_block(w, part_connect, sizeof(int64_t), 1,
+                 1, tot_size + 1, tot_size);
+  }
+
+  BFT_FREE(part_connect);
+  BFT_FREE(part_index);
+
+  return tot_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Print a string to an XML file, escaping special characters.
+ *
+ * parameters:
+ *   f <-- pointer to file
+ *   s <-- string to print
+ *----------------------------------------------------------------------------*/
+
+static void
+_xml_print_escaped(FILE        *f,
+                   const char  *s)
+{
+  for (const char *c = s; *c != '\0'; c++) {
+    switch (*c) {
+    case '&':
+      fputs("&amp;", f);
+      break;
+    case '<':
+      fputs("&lt;", f);
+      break;
+    case '>':
+      fputs("&gt;", f);
+      break;
+    case '"':
+      fputs("&quot;", f);
+      break;
+    default:
+      fputc(*c, f);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write a binary DataItem reference to an XML file.
+ *
+ * parameters:
+ *   w           <-- pointer to XDMF writer structure
+ *   f           <-- pointer to file
+ *   indent      <-- indentation string
+ *   n_g_ents    <-- global number of entities
+ *   dim         <-- number of values per entity (0 or 1 for 1d arrays)
+ *   number_type <-- XDMF number type ("Float" or "Int")
+ *   precision   <-- number of bytes per value
+ *   file_id     <-- associated data file id
+ *   offset      <-- offset in data file
+ *----------------------------------------------------------------------------*/
+
+static void
+_xml_data_item(const fvm_to_xdmf_writer_t  *w,
+               FILE                        *f,
+               const char                  *indent,
+               cs_gnum_t                    n_g_ents,
+               int                          dim,
+               const char                  *number_type,
+               size_t                       precision,
+               int                          file_id,
+               cs_file_off_t                offset)
+{
+  int int_endian = 0;
+  *((char *)(&int_endian)) = '\1';
+  const char *endian = (int_endian == 1) ? "Little" : "Big";
+
+  if (dim > 1)
+    fprintf(f, "%s<DataItem Dimensions=\"%llu %d\"",
+            indent, (unsigned long long)n_g_ents, dim);
+  else
+    fprintf(f, "%s<DataItem Dimensions=\"%llu\"",
+            indent, (unsigned long long)n_g_ents);
+
+  fprintf(f, " NumberType=\"%s\" Precision=\"%d\""
+          " Format=\"Binary\" Endian=\"%s\" Seek=\"%lld\">%s</DataItem>\n",
+          number_type, (int)precision, endian, (long long)offset,
+          w->data_file_name[file_id]);
+}
+
+/*----------------------------------------------------------------------------
+ * Write topology, geometry and attributes of a uniform grid to an XML file.
+ *
+ * parameters:
+ *   w        <-- pointer to XDMF writer structure
+ *   f        <-- pointer to file
+ *   m        <-- pointer to mesh output history structure
+ *   geom     <-- pointer to geometry reference
+ *   s        <-- pointer to time step output structure, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_xml_write_grid(const fvm_to_xdmf_writer_t  *w,
+                FILE                        *f,
+                const _xdmf_mesh_t          *m,
+                const _xdmf_geom_t          *geom,
+                const _xdmf_step_t          *s)
+{
+  const char *indent = (s != NULL) ? "      " : "    ";
+  const char *d_indent = (s != NULL) ? "          " : "        ";
+
+  fprintf(f, "%s<Grid Name=\"", indent);
+  _xml_print_escaped(f, m->name);
+  fprintf(f, "\" GridType=\"Uniform\">\n");
+
+  if (s != NULL)
+    fprintf(f, "%s  <Time Value=\"%.12g\"/>\n", indent, s->time_value);
+
+  /* Topology */
+
+  if (geom->n_g_elements > 0) {
+    fprintf(f, "%s  <Topology TopologyType=\"Mixed\""
+            " NumberOfElements=\"%llu\">\n",
+            indent, (unsigned long long)(geom->n_g_elements));
+    _xml_data_item(w, f, d_indent, geom->connect_size, 1,
+                   "Int", sizeof(int64_t),
+                   geom->file_id, geom->connect_offset);
+    fprintf(f, "%s  </Topology>\n", indent);
+  }
+  else
+    fprintf(f, "%s  <Topology TopologyType=\"Polyvertex\""
+            " NumberOfElements=\"%llu\" NodesPerElement=\"1\"/>\n",
+            indent, (unsigned long long)(geom->n_g_vertices));
+
+  /* Geometry */
+
+  fprintf(f, "%s  <Geometry GeometryType=\"XYZ\">\n", indent);
+  _xml_data_item(w, f, d_indent, geom->n_g_vertices, 3,
+                 "Float", sizeof(double),
+                 geom->file_id, geom->coords_offset);
+  fprintf(f, "%s  </Geometry>\n", indent);
+
+  /* Attributes (time-independent, then time-dependent) */
+
+  for (int i = 0; i < 2; i++) {
+
+    int n_fields = m->n_const_fields;
+    const _xdmf_field_t *fields = m->const_fields;
+    if (i == 1) {
+      n_fields = (s != NULL) ? s->n_fields : 0;
+      fields = (s != NULL) ? s->fields : NULL;
+    }
+
+    for (int j = 0; j < n_fields; j++) {
+
+      const _xdmf_field_t *fld = fields + j;
+      const char *a_type[] = {"Scalar", "Vector", "Tensor6", "Tensor"};
+      int t_id = 0;
+      if (fld->dim == 3)
+        t_id = 1;
+      else if (fld->dim == 6)
+        t_id = 2;
+      else if (fld->dim == 9)
+        t_id = 3;
+
+      /* Skip fields whose support does not match the geometry */
+
+      cs_gnum_t n_g_ents = (fld->location == FVM_WRITER_PER_NODE) ?
+        geom->n_g_vertices : geom->n_g_elements;
+      if (fld->n_g_ents != n_g_ents)
+        continue;
+
+      fprintf(f, "%s  <Attribute Name=\"", indent);
+      _xml_print_escaped(f, fld->name);
+      fprintf(f, "\" AttributeType=\"%s\" Center=\"%s\">\n",
+              a_type[t_id],
+              (fld->location == FVM_WRITER_PER_NODE) ? "Node" : "Cell");
+      _xml_data_item(w, f, d_indent, fld->n_g_ents, fld->dim, "Float",
+                     cs_datatype_size[fld->datatype],
+                     fld->file_id, fld->offset);
+      fprintf(f, "%s  </Attribute>\n", indent);
+
+    }
+
+  }
+
+  fprintf(f, "%s</Grid>\n", indent);
+}
+
+/*----------------------------------------------------------------------------
+ * Write XML description file (on rank 0 only).
+ *
+ * parameters:
+ *   w <-> pointer to XDMF writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_xml(fvm_to_xdmf_writer_t  *w)
+{
+  if (w->modified == false)
+    return;
+
+  w->modified = false;
+
+  if (w->rank > 0)
+    return;
+
+  char *file_name;
+  BFT_MALLOC(file_name, strlen(w->path) + strlen(w->name) + 5, char);
+  sprintf(file_name, "%s%s.xmf", w->path, w->name);
+
+  FILE *f = fopen(file_name, "w");
+
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file \"%s\":\n\n"
+                "  %s"), file_name, strerror(errno));
+
+  fprintf(f, "<?xml version=\"1.0\" ?>\n"
+          "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+          "<Xdmf Version=\"3.0\">\n"
+          "  <Domain>\n");
+
+  for (int i = 0; i < w->n_meshes; i++) {
+
+    const _xdmf_mesh_t *m = w->meshes + i;
+
+    if (m->n_steps > 0) {
+      fprintf(f, "    <Grid Name=\"");
+      _xml_print_escaped(f, m->name);
+      fprintf(f, "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n");
+      for (int j = 0; j < m->n_steps; j++) {
+        const _xdmf_step_t *s = m->steps + j;
+        if (s->geom_id > -1)
+          _xml_write_grid(w, f, m, m->geoms + s->geom_id, s);
+      }
+      fprintf(f, "    </Grid>\n");
+    }
+    else if (m->n_geoms > 0)
+      _xml_write_grid(w, f, m, m->geoms + m->n_geoms - 1, NULL);
+
+  }
+
+  fprintf(f, "  </Domain>\n"
+          "</Xdmf>\n");
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error closing file \"%s\":\n\n"
+                "  %s"), file_name, strerror(errno));
+
+  BFT_FREE(file_name);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to XDMF file writer.
+ *
+ * Heavy data (coordinates, connectivity and field values) is written
+ * to raw binary files using the cs_file API (thus MPI-IO when available),
+ * with one data file per output time step; the light data (XML) file is
+ * rewritten by rank 0 only when flushing or finalizing the writer.
+ *
+ * Options are:
+ *   double              output field values in double precision
+ *                       (single precision is used by default)
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque XDMF writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_xdmf_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency,
+                        MPI_Comm                comm)
+#else
+void *
+fvm_to_xdmf_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_xdmf_writer_t  *w = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_xdmf_writer_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  if (path != NULL) {
+    BFT_MALLOC(w->path, strlen(path) + 1, char);
+    strcpy(w->path, path);
+  }
+  else {
+    BFT_MALLOC(w->path, 1, char);
+    w->path[0] = '\0';
+  }
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+  w->double_precision = false;
+  w->discard_polygons = false;
+  w->discard_polyhedra = false;
+
+  w->time_dependency = time_dependency;
+
+  w->time_step = -1;
+  w->time_value = 0.;
+
+  w->n_data_files = 0;
+  w->data_file_name = NULL;
+  w->data_file = NULL;
+  w->data_file_ts = -1;
+  w->data_offset = 0;
+
+  w->n_meshes = 0;
+  w->meshes = NULL;
+
+  w->modified = false;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks, min_rank_step, min_block_size;
+    MPI_Comm w_block_comm, w_comm;
+    w->min_rank_step = 1;
+    w->min_block_size = 1024*1024*8;
+    w->block_comm = MPI_COMM_NULL;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+      cs_file_get_default_comm(&min_rank_step, &min_block_size,
+                               &w_block_comm, &w_comm);
+      if (comm == w_comm) {
+        w->min_rank_step = min_rank_step;
+        w->min_block_size = min_block_size;
+        w->block_comm = w_block_comm;
+      }
+      w->comm = comm;
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Parse options */
+
+  if (options != NULL) {
+
+    int i1, i2, l_opt;
+    int l_tot = strlen(options);
+
+    i1 = 0; i2 = 0;
+    while (i1 < l_tot) {
+
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+      l_opt = i2 - i1;
+
+      if ((l_opt == 6) && (strncmp(options + i1, "double", l_opt) == 0))
+        w->double_precision = true;
+
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "discard_polygons", l_opt) == 0))
+        w->discard_polygons = true;
+      else if (   (l_opt == 17)
+               && (strncmp(options + i1, "discard_polyhedra", l_opt) == 0))
+        w->discard_polyhedra = true;
+
+      for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
+
+    }
+
+  }
+
+  /* Return writer */
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to XDMF file writer.
+ *
+ * parameters:
+ *   writer <-- pointer to opaque XDMF writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_xdmf_finalize_writer(void  *writer)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  _close_data_file(w);
+  _write_xml(w);
+
+  for (int i = 0; i < w->n_meshes; i++) {
+    _xdmf_mesh_t *m = w->meshes + i;
+    for (int j = 0; j < m->n_steps; j++) {
+      _free_fields(m->steps[j].n_fields, m->steps[j].fields);
+      BFT_FREE(m->steps[j].fields);
+    }
+    _free_fields(m->n_const_fields, m->const_fields);
+    BFT_FREE(m->const_fields);
+    BFT_FREE(m->steps);
+    BFT_FREE(m->geoms);
+    BFT_FREE(m->name);
+  }
+  BFT_FREE(w->meshes);
+
+  for (int i = 0; i < w->n_data_files; i++)
+    BFT_FREE(w->data_file_name[i]);
+  BFT_FREE(w->data_file_name);
+
+  BFT_FREE(w->path);
+  BFT_FREE(w->name);
+
+  BFT_FREE(w);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an XDMF geometry.
+ *
+ * parameters:
+ *   writer     <-- pointer to associated writer
+ *   time_step  <-- time step number
+ *   time_value <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_set_mesh_time(void          *writer,
+                          const int      time_step,
+                          const double   time_value)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  w->time_step = time_step;
+  w->time_value = time_value;
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an XDMF file
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer.
+ *   mesh   <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_export_nodal(void               *writer,
+                         const fvm_nodal_t  *mesh)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  _xdmf_geom_t geom;
+
+  _xdmf_mesh_t *m = _get_mesh(w, mesh->name);
+
+  geom.file_id = _open_data_file(w, w->time_step);
+  geom.n_g_vertices = fvm_nodal_n_g_vertices(mesh);
+  geom.n_g_elements = 0;
+  geom.connect_size = 0;
+
+  /* Vertex coordinates */
+
+  geom.coords_offset = w->data_offset;
+
+  _write_coords(w, mesh);
+
+  /* Element connectivity, in export list order (so as to match
+     the ordering used for per-element field values) */
+
+  geom.connect_offset = w->data_offset;
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             fvm_nodal_get_max_entity_dim(mesh),
+                             true,
+                             false,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  const cs_gnum_t *g_vtx_num = NULL;
+  if (mesh->global_vertex_num != NULL)
+    g_vtx_num = fvm_io_num_get_global_num(mesh->global_vertex_num);
+
+  for (const fvm_writer_section_t *export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next) {
+
+    const fvm_nodal_section_t *section = export_section->section;
+
+    geom.n_g_elements += fvm_nodal_section_n_g_elements(section);
+    geom.connect_size += _write_section_connect(w, section, g_vtx_num);
+
+  }
+
+  BFT_FREE(export_list);
+
+  /* Update output history */
+
+  BFT_REALLOC(m->geoms, m->n_geoms + 1, _xdmf_geom_t);
+  m->geoms[m->n_geoms] = geom;
+  m->n_geoms += 1;
+
+  if (w->time_step > -1) {
+    _xdmf_step_t *s = _get_step(m, w->time_step, w->time_value);
+    s->geom_id = m->n_geoms - 1;
+  }
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an XDMF file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   writer           <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_export_field(void                  *writer,
+                         const fvm_nodal_t     *mesh,
+                         const char            *name,
+                         fvm_writer_var_loc_t   location,
+                         int                    dimension,
+                         cs_interlace_t         interlace,
+                         int                    n_parent_lists,
+                         const cs_lnum_t        parent_num_shift[],
+                         cs_datatype_t          datatype,
+                         int                    time_step,
+                         double                 time_value,
+                         const void      *const field_values[])
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  _xdmf_field_t fld;
+
+  /* Dimension */
+
+  int output_dim = dimension;
+  if (dimension == 2)
+    output_dim = 3;
+  else if (dimension > 3 && dimension != 6 && dimension != 9)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Data of dimension %d not handled"), dimension);
+
+  const int *comp_order = (dimension == 6) ? _xdmf_c_order_6 : NULL;
+
+  /* Build list of sections that are used here, in order of output */
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             fvm_nodal_get_max_entity_dim(mesh),
+                             true,
+                             false,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  if (location == FVM_WRITER_PER_ELEMENT && export_list == NULL)
+    return;
+
+  fld.name = NULL;
+  fld.dim = output_dim;
+  fld.location = location;
+  fld.datatype = (w->double_precision) ? CS_DOUBLE : CS_FLOAT;
+  fld.n_g_ents = 0;
+
+  if (location == FVM_WRITER_PER_NODE)
+    fld.n_g_ents = fvm_nodal_n_g_vertices(mesh);
+  else {
+    for (const fvm_writer_section_t *export_section = export_list;
+         export_section != NULL;
+         export_section = export_section->next)
+      fld.n_g_ents += fvm_nodal_section_n_g_elements(export_section->section);
+  }
+
+  fld.file_id = _open_data_file(w, time_step);
+  fld.offset = w->data_offset;
+
+  /* Initialize writer helper */
+
+  fvm_writer_field_helper_t *helper
+    = fvm_writer_field_helper_create(mesh,
+                                     export_list,
+                                     output_dim,
+                                     CS_INTERLACE,
+                                     fld.datatype,
+                                     location);
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1)
+    fvm_writer_field_helper_init_g(helper,
+                                   w->min_rank_step,
+                                   w->min_block_size,
+                                   w->comm);
+
+#endif
+
+  _xdmf_context_t c = {.writer = w};
+
+  /* Per node variable */
+
+  if (location == FVM_WRITER_PER_NODE)
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     comp_order,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  /* Per element variable */
+
+  else if (location == FVM_WRITER_PER_ELEMENT) {
+
+    const fvm_writer_section_t *export_section = export_list;
+
+    while (export_section != NULL)
+      export_section = fvm_writer_field_helper_output_e(helper,
+                                                        &c,
+                                                        export_section,
+                                                        dimension,
+                                                        interlace,
+                                                        comp_order,
+                                                        n_parent_lists,
+                                                        parent_num_shift,
+                                                        datatype,
+                                                        field_values,
+                                                        _field_output);
+
+  }
+
+  fvm_writer_field_helper_destroy(&helper);
+
+  BFT_FREE(export_list);
+
+  w->data_offset += (cs_file_off_t)(  fld.n_g_ents * output_dim
+                                    * cs_datatype_size[fld.datatype]);
+
+  /* Update output history */
+
+  _xdmf_mesh_t *m = _get_mesh(w, mesh->name);
+
+  if (time_step < 0)
+    _add_field(&(m->n_const_fields), &(m->const_fields), fld, name);
+  else {
+    _xdmf_step_t *s = _get_step(m, time_step, time_value);
+    _add_field(&(s->n_fields), &(s->fields), fld, name);
+  }
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * In this case, the current binary data file is closed, and the XML
+ * description file is updated if needed.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_flush(void  *writer)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)writer;
+
+  _close_data_file(w);
+  _write_xml(w);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -107,6 +107,8 @@ typedef struct {
   cs_lagr_moment_p_data_t  *p_data_func;  /* Associated particle data value
                                              computation function (statistical
                                              weight assumed if NULL) */
+  bool                      p_data_serial; /* If true, p_data_func is called
+                                              by a single thread */
   cs_lagr_moment_m_data_t  *m_data_func;  /* Associated mesh data value
                                              computation function, or NULL */
   const void               *data_input;   /* pointer to optional (untyped)
@@ -138,6 +140,8 @@ typedef struct {
 
   cs_lagr_moment_p_data_t  *p_data_func;  /* Associated particle data elements
                                              computation function, or NULL */
+  bool                      p_data_serial; /* If true, p_data_func is called
+                                              by a single thread */
   cs_lagr_moment_m_data_t  *m_data_func;  /* Associated mesh data elements
                                              computation function, or NULL */
   const void               *data_input;   /* pointer to optional (untyped)
@@ -200,6 +204,18 @@ typedef struct {
  * Local structure definitions
  *============================================================================*/
 
+/* Particle-based moment update context */
+
+typedef struct {
+
+  cs_lagr_moment_t  *mt;          /* Associated moment */
+  int                attr_id;     /* Associated attribute id */
+  cs_real_t         *val;         /* Moment values */
+  cs_real_t         *mean_val;    /* Lower order moment values for variance,
+                                     or NULL */
+
+} cs_lagr_moment_p_update_t;
+
 /*=============================================================================
  * Local Enumeration definitions
  *============================================================================*/
@@ -1270,6 +1286,7 @@ _find_or_add_wa(cs_lagr_moment_p_data_t  *p_data_func,
   mwa->class = class_id;
 
   mwa->p_data_func = p_data_func;
+  mwa->p_data_serial = (p_data_func != NULL) ? true : false;
   mwa->m_data_func = m_data_func;
   mwa->data_input = data_input;
 
@@ -1436,6 +1453,7 @@ _find_or_add_moment(int                       location_id,
   mt->location_id = location_id;
 
   mt->p_data_func = p_data_func;
+  mt->p_data_serial = (p_data_func != NULL) ? true : false;
   mt->m_data_func = m_data_func;
   mt->data_input = data_input;
 
@@ -1797,6 +1815,312 @@ _cs_lagr_stat_update_mesh_moment(cs_lagr_moment_t           *mt,
   BFT_FREE(x);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build an index of particles by cell.
+ *
+ * Particles are ordered by cell, and keep their relative order inside
+ * each cell, so that moments may be updated cell by cell with the same
+ * sequence of particle contributions as a loop on particles.
+ * Particles not located in a cell are not indexed.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   p_set       pointer to particle set
+ * \param[out]  c_p_idx     index of particles in each cell (size: n_cells+1)
+ * \param[out]  c_p_ids     particle ids, ordered by cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_particle_index(const cs_lagr_particle_set_t   *p_set,
+                     cs_lnum_t                     **c_p_idx,
+                     cs_lnum_t                     **c_p_ids)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  cs_lnum_t *_c_p_idx, *_c_p_ids, *p_cell_id;
+
+  BFT_MALLOC(_c_p_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(p_cell_id, p_set->n_particles, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    _c_p_idx[i] = 0;
+
+  for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+    const unsigned char *particle
+      = p_set->p_buffer + p_set->p_am->extents * part;
+    cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_set->p_am);
+    p_cell_id[part] = cell_id;
+    if (cell_id >= 0)
+      _c_p_idx[cell_id + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _c_p_idx[i+1] += _c_p_idx[i];
+
+  BFT_MALLOC(_c_p_ids, _c_p_idx[n_cells], cs_lnum_t);
+
+  for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+    cs_lnum_t cell_id = p_cell_id[part];
+    if (cell_id >= 0) {
+      _c_p_ids[_c_p_idx[cell_id]] = part;
+      _c_p_idx[cell_id] += 1;
+    }
+  }
+
+  /* Shift index back after fill */
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    _c_p_idx[i] = _c_p_idx[i-1];
+  _c_p_idx[0] = 0;
+
+  BFT_FREE(p_cell_id);
+
+  *c_p_idx = _c_p_idx;
+  *c_p_ids = _c_p_ids;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a particle-based moment with the contribution of a
+ *        given particle.
+ *
+ * \param[in, out]  mu        pointer to moment update context
+ * \param[in]       cell_id   id of cell containing particle
+ * \param[in]       p_weight  weight of current particle
+ * \param[in]       wa_sum    accumulated weight before current particle
+ * \param[in]       pval      particle values
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_update_p_moment(cs_lagr_moment_p_update_t  *mu,
+                 cs_lnum_t                   cell_id,
+                 cs_real_t                   p_weight,
+                 cs_real_t                   wa_sum,
+                 const cs_real_t            *pval)
+{
+  const cs_lagr_moment_t *mt = mu->mt;
+  cs_real_t *restrict val = mu->val;
+  cs_real_t *restrict mean_val = mu->mean_val;
+
+  /* update weight sum with new particle weight */
+  const cs_real_t wa_sum_n = p_weight + wa_sum;
+
+  if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+    if (mt->dim == 6) { /* variance-covariance matrix */
+
+      assert(mt->data_dim == 3);
+
+      double delta[3], delta_n[3], r[3], m_n[3];
+
+      for (int l = 0; l < 3; l++) {
+
+        cs_lnum_t jl = cell_id*6 + l;
+        cs_lnum_t jml = cell_id*3 + l;
+        delta[l]   = pval[l] - mean_val[jml];
+        r[l] = delta[l] * (p_weight / (fmax(wa_sum_n, 1e-100)));
+        m_n[l] = mean_val[jml] + r[l];
+        delta_n[l] = pval[l] - m_n[l];
+        val[jl] = (  val[jl]*wa_sum
+                   + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+
+      }
+
+      /* Covariance terms.
+         Note we could have a symmetric formula using
+         0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+         instead of
+         delta[i]*delta_n[j]
+         but unit tests in cs_moment_test.c do not seem to favor
+         one variant over the other; we use the simplest one.  */
+
+      cs_lnum_t j3 = cell_id*6 + 3,
+                j4 = cell_id*6 + 4,
+                j5 = cell_id*6 + 5;
+
+      val[j3] = (  val[j3]*wa_sum
+                 + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+      val[j4] = (  val[j4]*wa_sum
+                 + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+      val[j5] = (  val[j5]*wa_sum
+                 + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+
+      /* update mean value */
+
+      for (cs_lnum_t l = 0; l < 3; l++)
+        mean_val[cell_id*3 + l] += r[l];
+
+    }
+
+    else { /* simple variance */
+
+      /* new weight for the cell: weight attached to
+         current particle (=dt*weight) plus old weight */
+
+      const cs_lnum_t dim = mt->dim;
+
+      for (cs_lnum_t l = 0; l < dim; l++) {
+
+        double delta = pval[l] - mean_val[cell_id*dim+l];
+        double r = delta * (p_weight / (fmax(wa_sum_n, 1e-100)));
+        double m_n = mean_val[cell_id*dim+l] + r;
+
+        val[cell_id*dim+l]
+          = (  val[cell_id*dim+l]*wa_sum
+             + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+
+        /* update mean value */
+
+        mean_val[cell_id*dim+l] += r;
+
+      }
+
+    }
+
+  }
+
+  else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+
+    const cs_lnum_t dim = mt->dim;
+
+    for (cs_lnum_t l = 0; l < dim; l++)
+      val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
+                            * p_weight / (fmax(wa_sum_n, 1e-100));
+
+  } /* End of test if moment is a variance or a mean */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update all particle-based moments associated with a given
+ *        weight accumulator in a single pass over particles.
+ *
+ * Particles are visited cell by cell using a cell to particles index,
+ * so that cells may be handled by separate threads, while the sequence of
+ * updates for each cell is the same as that of a loop on particles.
+ * If any of the associated particle data functions is flagged as serial,
+ * a single thread is used.
+ * The weight of each particle is computed only once for all moments.
+ *
+ * Particle data functions (weight and moment functions) may thus be
+ * called simultaneously by several threads, each with its own output
+ * buffer, so they must be thread-safe.
+ *
+ * \param[in]       mwa        pointer to weight accumulator
+ * \param[in]       n_mu       number of moments to update
+ * \param[in, out]  mu         moment update contexts
+ * \param[in]       p_set      pointer to particle set
+ * \param[in]       c_p_idx    index of particles in each cell
+ * \param[in]       c_p_ids    particle ids, ordered by cell
+ * \param[in]       dt         cell time step values
+ * \param[in, out]  l_wa_sum   accumulated weight
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_p_moments(const cs_lagr_moment_wa_t     *mwa,
+                  int                            n_mu,
+                  cs_lagr_moment_p_update_t      mu[],
+                  const cs_lagr_particle_set_t  *p_set,
+                  const cs_lnum_t                c_p_idx[],
+                  const cs_lnum_t                c_p_ids[],
+                  const cs_real_t               *restrict dt,
+                  cs_real_t                     *restrict l_wa_sum)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  const int class = mwa->class;
+
+  /* Work buffer for values computed by particle functions */
+
+  int p_data_dim = 0;
+  for (int i = 0; i < n_mu; i++) {
+    if (mu[i].mt->p_data_func != NULL)
+      p_data_dim = CS_MAX(p_data_dim, mu[i].mt->data_dim);
+  }
+
+  /* Particle data functions which are not known to be thread-safe
+     (user-defined functions by default) require a serial loop */
+
+  bool serial = mwa->p_data_serial;
+  for (int i = 0; i < n_mu; i++) {
+    if (mu[i].mt->p_data_serial)
+      serial = true;
+  }
+
+  cs_real_t *pval_buf = NULL;
+  BFT_MALLOC(pval_buf, p_data_dim*cs_glob_n_threads, cs_real_t);
+
+# pragma omp parallel if (n_cells > CS_THR_MIN && !serial)
+  {
+    int t_id = 0;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+#endif
+    cs_real_t *t_pval = pval_buf + p_data_dim*t_id;
+
+#   pragma omp for schedule(dynamic)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+      for (cs_lnum_t j = c_p_idx[cell_id]; j < c_p_idx[cell_id+1]; j++) {
+
+        const unsigned char *particle
+          = p_set->p_buffer + p_am->extents * c_p_ids[j];
+
+        int p_class = 0;
+        if (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
+          p_class = cs_lagr_particle_get_lnum(particle,
+                                              p_am,
+                                              CS_LAGR_STAT_CLASS);
+
+        if (p_class != class && class != 0)
+          continue;
+
+        /* weight associated to current particle */
+
+        cs_real_t p_weight;
+
+        if (mwa->p_data_func == NULL)
+          p_weight = cs_lagr_particle_get_real(particle,
+                                               p_am,
+                                               CS_LAGR_STAT_WEIGHT);
+        else
+          mwa->p_data_func(mwa->data_input,
+                           particle,
+                           p_am,
+                           &p_weight);
+        p_weight *= dt[cell_id];
+
+        for (int i = 0; i < n_mu; i++) {
+
+          const cs_lagr_moment_t *mt = mu[i].mt;
+          const cs_real_t *pval = t_pval;
+
+          if (mt->p_data_func == NULL)
+            pval = cs_lagr_particle_attr_const(particle, p_am, mu[i].attr_id);
+          else
+            mt->p_data_func(mt->data_input, particle, p_am, t_pval);
+
+          _update_p_moment(mu + i, cell_id, p_weight, l_wa_sum[cell_id], pval);
+
+        }
+
+        /* update local weight associated to current class */
+
+        l_wa_sum[cell_id] += p_weight;
+
+      } /* end of loop on cell particles */
+
+    } /* end of loop on cells */
+
+  }
+
+  BFT_FREE(pval_buf);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all moment accumulators.
@@ -1812,6 +2136,10 @@ _cs_lagr_stat_update_all(void)
 
   _t_prev_iter = ts->t_prev;
 
+  /* Index of particles by cell, built when first needed */
+
+  cs_lnum_t *c_p_idx = NULL, *c_p_ids = NULL;
+
   /* Outer loop in weight accumulators, to avoid recomputing weights
      too many times */
 
@@ -1850,10 +2178,18 @@ _cs_lagr_stat_update_all(void)
     cs_real_t m_w0[1];
     cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
 
-    if (m_weight == NULL)
+    if (m_weight == NULL) {
       BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
+      for (cs_lnum_t j = 0; j < n_w_elts; j++)
+        l_wa_sum[j] = g_wa_sum[j];
+    }
 
-    /* Loop on variances first, then means */
+    /* Loop on variances first, then means; particle-based moments
+       are gathered, so as to be updated in a single pass on particles */
+
+    int n_mu = 0;
+    cs_lagr_moment_p_update_t *mu = NULL;
+    BFT_MALLOC(mu, _n_lagr_stats, cs_lagr_moment_p_update_t);
 
     for (int m_type = CS_LAGR_MOMENT_VARIANCE;
          m_type >= (int)CS_LAGR_MOMENT_MEAN;
@@ -1869,192 +2205,50 @@ _cs_lagr_stat_update_all(void)
             && mwa->nt_start <= ts->nt_cur
             && mt->nt_cur < ts->nt_cur) {
 
-          int attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
-
           _ensure_init_moment(mt);
 
-          /* Copy weight sum content to a local array
-             for every new moment inside the current class */
-
-          for (cs_lnum_t j = 0; j < n_w_elts; j++)
-            l_wa_sum[j]= g_wa_sum[j];
-
           /* Case where data is particle-based */
           /*-----------------------------------*/
 
           if (mt->m_data_func == NULL) {
 
-            cs_real_t *restrict val = mt->val;
+            assert(l_wa_sum != NULL && mt->class == mwa->class);
+
+            cs_lagr_moment_p_update_t *_mu = mu + n_mu;
+            n_mu++;
 
+            _mu->mt = mt;
+            _mu->attr_id = cs_lagr_stat_type_to_attr_id(mt->stat_type);
+
+            _mu->val = mt->val;
             if (mt->f_id > -1) {
               cs_field_t *f = cs_field_by_id(mt->f_id);
-              val = f->val;
+              _mu->val = f->val;
             }
 
-            /* prepare submoment definition */
-
-            cs_lagr_moment_t *mt_mean = NULL;
-            cs_real_t *restrict mean_val = NULL;
+            /* Check if lower moment is defined and attached;
+               it is updated along with the variance */
 
-            /* Check if lower moment is defined and attached */
+            _mu->mean_val = NULL;
 
             if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
 
               assert(mt->l_id > -1);
-              mt_mean = _lagr_stats + mt->l_id;
+              cs_lagr_moment_t *mt_mean = _lagr_stats + mt->l_id;
               _ensure_init_moment(mt_mean);
 
-              mean_val = mt_mean->val;
+              _mu->mean_val = mt_mean->val;
 
               if (mt_mean->f_id > -1) {
                 cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-                mean_val = f_mean->val;
+                _mu->mean_val = f_mean->val;
               }
 
-            }
-
-            cs_real_t *pval = NULL;
-            if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
-
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
-
-              cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle,
-                                                               p_set->p_am);
-
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
-
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
-
-                /* weight associated to current particle */
-
-                cs_real_t p_weight;
-
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id];
-
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
-
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = p_weight + l_wa_sum[cell_id];
-
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-
-                  if (mt->dim == 6) { /* variance-covariance matrix */
-
-                    assert(mt->data_dim == 3);
-
-                    double delta[3], delta_n[3], r[3], m_n[3];
-
-                    for (int l = 0; l < 3; l++) {
-
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / (fmax(wa_sum_n, 1e-100)));
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
-
-                    }
-
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
-
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
-
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
-
-                    /* update mean value */
-
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
-
-                  }
-
-                  else { /* simple variance */
-
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
-
-                    const cs_lnum_t dim = mt->dim;
-
-                    for (cs_lnum_t l = 0; l < dim; l++) {
-
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / (fmax(wa_sum_n, 1e-100)));
-                      double m_n = mean_val[cell_id*dim+l] + r;
-
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
-
-                      /* update mean value */
-
-                      mean_val[cell_id*dim+l] += r;
-
-                    }
-
-                  }
-
-                }
-
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
-
-                  const cs_lnum_t dim = mt->dim;
-
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / (fmax(wa_sum_n, 1e-100));
-
-                } /* End of test if moment is a variance or a mean */
-
-                /* update local weight associated to current moment and class */
-
-                l_wa_sum[cell_id] += p_weight;
-
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
-
-            } /* end of loop on particles */
+              mt_mean->nt_cur = ts->nt_cur;
 
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
+            }
 
             mt->nt_cur = ts->nt_cur;
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
-              mt_mean->nt_cur = ts->nt_cur;
           }
 
           /* Case where data is mesh-based */
@@ -2072,6 +2266,17 @@ _cs_lagr_stat_update_all(void)
 
     } /* End of loop on moments */
 
+    /* Fused update of particle-based moments */
+
+    if (n_mu > 0) {
+      if (c_p_idx == NULL)
+        _cell_particle_index(p_set, &c_p_idx, &c_p_ids);
+      _update_p_moments(mwa, n_mu, mu, p_set, c_p_idx, c_p_ids,
+                        dt_val, l_wa_sum);
+    }
+
+    BFT_FREE(mu);
+
     /* At end of loop on moments inside a class, update
        global class weight array */
 
@@ -2087,6 +2292,9 @@ _cs_lagr_stat_update_all(void)
     }
 
   } /* End of loop on active weigh accumulators */
+
+  BFT_FREE(c_p_idx);
+  BFT_FREE(c_p_ids);
 }
 
 
@@ -2589,6 +2797,73 @@ cs_lagr_stat_time_moment_define(const char                *name,
                       restart_mode);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow or forbid concurrent calls to the particle data function
+ *        of a particle statistic.
+ *
+ * Statistics defined with a particle data function (usually user-defined)
+ * are updated by a single thread by default. If that function only writes
+ * to its output values, it may be flagged as thread-safe using this
+ * function, so that particles in different cells may be handled by
+ * separate threads.
+ *
+ * \param[in]  stat_id  id of statistic (as returned by its definition)
+ * \param[in]  serial   if true, call data function from a single thread
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_stat_set_serial(int   stat_id,
+                        bool  serial)
+{
+  if (stat_id < 0 || stat_id >= _n_lagr_stats)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Lagrangian statistic id %d is not defined."), stat_id);
+
+  cs_lagr_moment_t *mt = _lagr_stats + stat_id;
+
+  if (mt->p_data_func != NULL)
+    mt->p_data_serial = serial;
+
+  /* Apply to lower order moment (mean for variance) */
+
+  if (mt->l_id > -1) {
+    mt = _lagr_stats + mt->l_id;
+    if (mt->p_data_func != NULL)
+      mt->p_data_serial = serial;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow or forbid concurrent calls to the particle weight function
+ *        of a particle weight accumulator.
+ *
+ * As for \ref cs_lagr_stat_set_serial, accumulators defined with a
+ * particle weight function are updated by a single thread by default.
+ *
+ * \param[in]  wa_id    id of weight accumulator (as returned by
+ *                      \ref cs_lagr_stat_accumulator_define)
+ * \param[in]  serial   if true, call weight function from a single thread
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_stat_accumulator_set_serial(int   wa_id,
+                                    bool  serial)
+{
+  if (wa_id < 0 || wa_id >= _n_lagr_stats_wa)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Lagrangian statistics weight accumulator id %d "
+                "is not defined."), wa_id);
+
+  cs_lagr_moment_wa_t *mwa = _lagr_stats_wa + wa_id;
+
+  if (mwa->p_data_func != NULL)
+    mwa->p_data_serial = serial;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Activate Lagrangian statistics for a given statistics type.
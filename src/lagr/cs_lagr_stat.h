@@ -93,6 +93,13 @@ typedef enum {
  * when the selection function is called, so that value or structure should
  * not be temporary (i.e. local);
  *
+ * Such functions are called by a single thread unless the matching
+ * statistic is flagged otherwise (see \ref cs_lagr_stat_set_serial and
+ * \ref cs_lagr_stat_accumulator_set_serial). In that case, they may be
+ * called simultaneously by several threads (for particles in different
+ * cells), so they should only write to the vals array, and not modify
+ * the input structure or other shared data.
+ *
  * parameters:
  *   input    <-- pointer to optional (untyped) value or structure.
  *   particle <-- pointer to particle data
@@ -299,6 +306,44 @@ cs_lagr_stat_time_moment_define(const char                *name,
                                 double                     t_start,
                                 cs_lagr_stat_restart_t     restart_mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow or forbid concurrent calls to the particle data function
+ *        of a particle statistic.
+ *
+ * Statistics defined with a particle data function (usually user-defined)
+ * are updated by a single thread by default. If that function only writes
+ * to its output values, it may be flagged as thread-safe using this
+ * function, so that particles in different cells may be handled by
+ * separate threads.
+ *
+ * \param[in]  stat_id  id of statistic (as returned by its definition)
+ * \param[in]  serial   if true, call data function from a single thread
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_stat_set_serial(int   stat_id,
+                        bool  serial);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow or forbid concurrent calls to the particle weight function
+ *        of a particle weight accumulator.
+ *
+ * As for \ref cs_lagr_stat_set_serial, accumulators defined with a
+ * particle weight function are updated by a single thread by default.
+ *
+ * \param[in]  wa_id    id of weight accumulator (as returned by
+ *                      \ref cs_lagr_stat_accumulator_define)
+ * \param[in]  serial   if true, call weight function from a single thread
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_stat_accumulator_set_serial(int   wa_id,
+                                    bool  serial);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Activate Lagrangian statistics for a given statistics type.
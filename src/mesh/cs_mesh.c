@@ -2834,6 +2834,8 @@ cs_mesh_init_halo(cs_mesh_t          *mesh,
                         &gcell_vtx_idx,
                         &gcell_vtx_lst);
 
+    cs_halo_shared_memory_init(mesh->halo);
+
     cs_interface_set_destroy(&face_interfaces);
 
     t2 = cs_timer_wtime();
@@ -808,13 +808,13 @@ cs_mesh_bad_cells_get_options(int  compute[2],
     cs_mesh_bad_cells_set_options(0, 1, 1);
 
   if (compute != NULL) {
-    compute[0] = _type_flag_compute[0] = 0;
-    compute[1] = _type_flag_compute[1] = 0;
+    compute[0] = _type_flag_compute[0];
+    compute[1] = _type_flag_compute[1];
   }
 
   if (visualize != NULL) {
-    visualize[0] = _type_flag_visualize[0] = 0;
-    visualize[1] = _type_flag_visualize[1] = 0;
+    visualize[0] = _type_flag_visualize[0];
+    visualize[1] = _type_flag_visualize[1];
   }
 }
 
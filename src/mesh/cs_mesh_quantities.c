@@ -52,6 +52,7 @@
 #include "cs_mesh_connect.h"
 #include "cs_parall.h"
 #include "cs_bad_cells_regularisation.h"
+#include "cs_mesh_bad_cells.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -111,25 +112,56 @@ unsigned cs_glob_mesh_quantities_flag = 0;
 /* Choice of the porous model */
 int cs_glob_porous_model = 0;
 
-/* Number of computation updates */
+/* Number of computation updates (all, and those of cocg matrices) */
 
 static int _n_computations = 0;
+static int _n_cocg_computations = 0;
 
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Allocate a mesh quantities array, initializing it so that its memory
+ * is first touched by the threads which will later operate on it.
+ *
+ * parameters:
+ *   numbering <-- associated numbering, or NULL
+ *   n_elts    <-- number of elements
+ *   stride    <-- number of values per element
+ *
+ * returns:
+ *   pointer to allocated array
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_alloc_touched(const cs_numbering_t  *numbering,
+               cs_lnum_t              n_elts,
+               cs_lnum_t              stride)
+{
+  cs_real_t *a = NULL;
+
+  BFT_MALLOC(a, n_elts*stride, cs_real_t);
+
+  cs_numbering_first_touch(numbering, n_elts, stride*sizeof(cs_real_t), a);
+
+  return a;
+}
+
 /*----------------------------------------------------------------------------
  * Compute 3x3 matrix cocg for the scalar gradient iterative algorithm
  *
  * parameters:
- *   m    <--  mesh
- *   fvq  <->  mesh quantities
+ *   m         <--  mesh
+ *   fvq       <->  mesh quantities
+ *   c_update  <--  cells for which the matrix is computed (others keep
+ *                  their current values), or NULL for all
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_cell_cocg_s_it(const cs_mesh_t         *m,
-                        cs_mesh_quantities_t    *fvq)
+                        cs_mesh_quantities_t    *fvq,
+                        const bool               c_update[])
 {
   const int n_cells = m->n_cells;
   const int n_cells_ext = m->n_cells_with_ghosts;
@@ -166,6 +198,8 @@ _compute_cell_cocg_s_it(const cs_mesh_t         *m,
 
 # pragma omp parallel for
   for (cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+    if (c_update != NULL && !c_update[cell_id])
+      continue;
     cocg[cell_id][0][0] = cell_vol[cell_id];
     cocg[cell_id][0][1] = 0.0;
     cocg[cell_id][0][2] = 0.0;
@@ -191,11 +225,16 @@ _compute_cell_cocg_s_it(const cs_mesh_t         *m,
         ii = i_face_cells[face_id][0];
         jj = i_face_cells[face_id][1];
 
+        bool update_i = (c_update == NULL || c_update[ii]);
+        bool update_j = (c_update == NULL || c_update[jj]);
+
         for (ll = 0; ll < 3; ll++) {
           for (mm = 0; mm < 3; mm++) {
             fctb[mm] = -dofij[face_id][mm] * 0.5 * i_face_normal[face_id][ll];
-            cocg[ii][ll][mm] += fctb[mm];
-            cocg[jj][ll][mm] -= fctb[mm];
+            if (update_i)
+              cocg[ii][ll][mm] += fctb[mm];
+            if (update_j)
+              cocg[jj][ll][mm] -= fctb[mm];
           }
         }
 
@@ -210,6 +249,8 @@ _compute_cell_cocg_s_it(const cs_mesh_t         *m,
 # pragma omp parallel for private(cell_id, ll, mm)
   for (ii = 0; ii < m->n_b_cells; ii++) {
     cell_id = m->b_cells[ii];
+    if (c_update != NULL && !c_update[cell_id])
+      continue;
     for (ll = 0; ll < 3; ll++) {
       for (mm = 0; mm < 3; mm++)
         cocgb[ii][ll][mm] = cocg[cell_id][ll][mm];
@@ -222,23 +263,242 @@ _compute_cell_cocg_s_it(const cs_mesh_t         *m,
   /* The cocg term for interior cells only changes if the mesh does */
 
 # pragma omp parallel for
-  for (cell_id = 0; cell_id < n_cells; cell_id++)
-    cs_math_33_inv_cramer_in_place(cocg[cell_id]);
+  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+    if (c_update == NULL || c_update[cell_id])
+      cs_math_33_inv_cramer_in_place(cocg[cell_id]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute 3x3 matrix cocg for the scalar gradient least squares algorithm,
+ * with reduced precision storage only.
+ *
+ * The matrix is accumulated in a symmetric full precision work array
+ * (6 values per cell), which is then inverted and compacted in place
+ * to single precision, so the full 3x3 double precision matrix is never
+ * allocated.
+ *
+ * parameters:
+ *   m         <--  mesh
+ *   fvq       <->  mesh quantities
+ *   c_update  <--  cells for which the matrix is computed (others keep
+ *                  their current values), or NULL for all
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_cell_cocg_lsq_r(const cs_mesh_t        *m,
+                         cs_mesh_quantities_t   *fvq,
+                         const bool              c_update[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+
+  /* Symmetric storage: (11, 22, 33, 12, 23, 13) */
+
+  const int sym_l[6] = {0, 1, 2, 0, 1, 0};
+  const int sym_m[6] = {0, 1, 2, 1, 2, 2};
+
+  cs_real_33_t *restrict cocgb = fvq->cocgb_s_lsq;
+  if (cocgb == NULL) {
+    BFT_MALLOC(cocgb, m->n_b_cells, cs_real_33_t);
+    fvq->cocgb_s_lsq = cocgb;
+  }
+
+  /* Release previous storage first so as not to add to peak memory,
+     unless it contains values which are kept */
+
+  float *cocg_r_prev = NULL;
+
+  if (c_update != NULL)
+    cocg_r_prev = fvq->cocg_lsq_r;
+  else
+    BFT_FREE(fvq->cocg_lsq_r);
+  fvq->cocg_lsq_r = NULL;
+
+  cs_real_6_t *cocg_s = NULL;
+  BFT_MALLOC(cocg_s, n_cells_ext, cs_real_6_t);
+
+  /* Initialization (rows of kept cells are not used later on) */
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+    for (int k = 0; k < 6; k++)
+      cocg_s[cell_id][k] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        if (c_update != NULL && !(c_update[ii] || c_update[jj]))
+          continue;
+
+        cs_real_3_t dc;
+        for (int ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (int k = 0; k < 6; k++) {
+          cs_real_t c = dc[sym_l[k]] * dc[sym_m[k]] * ddc;
+          cocg_s[ii][k] += c;
+          cocg_s[jj][k] += c;
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (m->halo_type == CS_HALO_EXTENDED) {
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      if (c_update != NULL && !c_update[ii])
+        continue;
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_3_t dc;
+        for (int ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (int k = 0; k < 6; k++)
+          cocg_s[ii][k] += dc[sym_l[k]] * dc[sym_m[k]] * ddc;
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Save partial cocg at interior faces of boundary cells */
+
+# pragma omp parallel for if (m->n_b_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t cell_id = m->b_cells[ii];
+    if (c_update != NULL && !c_update[cell_id])
+      continue;
+    const cs_real_t *s = cocg_s[cell_id];
+    cocgb[ii][0][0] = s[0]; cocgb[ii][1][1] = s[1]; cocgb[ii][2][2] = s[2];
+    cocgb[ii][0][1] = s[3]; cocgb[ii][1][0] = s[3];
+    cocgb[ii][1][2] = s[4]; cocgb[ii][2][1] = s[4];
+    cocgb[ii][0][2] = s[5]; cocgb[ii][2][0] = s[5];
+  }
+
+  /* Contribution from boundary faces, assuming symmetry everywhere
+     so as to avoid obtaining a non-invertible matrix in 2D cases. */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        cs_real_t udbfs = 1. / b_face_surf[face_id];
+
+        cs_real_3_t dddij;
+        for (int ll = 0; ll < 3; ll++)
+          dddij[ll] = udbfs * b_face_normal[face_id][ll];
+
+        for (int k = 0; k < 6; k++)
+          cocg_s[ii][k] += dddij[sym_l[k]]*dddij[sym_m[k]];
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Invert and compact to reduced precision in place; values of cell i
+     only overwrite those of cells <= i/2, which have already been read,
+     so this loop must be done sequentially in increasing cell order. */
+
+  float *cocg_r = (float *)cocg_s;
+
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+    cs_real_t s[6];
+    if (c_update != NULL && !c_update[cell_id]) {
+      for (int k = 0; k < 6; k++)
+        s[k] = cocg_r_prev[cell_id*6 + k];
+    }
+    else if (cell_id < n_cells)
+      cs_math_sym_33_inv_cramer(cocg_s[cell_id], s);
+    else {
+      for (int k = 0; k < 6; k++)
+        s[k] = cocg_s[cell_id][k];
+    }
+    for (int k = 0; k < 6; k++)
+      cocg_r[cell_id*6 + k] = s[k];
+  }
+
+  BFT_FREE(cocg_r_prev);
+
+  BFT_REALLOC(cocg_r, n_cells_ext*6, float);
+  fvq->cocg_lsq_r = cocg_r;
 }
 
 /*----------------------------------------------------------------------------
  * Compute 3x3 matrix cocg for the scalar gradient least squares algorithm
  *
+ * Partial updates (c_update != NULL) are not available with internal
+ * coupling.
+ *
  * parameters:
- *   m    <--  mesh
- *   fvq  <->  mesh quantities
- *   ce   <->  coupling entity
+ *   m         <--  mesh
+ *   fvq       <->  mesh quantities
+ *   ce        <->  coupling entity
+ *   c_update  <--  cells for which the matrix is computed (others keep
+ *                  their current values), or NULL for all
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_cell_cocg_lsq(const cs_mesh_t        *m,
                        cs_mesh_quantities_t   *fvq,
-                       cs_internal_coupling_t *ce)
+                       cs_internal_coupling_t *ce,
+                       const bool              c_update[])
 {
   const int n_cells = m->n_cells;
   const int n_cells_ext = m->n_cells_with_ghosts;
@@ -283,11 +543,27 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
   cs_real_t  ddc, udbfs;
   cs_real_3_t  dc, dddij;
 
+  /* With reduced precision storage only, avoid building the full
+     precision matrix (not possible with internal coupling) */
+
+  if (   cocg == NULL && ce == NULL
+      && (cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_REDUCED_PRECISION)
+      && !(cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_PRECISION_CHECK)) {
+    _compute_cell_cocg_lsq_r(m, fvq, c_update);
+    return;
+  }
+
+  assert(ce == NULL || c_update == NULL);
+
+  /* Otherwise, with reduced precision storage, the full precision matrix
+     is only used as a work array here */
+
+  if (cocg == NULL) {
+    BFT_MALLOC(cocg, n_cells_ext, cs_real_33_t);
+    fvq->cocg_lsq = cocg;
+  }
+
   if (ce == NULL) {
-    if (cocg == NULL) {
-      BFT_MALLOC(cocg, n_cells_ext, cs_real_33_t);
-      fvq->cocg_lsq = cocg;
-    }
     if (cocgb == NULL) {
       BFT_MALLOC(cocgb, m->n_b_cells, cs_real_33_t);
       fvq->cocgb_s_lsq = cocgb;
@@ -303,6 +579,8 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
 
 # pragma omp parallel for private(ll, mm)
   for (cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+    if (c_update != NULL && !c_update[cell_id])
+      continue;
     for (ll = 0; ll < 3; ll++) {
       for (mm = 0; mm < 3; mm++)
         cocg[cell_id][ll][mm] = 0.0;
@@ -323,17 +601,27 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
         ii = i_face_cells[face_id][0];
         jj = i_face_cells[face_id][1];
 
+        bool update_i = (c_update == NULL || c_update[ii]);
+        bool update_j = (c_update == NULL || c_update[jj]);
+
+        if (!(update_i || update_j))
+          continue;
+
         for (ll = 0; ll < 3; ll++)
           dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
         ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (ll = 0; ll < 3; ll++) {
-          for (mm = 0; mm < 3; mm++)
-            cocg[ii][ll][mm] += dc[ll] * dc[mm] * ddc;
+        if (update_i) {
+          for (ll = 0; ll < 3; ll++) {
+            for (mm = 0; mm < 3; mm++)
+              cocg[ii][ll][mm] += dc[ll] * dc[mm] * ddc;
+          }
         }
-        for (ll = 0; ll < 3; ll++) {
-          for (mm = 0; mm < 3; mm++)
-            cocg[jj][ll][mm] += dc[ll] * dc[mm] * ddc;
+        if (update_j) {
+          for (ll = 0; ll < 3; ll++) {
+            for (mm = 0; mm < 3; mm++)
+              cocg[jj][ll][mm] += dc[ll] * dc[mm] * ddc;
+          }
         }
 
       } /* loop on faces */
@@ -360,6 +648,8 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
 
 #   pragma omp parallel for private(jj, ll, mm, ddc, dc)
     for (ii = 0; ii < n_cells; ii++) {
+      if (c_update != NULL && !c_update[ii])
+        continue;
       for (cs_lnum_t cidx = cell_cells_idx[ii];
            cidx < cell_cells_idx[ii+1];
            cidx++) {
@@ -385,6 +675,8 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
 # pragma omp parallel for private(cell_id, ll, mm)
   for (ii = 0; ii < m->n_b_cells; ii++) {
     cell_id = m->b_cells[ii];
+    if (c_update != NULL && !c_update[cell_id])
+      continue;
     for (ll = 0; ll < 3; ll++) {
       for (mm = 0; mm < 3; mm++)
         cocgb[ii][ll][mm] = cocg[cell_id][ll][mm];
@@ -407,6 +699,9 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
 
           ii = b_face_cells[face_id];
 
+          if (c_update != NULL && !c_update[ii])
+            continue;
+
           udbfs = 1. / b_face_surf[face_id];
 
           for (ll = 0; ll < 3; ll++)
@@ -431,23 +726,50 @@ _compute_cell_cocg_lsq(const cs_mesh_t        *m,
   /* The cocg term for interior cells only changes if the mesh does */
 
 # pragma omp parallel for
-  for (cell_id = 0; cell_id < n_cells; cell_id++)
-    cs_math_33_inv_cramer_in_place(cocg[cell_id]);
+  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+    if (c_update == NULL || c_update[cell_id])
+      cs_math_33_inv_cramer_in_place(cocg[cell_id]);
+  }
+
+  /* Reduced precision storage */
+
+  if (cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_REDUCED_PRECISION) {
+
+    if (fvq->cocg_lsq_r == NULL)
+      BFT_MALLOC(fvq->cocg_lsq_r, n_cells_ext*6, float);
+
+    float *restrict cocg_r = fvq->cocg_lsq_r;
+
+#   pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+    for (cell_id = 0; cell_id < n_cells_ext; cell_id++)
+      cs_mesh_quantities_sym_33_to_r((const cs_real_t (*)[3])cocg[cell_id],
+                                     cocg_r + cell_id*6);
+
+    if (!(cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_PRECISION_CHECK))
+      BFT_FREE(fvq->cocg_lsq);
+
+  }
 }
 
 /*----------------------------------------------------------------------------
  * Compute 3x3 matrix cocg for the iterative algorithm
  *
+ * Partial updates (c_update != NULL) are not available with internal
+ * coupling.
+ *
  * parameters:
  *   m               <--  mesh
  *   fvq             <->  mesh quantities
  *   ce              <->  coupling entity
+ *   c_update        <--  cells for which the matrix is computed (others
+ *                        keep their current values), or NULL for all
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_cell_cocg_it(const cs_mesh_t        *m,
                       cs_mesh_quantities_t   *fvq,
-                      cs_internal_coupling_t *ce)
+                      cs_internal_coupling_t *ce,
+                      const bool              c_update[])
 {
   /* Local variables */
 
@@ -484,9 +806,13 @@ _compute_cell_cocg_it(const cs_mesh_t        *m,
       ce->cocg_it = cocg;
   }
 
+  assert(ce == NULL || c_update == NULL);
+
   /* compute the dimensionless matrix COCG for each cell*/
 
   for (cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
+    if (c_update != NULL && !c_update[cell_id])
+      continue;
     cocg[cell_id][0][0]= 1.0;
     cocg[cell_id][0][1]= 0.0;
     cocg[cell_id][0][2]= 0.0;
@@ -507,14 +833,22 @@ _compute_cell_cocg_it(const cs_mesh_t        *m,
     dvol1 = 1./cell_vol[cell_id1];
     dvol2 = 1./cell_vol[cell_id2];
 
+    bool update_1 = (c_update == NULL || c_update[cell_id1]);
+    bool update_2 = (c_update == NULL || c_update[cell_id2]);
+
+    if (!(update_1 || update_2))
+      continue;
+
     for (i = 0; i < 3; i++) {
 
       pfac = -0.5*dofij[face_id][i];
 
       for (j = 0; j < 3; j++) {
         vecfac = pfac*i_face_normal[face_id][j];
-        cocg[cell_id1][i][j] += vecfac * dvol1;
-        cocg[cell_id2][i][j] -= vecfac * dvol2;
+        if (update_1)
+          cocg[cell_id1][i][j] += vecfac * dvol1;
+        if (update_2)
+          cocg[cell_id2][i][j] -= vecfac * dvol2;
       }
     }
   }
@@ -527,8 +861,10 @@ _compute_cell_cocg_it(const cs_mesh_t        *m,
   /* 3x3 Matrix inversion */
 
 # pragma omp parallel for
-  for (cell_id = 0; cell_id < n_cells; cell_id++)
-    cs_math_33_inv_cramer_in_place(cocg[cell_id]);
+  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+    if (c_update == NULL || c_update[cell_id])
+      cs_math_33_inv_cramer_in_place(cocg[cell_id]);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2484,75 +2820,299 @@ _b_thickness(const cs_mesh_t             *m,
   }
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions for Fortran API
- *============================================================================*/
-
 /*----------------------------------------------------------------------------
- * Query or modification of the option for computing cell centers.
- *
- * This function returns 0 or 1 according to the selected algorithm.
- *
- * Fortran interface :
- *
- * SUBROUTINE ALGCEN (IOPT)
- * *****************
+ * Compute mesh quantities other than those needed for preprocessing.
  *
- * INTEGER          IOPT        : <-> : Choice of the algorithm
- *                                      < 0 : query
- *                                        0 : computation based
- *                                            on faces (default choice)
- *                                        1 : computation based
- *                                            on vertices
+ * parameters:
+ *   mesh            <-- pointer to a cs_mesh_t structure
+ *   mesh_quantities <-> pointer to a cs_mesh_quantities_t structure
+ *   c_update        <-- cells for which cocg matrices are computed
+ *                       (others keep their current values), or NULL for all
  *----------------------------------------------------------------------------*/
 
-void
-CS_PROCF (algcen, ALGCEN) (cs_int_t  *const iopt)
+static void
+_compute_secondary_quantities(const cs_mesh_t       *mesh,
+                              cs_mesh_quantities_t  *mesh_quantities,
+                              const bool             c_update[])
 {
-  int  iopt_ret = cs_mesh_quantities_cell_cen_choice((int)(*iopt));
+  cs_lnum_t  dim = mesh->dim;
+  cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  cs_lnum_t  n_b_faces = mesh->n_b_faces;
+  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
 
-  *iopt = iopt_ret;
-}
+  /* Balance porous model */
+  if (cs_glob_porous_model == 3) {
+    if (mesh_quantities->i_f_face_normal == NULL)
+      mesh_quantities->i_f_face_normal
+        = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
 
-/*----------------------------------------------------------------------------
- * Set behavior for computing the cocg matrixes for the iterative algo
- * and for the least squares method for scalar and vector gradients.
- *
- * Fortran interface :
- *
- * subroutine comcoc (imrgra)
- * *****************
- *
- * integer          imrgra        : <-- : gradient reconstruction option
- *----------------------------------------------------------------------------*/
+    if (mesh_quantities->b_f_face_normal == NULL)
+      mesh_quantities->b_f_face_normal
+        = _alloc_touched(mesh->b_face_numbering, n_b_faces, dim);
 
-void
-CS_PROCF (comcoc, COMCOC) (const cs_int_t  *const imrgra)
-{
-  cs_mesh_quantities_set_cocg_options(*imrgra);
-}
+    if (mesh_quantities->i_f_face_surf == NULL)
+      mesh_quantities->i_f_face_surf
+        = _alloc_touched(mesh->i_face_numbering, n_i_faces, 1);
 
-/*----------------------------------------------------------------------------
- * Set porous model
- *
- * Fortran interface :
- *
- * subroutine compor (iporos)
- * *****************
- *
- * integer          iporos        : <-- : porous model
- *----------------------------------------------------------------------------*/
+    if (mesh_quantities->b_f_face_surf == NULL)
+      mesh_quantities->b_f_face_surf
+        = _alloc_touched(mesh->b_face_numbering, n_b_faces, 1);
+  }
+  else {
+    mesh_quantities->i_f_face_normal = mesh_quantities->i_face_normal;
+    mesh_quantities->b_f_face_normal = mesh_quantities->b_face_normal;
+    mesh_quantities->i_f_face_surf = mesh_quantities->i_face_surf;
+    mesh_quantities->b_f_face_surf = mesh_quantities->b_face_surf;
+  }
 
-void
-CS_PROCF (compor, COMPOR) (const cs_int_t  *const iporos)
-{
-  cs_mesh_quantities_set_porous_model(*iporos);
-}
+  /* Porous models */
+  if (cs_glob_porous_model > 0) {
+    if (mesh_quantities->cell_f_vol == NULL)
+      mesh_quantities->cell_f_vol
+        = _alloc_touched(mesh->cell_numbering, n_cells_with_ghosts, 1);
 
-/*=============================================================================
- * Public function definitions
+    if (mesh_quantities->c_solid_flag == NULL) {
+      BFT_MALLOC(mesh_quantities->c_solid_flag, n_cells_with_ghosts, cs_int_t);
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++)
+        mesh_quantities->c_solid_flag[cell_id] = 0;
+    }
+
+  }
+  else {
+    mesh_quantities->cell_f_vol = mesh_quantities->cell_vol;
+
+    if (mesh_quantities->c_solid_flag == NULL) {
+      BFT_MALLOC(mesh_quantities->c_solid_flag, 1, cs_int_t);
+      mesh_quantities->c_solid_flag[0] = 0;
+    }
+  }
+
+  if (mesh_quantities->i_dist == NULL)
+    mesh_quantities->i_dist
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, 1);
+
+  if (mesh_quantities->b_dist == NULL)
+    mesh_quantities->b_dist
+      = _alloc_touched(mesh->b_face_numbering, n_b_faces, 1);
+
+  if (mesh_quantities->weight == NULL)
+    mesh_quantities->weight
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, 1);
+
+  if (mesh_quantities->dijpf == NULL)
+    mesh_quantities->dijpf
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
+
+  if (mesh_quantities->diipb == NULL)
+    mesh_quantities->diipb
+      = _alloc_touched(mesh->b_face_numbering, n_b_faces, dim);
+
+  if (mesh_quantities->dofij == NULL)
+    mesh_quantities->dofij
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
+
+  if (mesh_quantities->diipf == NULL)
+    mesh_quantities->diipf
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
+
+  if (mesh_quantities->djjpf == NULL)
+    mesh_quantities->djjpf
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
+
+
+  /* Compute 3x3 cocg dimensionless matrix */
+
+  if (_compute_cocg_it == 1) {
+    if (mesh_quantities->cocg_it == NULL)
+      mesh_quantities->cocg_it
+        = (cs_real_33_t *)_alloc_touched(mesh->cell_numbering,
+                                         n_cells_with_ghosts,
+                                         9);
+  }
+
+  if (_compute_cocg_lsq == 1) {
+    if (mesh_quantities->cocg_lsq == NULL) {
+      mesh_quantities->cocg_lsq
+        = (cs_real_33_t *)_alloc_touched(mesh->cell_numbering,
+                                         n_cells_with_ghosts,
+                                         9);
+    }
+  }
+
+  if (mesh_quantities->b_sym_flag == NULL)
+    BFT_MALLOC(mesh_quantities->b_sym_flag, n_b_faces, cs_int_t);
+
+  /* Compute some distances relative to faces and associated weighting */
+
+  _compute_face_distances(mesh->n_i_faces,
+                          mesh->n_b_faces,
+                          (const cs_lnum_2_t *)(mesh->i_face_cells),
+                          mesh->b_face_cells,
+                          (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+                          (const cs_real_3_t *)(mesh_quantities->b_face_normal),
+                          (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+                          (const cs_real_3_t *)(mesh_quantities->b_face_cog),
+                          (const cs_real_3_t *)(mesh_quantities->cell_cen),
+                          mesh_quantities->i_dist,
+                          mesh_quantities->b_dist,
+                          mesh_quantities->weight);
+
+  /* Compute some vectors relative to faces to handle non-orthogonalities */
+
+  _compute_face_vectors(dim,
+                        mesh->n_i_faces,
+                        mesh->n_b_faces,
+                        (const cs_lnum_2_t *)(mesh->i_face_cells),
+                        mesh->b_face_cells,
+                        mesh_quantities->i_face_normal,
+                        mesh_quantities->b_face_normal,
+                        mesh_quantities->i_face_cog,
+                        mesh_quantities->b_face_cog,
+                        mesh_quantities->i_face_surf,
+                        mesh_quantities->b_face_surf,
+                        mesh_quantities->cell_cen,
+                        mesh_quantities->weight,
+                        mesh_quantities->b_dist,
+                        mesh_quantities->dijpf,
+                        mesh_quantities->diipb,
+                        mesh_quantities->dofij);
+
+  /* Compute additional vectors relative to faces to handle non-orthogonalities */
+
+  _compute_face_sup_vectors
+    (mesh->n_i_faces,
+     (const cs_lnum_2_t *)(mesh->i_face_cells),
+     (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+     (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+     mesh_quantities->i_face_surf,
+     (const cs_real_3_t *)(mesh_quantities->cell_cen),
+     mesh_quantities->cell_vol,
+     mesh_quantities->i_dist,
+     (cs_real_3_t *)(mesh_quantities->diipf),
+     (cs_real_3_t *)(mesh_quantities->djjpf));
+
+  /* Compute 3x3 cocg matrixes */
+
+  if (_compute_cocg_s_it == 1)
+    _compute_cell_cocg_s_it(mesh, mesh_quantities, c_update);
+
+  if (_compute_cocg_lsq == 1)
+    _compute_cell_cocg_lsq(mesh, mesh_quantities, NULL, c_update);
+
+  if (_compute_cocg_it == 1)
+    _compute_cell_cocg_it(mesh, mesh_quantities, NULL, c_update);
+
+  /* Build the geometrical matrix linear gradient correction */
+  if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
+    _compute_corr_grad_lin(mesh, mesh_quantities);
+
+  /* Print some information on the control volumes, and check min volume */
+
+  if (_n_computations == 1)
+    bft_printf(_(" --- Information on the volumes\n"
+                 "       Minimum control volume      = %14.7e\n"
+                 "       Maximum control volume      = %14.7e\n"
+                 "       Total volume for the domain = %14.7e\n"),
+               mesh_quantities->min_vol, mesh_quantities->max_vol,
+               mesh_quantities->tot_vol);
+  else
+    if (mesh_quantities->min_vol <= 0.) {
+      bft_printf(_(" --- Information on the volumes\n"
+                   "       Minimum control volume      = %14.7e\n"
+                   "       Maximum control volume      = %14.7e\n"
+                   "       Total volume for the domain = %14.7e\n"),
+                 mesh_quantities->min_vol, mesh_quantities->max_vol,
+                 mesh_quantities->tot_vol);
+      bft_printf(_("\nAbort due to the detection of a negative control "
+                   "volume.\n"));
+    }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions for Fortran API
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Query or modification of the option for computing cell centers.
+ *
+ * This function returns 0 or 1 according to the selected algorithm.
+ *
+ * Fortran interface :
+ *
+ * SUBROUTINE ALGCEN (IOPT)
+ * *****************
+ *
+ * INTEGER          IOPT        : <-> : Choice of the algorithm
+ *                                      < 0 : query
+ *                                        0 : computation based
+ *                                            on faces (default choice)
+ *                                        1 : computation based
+ *                                            on vertices
+ *----------------------------------------------------------------------------*/
+
+void
+CS_PROCF (algcen, ALGCEN) (cs_int_t  *const iopt)
+{
+  int  iopt_ret = cs_mesh_quantities_cell_cen_choice((int)(*iopt));
+
+  *iopt = iopt_ret;
+}
+
+/*----------------------------------------------------------------------------
+ * Set behavior for computing the cocg matrixes for the iterative algo
+ * and for the least squares method for scalar and vector gradients.
+ *
+ * Fortran interface :
+ *
+ * subroutine comcoc (imrgra)
+ * *****************
+ *
+ * integer          imrgra        : <-- : gradient reconstruction option
+ *----------------------------------------------------------------------------*/
+
+void
+CS_PROCF (comcoc, COMCOC) (const cs_int_t  *const imrgra)
+{
+  cs_mesh_quantities_set_cocg_options(*imrgra);
+}
+
+/*----------------------------------------------------------------------------
+ * Set porous model
+ *
+ * Fortran interface :
+ *
+ * subroutine compor (iporos)
+ * *****************
+ *
+ * integer          iporos        : <-- : porous model
+ *----------------------------------------------------------------------------*/
+
+void
+CS_PROCF (compor, COMPOR) (const cs_int_t  *const iporos)
+{
+  cs_mesh_quantities_set_porous_model(*iporos);
+}
+
+/*----------------------------------------------------------------------------
+ * Free mesh arrays not needed anymore once the setup stage is finished,
+ * when the CS_MESH_QUANTITIES_MEMORY_LEAN flag is set.
+ *
+ * Fortran interface :
+ *
+ * subroutine redmem
+ * *****************
+ *----------------------------------------------------------------------------*/
+
+void
+CS_PROCF (redmem, REDMEM) (void)
+{
+  cs_mesh_quantities_reduce_memory(cs_glob_mesh, cs_glob_mesh_quantities);
+}
+
+/*=============================================================================
+ * Public function definitions
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
@@ -2694,6 +3254,7 @@ cs_mesh_quantities_create(void)
   mesh_quantities->cocgb_s_lsq = NULL;
   mesh_quantities->cocg_it = NULL;
   mesh_quantities->cocg_lsq = NULL;
+  mesh_quantities->cocg_lsq_r = NULL;
   mesh_quantities->corr_grad_lin_det = NULL;
   mesh_quantities->corr_grad_lin = NULL;
   mesh_quantities->b_sym_flag = NULL;
@@ -2764,6 +3325,7 @@ cs_mesh_quantities_free_all(cs_mesh_quantities_t  *mq)
   BFT_FREE(mq->cocgb_s_lsq);
   BFT_FREE(mq->cocg_it);
   BFT_FREE(mq->cocg_lsq);
+  BFT_FREE(mq->cocg_lsq_r);
   BFT_FREE(mq->corr_grad_lin_det);
   BFT_FREE(mq->corr_grad_lin);
   BFT_FREE(mq->b_sym_flag);
@@ -2788,7 +3350,19 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
   cs_lnum_t  n_b_faces = mesh->n_b_faces;
   cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
 
-  if (cs_glob_mesh_quantities_flag != 0)
+  const unsigned storage_flags
+    =   CS_MESH_QUANTITIES_REDUCED_PRECISION
+      | CS_MESH_QUANTITIES_PRECISION_CHECK
+      | CS_MESH_QUANTITIES_MEMORY_LEAN;
+
+  if (cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_REDUCED_PRECISION)
+    bft_printf
+      (" Least-squares gradient cocg matrices stored in reduced precision"
+       " (check: %d)\n",
+       (cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_PRECISION_CHECK) ?
+       1 : 0);
+
+  if (cs_glob_mesh_quantities_flag & (~storage_flags))
     bft_printf
       (" Warning:\n"
        " --------\n"
@@ -2814,28 +3388,36 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
   /* If this is not an update, allocate members of the structure */
 
   if (mesh_quantities->i_face_normal == NULL)
-    BFT_MALLOC(mesh_quantities->i_face_normal, n_i_faces*dim, cs_real_t);
+    mesh_quantities->i_face_normal
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
 
   if (mesh_quantities->i_face_cog == NULL)
-    BFT_MALLOC(mesh_quantities->i_face_cog, n_i_faces*dim, cs_real_t);
+    mesh_quantities->i_face_cog
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
 
   if (mesh_quantities->b_face_normal == NULL)
-    BFT_MALLOC(mesh_quantities->b_face_normal, n_b_faces*dim, cs_real_t);
+    mesh_quantities->b_face_normal
+      = _alloc_touched(mesh->b_face_numbering, n_b_faces, dim);
 
   if (mesh_quantities->b_face_cog == NULL)
-    BFT_MALLOC(mesh_quantities->b_face_cog, n_b_faces*dim, cs_real_t);
+    mesh_quantities->b_face_cog
+      = _alloc_touched(mesh->b_face_numbering, n_b_faces, dim);
 
   if (mesh_quantities->cell_cen == NULL)
-    BFT_MALLOC(mesh_quantities->cell_cen, n_cells_with_ghosts*dim, cs_real_t);
+    mesh_quantities->cell_cen
+      = _alloc_touched(mesh->cell_numbering, n_cells_with_ghosts, dim);
 
   if (mesh_quantities->cell_vol == NULL)
-    BFT_MALLOC(mesh_quantities->cell_vol, n_cells_with_ghosts, cs_real_t);
+    mesh_quantities->cell_vol
+      = _alloc_touched(mesh->cell_numbering, n_cells_with_ghosts, 1);
 
   if (mesh_quantities->i_face_surf == NULL)
-    BFT_MALLOC(mesh_quantities->i_face_surf, n_i_faces, cs_real_t);
+    mesh_quantities->i_face_surf
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, 1);
 
   if (mesh_quantities->b_face_surf == NULL)
-    BFT_MALLOC(mesh_quantities->b_face_surf, n_b_faces, cs_real_t);
+    mesh_quantities->b_face_surf
+      = _alloc_touched(mesh->b_face_numbering, n_b_faces, 1);
 
   /* Compute centers of gravity, normals, and surfaces of interior faces */
 
@@ -2978,184 +3560,199 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
                            cs_mesh_quantities_t  *mesh_quantities)
 {
-  cs_lnum_t  dim = mesh->dim;
-  cs_lnum_t  n_i_faces = mesh->n_i_faces;
-  cs_lnum_t  n_b_faces = mesh->n_b_faces;
-  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
-
   /* Update the number of passes */
 
   _n_computations++;
+  _n_cocg_computations++;
 
   cs_mesh_quantities_compute_preprocess(mesh, mesh_quantities);
 
-  /* Balance porous model */
-  if (cs_glob_porous_model == 3) {
-    if (mesh_quantities->i_f_face_normal == NULL)
-      BFT_MALLOC(mesh_quantities->i_f_face_normal, n_i_faces*dim, cs_real_t);
+  _compute_secondary_quantities(mesh, mesh_quantities, NULL);
+}
 
-    if (mesh_quantities->b_f_face_normal == NULL)
-      BFT_MALLOC(mesh_quantities->b_f_face_normal, n_b_faces*dim, cs_real_t);
+/*----------------------------------------------------------------------------
+ * Compute mesh quantities, reusing the cocg matrices of a previous
+ * computation for cells whose neighborhood is unchanged.
+ *
+ * This is intended for meshes whose connectivity and geometry change only
+ * locally, and which keep the same cells and boundary cells (such as a
+ * rotor/stator mesh joined again after rotation, whose cell numbering
+ * is kept). The previous cocg matrices must be expressed in the current
+ * mesh position (i.e. already transformed for moving parts); they are
+ * transferred to the new structure.
+ *
+ * Matrices are recomputed for cells flagged as modified, cells whose center
+ * or volume has changed, and their direct and extended neighbors.
+ * Ghost cell values are always recomputed.
+ *
+ * parameters:
+ *   mesh            <-- pointer to a cs_mesh_t structure
+ *   mesh_quantities <-> pointer to a cs_mesh_quantities_t structure
+ *   mq_prev         <-> previous mesh quantities (cell centers, volumes
+ *                       and cocg matrices are used for the n_cells first
+ *                       cells; cocg arrays are transferred)
+ *   c_modified      <-- flag for cells whose connectivity has changed
+ *                       (size: n_cells)
+ *----------------------------------------------------------------------------*/
 
-    if (mesh_quantities->i_f_face_surf == NULL)
-      BFT_MALLOC(mesh_quantities->i_f_face_surf, n_i_faces, cs_real_t);
+void
+cs_mesh_quantities_compute_incremental(const cs_mesh_t       *mesh,
+                                       cs_mesh_quantities_t  *mesh_quantities,
+                                       cs_mesh_quantities_t  *mq_prev,
+                                       const bool             c_modified[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
 
-    if (mesh_quantities->b_f_face_surf == NULL)
-      BFT_MALLOC(mesh_quantities->b_f_face_surf, n_b_faces, cs_real_t);
-  }
-  else {
-    mesh_quantities->i_f_face_normal = mesh_quantities->i_face_normal;
-    mesh_quantities->b_f_face_normal = mesh_quantities->b_face_normal;
-    mesh_quantities->i_f_face_surf = mesh_quantities->i_face_surf;
-    mesh_quantities->b_f_face_surf = mesh_quantities->b_face_surf;
-  }
+  cs_mesh_quantities_t *mq = mesh_quantities;
 
-  /* Porous models */
-  if (cs_glob_porous_model > 0) {
-    if (mesh_quantities->cell_f_vol == NULL)
-      BFT_MALLOC(mesh_quantities->cell_f_vol, n_cells_with_ghosts, cs_real_t);
+  /* Update the number of passes */
 
-    if (mesh_quantities->c_solid_flag == NULL) {
-      BFT_MALLOC(mesh_quantities->c_solid_flag, n_cells_with_ghosts, cs_int_t);
-      for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++)
-        mesh_quantities->c_solid_flag[cell_id] = 0;
-    }
+  _n_computations++;
 
-  }
-  else {
-    mesh_quantities->cell_f_vol = mesh_quantities->cell_vol;
+  cs_mesh_quantities_compute_preprocess(mesh, mq);
 
-    if (mesh_quantities->c_solid_flag == NULL) {
-      BFT_MALLOC(mesh_quantities->c_solid_flag, 1, cs_int_t);
-      mesh_quantities->c_solid_flag[0] = 0;
-    }
-  }
+  /* Previous matrices may only be reused if all those required are present */
 
-  if (mesh_quantities->i_dist == NULL)
-    BFT_MALLOC(mesh_quantities->i_dist, n_i_faces, cs_real_t);
+  bool reuse = (mq_prev->cell_cen != NULL && mq_prev->cell_vol != NULL);
 
-  if (mesh_quantities->b_dist == NULL)
-    BFT_MALLOC(mesh_quantities->b_dist, n_b_faces, cs_real_t);
+  if (_compute_cocg_s_it == 1 && mq_prev->cocg_s_it == NULL)
+    reuse = false;
+  if (_compute_cocg_it == 1 && mq_prev->cocg_it == NULL)
+    reuse = false;
+  if (   _compute_cocg_lsq == 1
+      && (   mq_prev->cocgb_s_lsq == NULL
+          || (mq_prev->cocg_lsq == NULL && mq_prev->cocg_lsq_r == NULL)))
+    reuse = false;
 
-  if (mesh_quantities->weight == NULL)
-    BFT_MALLOC(mesh_quantities->weight, n_i_faces, cs_real_t);
+  if (reuse == false) {
+    _n_cocg_computations++;
+    _compute_secondary_quantities(mesh, mq, NULL);
+    return;
+  }
 
-  if (mesh_quantities->dijpf == NULL)
-    BFT_MALLOC(mesh_quantities->dijpf, n_i_faces*dim, cs_real_t);
+  /* Mark cells whose connectivity or geometry has changed */
 
-  if (mesh_quantities->diipb == NULL)
-    BFT_MALLOC(mesh_quantities->diipb, n_b_faces*dim, cs_real_t);
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *cell_cen_prev = (const cs_real_3_t *)mq_prev->cell_cen;
+  const cs_real_t *cell_vol = mq->cell_vol;
+  const cs_real_t *cell_vol_prev = mq_prev->cell_vol;
 
-  if (mesh_quantities->dofij == NULL)
-    BFT_MALLOC(mesh_quantities->dofij, n_i_faces*dim, cs_real_t);
+  int *c_flag;
+  BFT_MALLOC(c_flag, n_cells_ext, int);
 
-  if (mesh_quantities->diipf == NULL)
-    BFT_MALLOC(mesh_quantities->diipf, n_i_faces*dim, cs_real_t);
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t eps = 1e-10;
+    const cs_real_t l_ref = cbrt(cell_vol[c_id]);
+    c_flag[c_id] = (c_modified[c_id]) ? 1 : 0;
+    if (   cs_math_3_distance(cell_cen[c_id], cell_cen_prev[c_id]) > eps*l_ref
+        || fabs(cell_vol[c_id] - cell_vol_prev[c_id]) > eps*cell_vol[c_id])
+      c_flag[c_id] = 1;
+  }
 
-  if (mesh_quantities->djjpf == NULL)
-    BFT_MALLOC(mesh_quantities->djjpf, n_i_faces*dim, cs_real_t);
+  for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++)
+    c_flag[c_id] = 1;
 
+  if (mesh->halo != NULL)
+    cs_halo_sync_untyped(mesh->halo, CS_HALO_EXTENDED, sizeof(int), c_flag);
 
-  /* Compute 3x3 cocg dimensionless matrix */
+  /* Matrices depend on the geometry of direct and extended neighbors;
+     ghost cell values are always recomputed */
 
-  if (_compute_cocg_it == 1) {
-    if (mesh_quantities->cocg_it == NULL)
-      BFT_MALLOC(mesh_quantities->cocg_it, n_cells_with_ghosts, cs_real_33_t);
+  bool *c_update;
+  BFT_MALLOC(c_update, n_cells_ext, bool);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    c_update[c_id] = (c_flag[c_id]) ? true : false;
+  for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++)
+    c_update[c_id] = true;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+    cs_lnum_t c_id_1 = i_face_cells[f_id][1];
+    if (c_flag[c_id_0] || c_flag[c_id_1]) {
+      c_update[c_id_0] = true;
+      c_update[c_id_1] = true;
+    }
   }
 
-  if (_compute_cocg_lsq == 1) {
-    if (mesh_quantities->cocg_lsq == NULL) {
-      BFT_MALLOC(mesh_quantities->cocg_lsq, n_cells_with_ghosts, cs_real_33_t);
+  if (mesh->halo_type == CS_HALO_EXTENDED && mesh->cell_cells_idx != NULL) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t i = mesh->cell_cells_idx[c_id];
+           i < mesh->cell_cells_idx[c_id+1];
+           i++) {
+        if (c_flag[mesh->cell_cells_lst[i]])
+          c_update[c_id] = true;
+      }
     }
   }
 
-  if (mesh_quantities->b_sym_flag == NULL)
-    BFT_MALLOC(mesh_quantities->b_sym_flag, n_b_faces, cs_int_t);
+  BFT_FREE(c_flag);
 
-  /* Compute some distances relative to faces and associated weighting */
+  /* Transfer previous matrices */
 
-  _compute_face_distances(mesh->n_i_faces,
-                          mesh->n_b_faces,
-                          (const cs_lnum_2_t *)(mesh->i_face_cells),
-                          mesh->b_face_cells,
-                          (const cs_real_3_t *)(mesh_quantities->i_face_normal),
-                          (const cs_real_3_t *)(mesh_quantities->b_face_normal),
-                          (const cs_real_3_t *)(mesh_quantities->i_face_cog),
-                          (const cs_real_3_t *)(mesh_quantities->b_face_cog),
-                          (const cs_real_3_t *)(mesh_quantities->cell_cen),
-                          mesh_quantities->i_dist,
-                          mesh_quantities->b_dist,
-                          mesh_quantities->weight);
+  if (_compute_cocg_s_it == 1) {
+    mq->cocg_s_it = mq_prev->cocg_s_it;
+    mq->cocgb_s_it = mq_prev->cocgb_s_it;
+    mq_prev->cocg_s_it = NULL;
+    mq_prev->cocgb_s_it = NULL;
+    BFT_REALLOC(mq->cocg_s_it, n_cells_ext, cs_real_33_t);
+  }
 
-  /* Compute some vectors relative to faces to handle non-orthogonalities */
+  if (_compute_cocg_it == 1) {
+    mq->cocg_it = mq_prev->cocg_it;
+    mq_prev->cocg_it = NULL;
+    BFT_REALLOC(mq->cocg_it, n_cells_ext, cs_real_33_t);
+  }
 
-  _compute_face_vectors(dim,
-                        mesh->n_i_faces,
-                        mesh->n_b_faces,
-                        (const cs_lnum_2_t *)(mesh->i_face_cells),
-                        mesh->b_face_cells,
-                        mesh_quantities->i_face_normal,
-                        mesh_quantities->b_face_normal,
-                        mesh_quantities->i_face_cog,
-                        mesh_quantities->b_face_cog,
-                        mesh_quantities->i_face_surf,
-                        mesh_quantities->b_face_surf,
-                        mesh_quantities->cell_cen,
-                        mesh_quantities->weight,
-                        mesh_quantities->b_dist,
-                        mesh_quantities->dijpf,
-                        mesh_quantities->diipb,
-                        mesh_quantities->dofij);
+  if (_compute_cocg_lsq == 1) {
 
-  /* Compute additional vectors relative to faces to handle non-orthogonalities */
+    mq->cocgb_s_lsq = mq_prev->cocgb_s_lsq;
+    mq->cocg_lsq = mq_prev->cocg_lsq;
+    mq->cocg_lsq_r = mq_prev->cocg_lsq_r;
+    mq_prev->cocgb_s_lsq = NULL;
+    mq_prev->cocg_lsq = NULL;
+    mq_prev->cocg_lsq_r = NULL;
 
-  _compute_face_sup_vectors
-    (mesh->n_i_faces,
-     (const cs_lnum_2_t *)(mesh->i_face_cells),
-     (const cs_real_3_t *)(mesh_quantities->i_face_normal),
-     (const cs_real_3_t *)(mesh_quantities->i_face_cog),
-     mesh_quantities->i_face_surf,
-     (const cs_real_3_t *)(mesh_quantities->cell_cen),
-     mesh_quantities->cell_vol,
-     mesh_quantities->i_dist,
-     (cs_real_3_t *)(mesh_quantities->diipf),
-     (cs_real_3_t *)(mesh_quantities->djjpf));
+    if (mq->cocg_lsq_r != NULL)
+      BFT_REALLOC(mq->cocg_lsq_r, n_cells_ext*6, float);
 
-  /* Compute 3x3 cocg matrixes */
+    /* With reduced precision storage only, the full precision matrix
+       used as a work array is initialized from kept values */
 
-  if (_compute_cocg_s_it == 1)
-    _compute_cell_cocg_s_it(mesh, mesh_quantities);
+    if (mq->cocg_lsq != NULL)
+      BFT_REALLOC(mq->cocg_lsq, n_cells_ext, cs_real_33_t);
+    else {
+      BFT_MALLOC(mq->cocg_lsq, n_cells_ext, cs_real_33_t);
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        if (c_update[c_id] == false)
+          cs_mesh_quantities_sym_33_from_r(mq->cocg_lsq_r + c_id*6,
+                                           mq->cocg_lsq[c_id]);
+      }
+    }
 
-  if (_compute_cocg_lsq == 1)
-    _compute_cell_cocg_lsq(mesh, mesh_quantities, NULL);
+  }
 
-  if (_compute_cocg_it == 1)
-    _compute_cell_cocg_it(mesh, mesh_quantities, NULL);
+  _compute_secondary_quantities(mesh, mq, c_update);
 
-  /* Build the geometrical matrix linear gradient correction */
-  if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
-    _compute_corr_grad_lin(mesh, mesh_quantities);
+  /* Boundary cell matrices are completed by gradient computations
+     based on boundary conditions, so they must be rebuilt there
+     if some were recomputed here */
 
-  /* Print some information on the control volumes, and check min volume */
+  cs_lnum_t n_b_update = 0;
+  for (cs_lnum_t i = 0; i < mesh->n_b_cells; i++) {
+    if (c_update[mesh->b_cells[i]])
+      n_b_update += 1;
+  }
+  cs_parall_counter_max(&n_b_update, 1);
 
-  if (_n_computations == 1)
-    bft_printf(_(" --- Information on the volumes\n"
-                 "       Minimum control volume      = %14.7e\n"
-                 "       Maximum control volume      = %14.7e\n"
-                 "       Total volume for the domain = %14.7e\n"),
-               mesh_quantities->min_vol, mesh_quantities->max_vol,
-               mesh_quantities->tot_vol);
-  else
-    if (mesh_quantities->min_vol <= 0.) {
-      bft_printf(_(" --- Information on the volumes\n"
-                   "       Minimum control volume      = %14.7e\n"
-                   "       Maximum control volume      = %14.7e\n"
-                   "       Total volume for the domain = %14.7e\n"),
-                 mesh_quantities->min_vol, mesh_quantities->max_vol,
-                 mesh_quantities->tot_vol);
-      bft_printf(_("\nAbort due to the detection of a negative control "
-                   "volume.\n"));
-    }
+  if (n_b_update > 0)
+    _n_cocg_computations++;
+
+  BFT_FREE(c_update);
 }
 
 /*----------------------------------------------------------------------------
@@ -3231,10 +3828,12 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
   cs_lnum_t  n_i_faces = mesh->n_i_faces;
 
   if (mesh_quantities->diipf == NULL)
-    BFT_MALLOC(mesh_quantities->diipf, n_i_faces*dim, cs_real_t);
+    mesh_quantities->diipf
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
 
   if (mesh_quantities->djjpf == NULL)
-    BFT_MALLOC(mesh_quantities->djjpf, n_i_faces*dim, cs_real_t);
+    mesh_quantities->djjpf
+      = _alloc_touched(mesh->i_face_numbering, n_i_faces, dim);
 
   _compute_face_sup_vectors
     (mesh->n_i_faces,
@@ -3492,8 +4091,76 @@ void
 cs_mesh_quantities_reduce_extended(const cs_mesh_t       *mesh,
                                    cs_mesh_quantities_t  *mesh_quantities)
 {
-  if (_compute_cocg_lsq == 1)
-    _compute_cell_cocg_lsq(mesh, mesh_quantities, NULL);
+  if (_compute_cocg_lsq == 1) {
+    _compute_cell_cocg_lsq(mesh, mesh_quantities, NULL, NULL);
+    _n_cocg_computations++;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free mesh arrays not needed anymore once the setup stage is finished,
+ * when the CS_MESH_QUANTITIES_MEMORY_LEAN flag is set.
+ *
+ * The following arrays are freed:
+ *   - the ghost cell -> vertices connectivity, only used to build and
+ *     filter the extended neighborhood;
+ *   - bad cell flags, unless bad cells are regularized or bad cell
+ *     criteria are computed or visualized at each time step
+ *     (they are rebuilt by cs_mesh_bad_cells_detect if needed).
+ *
+ * Only such setup-only arrays are handled: geometric arrays used by the
+ * solver (face vectors and weights, cocg matrices, extended neighborhood
+ * quantities) are accessed directly at each time step, and are not
+ * tracked per model or recomputed on demand, so they are kept.
+ *
+ * This function should be called once the extended neighborhood is
+ * filtered (see cs_ext_neighborhood_reduce).
+ *
+ * parameters:
+ *   mesh            <-> pointer to a cs_mesh_t structure
+ *   mesh_quantities <-> pointer to a cs_mesh_quantities_t structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_reduce_memory(cs_mesh_t             *mesh,
+                                 cs_mesh_quantities_t  *mesh_quantities)
+{
+  if (!(cs_glob_mesh_quantities_flag & CS_MESH_QUANTITIES_MEMORY_LEAN))
+    return;
+
+  cs_gnum_t n_bytes = 0;
+
+  /* Ghost cell -> vertices connectivity (rebuilt with halos) */
+
+  if (mesh->gcell_vtx_idx != NULL) {
+    n_bytes +=   (mesh->n_ghost_cells + 1
+                  + mesh->gcell_vtx_idx[mesh->n_ghost_cells])
+               * sizeof(cs_lnum_t);
+    BFT_FREE(mesh->gcell_vtx_idx);
+    BFT_FREE(mesh->gcell_vtx_lst);
+  }
+
+  /* Bad cell flags (rebuilt on detection) */
+
+  if (mesh_quantities->bad_cell_flag != NULL) {
+
+    int compute[2], visualize[2];
+    cs_mesh_bad_cells_get_options(compute, visualize);
+
+    if (   !(cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+        && compute[1] == 0 && visualize[1] == 0) {
+      n_bytes += mesh->n_cells_with_ghosts * sizeof(unsigned);
+      BFT_FREE(mesh_quantities->bad_cell_flag);
+    }
+
+  }
+
+  cs_parall_counter(&n_bytes, 1);
+
+  bft_printf(_("\n Memory-lean mode: %llu bytes of setup-only mesh arrays"
+               " freed\n"
+               "   (geometric arrays used by the solver are kept)\n"),
+             (unsigned long long)n_bytes);
 }
 
 /*----------------------------------------------------------------------------
@@ -3509,6 +4176,40 @@ cs_mesh_quantities_compute_count(void)
   return _n_computations;
 }
 
+/*----------------------------------------------------------------------------
+ * Increment the count of mesh quantity computations.
+ *
+ * This should be called when mesh quantities are updated by other means
+ * than cs_mesh_quantities_compute (for example by rigid motion of some
+ * parts of the mesh), so that values cached based on this count
+ * are invalidated. The cocg matrices count is not incremented, as such
+ * updates are expected to transform those matrices consistently.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_increment_compute_count(void)
+{
+  _n_computations++;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of times cocg matrices have been computed.
+ *
+ * Rigid transformations of mesh quantities, which keep those matrices
+ * consistent, are not counted, so values derived from these matrices
+ * (such as boundary cell terms in gradient computations) need only be
+ * rebuilt when this count changes.
+ *
+ * returns:
+ *   number of times cocg matrices have been computed
+ *----------------------------------------------------------------------------*/
+
+int
+cs_mesh_quantities_cocg_compute_count(void)
+{
+  return _n_cocg_computations;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Determine local boundary thickness around each vertex.
@@ -3757,7 +4458,7 @@ cs_compute_cell_cocg_lsq_coupling(const cs_mesh_t         *m,
                                   cs_mesh_quantities_t    *fvq,
                                   cs_internal_coupling_t  *ce)
 {
-  _compute_cell_cocg_lsq(m, fvq, ce);
+  _compute_cell_cocg_lsq(m, fvq, ce, NULL);
 }
 
 /*----------------------------------------------------------------------------
@@ -3775,7 +4476,7 @@ cs_compute_cell_cocg_it_coupling(const cs_mesh_t         *m,
                                  cs_mesh_quantities_t    *fvq,
                                  cs_internal_coupling_t  *ce)
 {
-  _compute_cell_cocg_it(m, fvq, ce);
+  _compute_cell_cocg_it(m, fvq, ce, NULL);
 }
 
 /*----------------------------------------------------------------------------*/
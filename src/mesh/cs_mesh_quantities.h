@@ -74,6 +74,18 @@ BEGIN_C_DECLS
 /*! Limit cells volumle ratio */
 #define CS_CELL_VOLUME_RATIO_CORRECTION (1 << 6)
 
+/*! Store least-squares gradient cocg matrices in reduced precision */
+#define CS_MESH_QUANTITIES_REDUCED_PRECISION (1 << 7)
+
+/*! With CS_MESH_QUANTITIES_REDUCED_PRECISION, also keep full precision
+  cocg matrices, and compare scalar gradients obtained with both */
+#define CS_MESH_QUANTITIES_PRECISION_CHECK (1 << 8)
+
+/*! Free mesh arrays only needed for setup once the time loop starts
+  (see cs_mesh_quantities_reduce_memory; arrays used by the solver
+  are kept) */
+#define CS_MESH_QUANTITIES_MEMORY_LEAN (1 << 9)
+
 /*! @} */
 
 /*============================================================================
@@ -137,6 +149,9 @@ typedef struct {
                                     for iterative gradients */
   cs_real_33_t  *cocg_lsq;       /* Interleaved cocg matrix
                                     for least square gradients */
+  float         *cocg_lsq_r;     /* Reduced precision (symmetric) cocg
+                                    matrix for least square gradients
+                                    (6 values per cell), or NULL */
 
   cs_real_t     *corr_grad_lin_det;  /* Determinant of geometrical matrix
                                         linear gradient correction */
@@ -163,6 +178,52 @@ extern unsigned cs_glob_mesh_quantities_flag;
 /* Choice of the porous model */
 extern int cs_glob_porous_model;
 
+/*============================================================================
+ * Public inlined function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Store a symmetric 3x3 matrix in reduced precision.
+ *
+ * Values are stored in the xx, yy, zz, xy, yz, xz order.
+ *
+ * parameters:
+ *   m   <-- matrix
+ *   m_r --> reduced precision matrix
+ *----------------------------------------------------------------------------*/
+
+static inline void
+cs_mesh_quantities_sym_33_to_r(const cs_real_t  m[3][3],
+                               float            m_r[6])
+{
+  m_r[0] = m[0][0];
+  m_r[1] = m[1][1];
+  m_r[2] = m[2][2];
+  m_r[3] = m[0][1];
+  m_r[4] = m[1][2];
+  m_r[5] = m[0][2];
+}
+
+/*----------------------------------------------------------------------------
+ * Expand a symmetric 3x3 matrix stored in reduced precision.
+ *
+ * parameters:
+ *   m_r <-- reduced precision matrix
+ *   m   --> matrix
+ *----------------------------------------------------------------------------*/
+
+static inline void
+cs_mesh_quantities_sym_33_from_r(const float  m_r[6],
+                                 cs_real_t    m[3][3])
+{
+  m[0][0] = m_r[0];
+  m[1][1] = m_r[1];
+  m[2][2] = m_r[2];
+  m[0][1] = m_r[3]; m[1][0] = m_r[3];
+  m[1][2] = m_r[4]; m[2][1] = m_r[4];
+  m[0][2] = m_r[5]; m[2][0] = m_r[5];
+}
+
 /*============================================================================
  * Public function prototypes for API Fortran
  *============================================================================*/
@@ -217,6 +278,19 @@ CS_PROCF (comcoc, COMCOC) (const cs_int_t  *const imrgra);
 void
 CS_PROCF (compor, COMPOR) (const cs_int_t  *const iporos);
 
+/*----------------------------------------------------------------------------
+ * Free mesh arrays not needed anymore once the setup stage is finished,
+ * when the CS_MESH_QUANTITIES_MEMORY_LEAN flag is set.
+ *
+ * Fortran interface :
+ *
+ * subroutine redmem
+ * *****************
+ *----------------------------------------------------------------------------*/
+
+void
+CS_PROCF (redmem, REDMEM) (void);
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -315,6 +389,37 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
                            cs_mesh_quantities_t  *mesh_quantities);
 
+/*----------------------------------------------------------------------------
+ * Compute mesh quantities, reusing the cocg matrices of a previous
+ * computation for cells whose neighborhood is unchanged.
+ *
+ * This is intended for meshes whose connectivity and geometry change only
+ * locally, and which keep the same cells and boundary cells (such as a
+ * rotor/stator mesh joined again after rotation, whose cell numbering
+ * is kept). The previous cocg matrices must be expressed in the current
+ * mesh position (i.e. already transformed for moving parts); they are
+ * transferred to the new structure.
+ *
+ * Matrices are recomputed for cells flagged as modified, cells whose center
+ * or volume has changed, and their direct and extended neighbors.
+ * Ghost cell values are always recomputed.
+ *
+ * parameters:
+ *   mesh            <-- pointer to a cs_mesh_t structure
+ *   mesh_quantities <-> pointer to a cs_mesh_quantities_t structure
+ *   mq_prev         <-> previous mesh quantities (cell centers, volumes
+ *                       and cocg matrices are used for the n_cells first
+ *                       cells; cocg arrays are transferred)
+ *   c_modified      <-- flag for cells whose connectivity has changed
+ *                       (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_compute_incremental(const cs_mesh_t       *mesh,
+                                       cs_mesh_quantities_t  *mesh_quantities,
+                                       cs_mesh_quantities_t  *mq_prev,
+                                       const bool             c_modified[]);
+
 /*----------------------------------------------------------------------------
  * Compute fluid mesh quantities
  *
@@ -441,6 +546,34 @@ void
 cs_mesh_quantities_reduce_extended(const cs_mesh_t       *mesh,
                                    cs_mesh_quantities_t  *mesh_quantities);
 
+/*----------------------------------------------------------------------------
+ * Free mesh arrays not needed anymore once the setup stage is finished,
+ * when the CS_MESH_QUANTITIES_MEMORY_LEAN flag is set.
+ *
+ * The following arrays are freed:
+ *   - the ghost cell -> vertices connectivity, only used to build and
+ *     filter the extended neighborhood;
+ *   - bad cell flags, unless bad cells are regularized or bad cell
+ *     criteria are computed or visualized at each time step
+ *     (they are rebuilt by cs_mesh_bad_cells_detect if needed).
+ *
+ * Only such setup-only arrays are handled: geometric arrays used by the
+ * solver (face vectors and weights, cocg matrices, extended neighborhood
+ * quantities) are accessed directly at each time step, and are not
+ * tracked per model or recomputed on demand, so they are kept.
+ *
+ * This function should be called once the extended neighborhood is
+ * filtered (see cs_ext_neighborhood_reduce).
+ *
+ * parameters:
+ *   mesh            <-> pointer to a cs_mesh_t structure
+ *   mesh_quantities <-> pointer to a cs_mesh_quantities_t structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_reduce_memory(cs_mesh_t             *mesh,
+                                 cs_mesh_quantities_t  *mesh_quantities);
+
 /*----------------------------------------------------------------------------
  * Return the number of times mesh quantities have been computed.
  *
@@ -451,6 +584,34 @@ cs_mesh_quantities_reduce_extended(const cs_mesh_t       *mesh,
 int
 cs_mesh_quantities_compute_count(void);
 
+/*----------------------------------------------------------------------------
+ * Increment the count of mesh quantity computations.
+ *
+ * This should be called when mesh quantities are updated by other means
+ * than cs_mesh_quantities_compute (for example by rigid motion of some
+ * parts of the mesh), so that values cached based on this count
+ * are invalidated. The cocg matrices count is not incremented, as such
+ * updates are expected to transform those matrices consistently.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_increment_compute_count(void);
+
+/*----------------------------------------------------------------------------
+ * Return the number of times cocg matrices have been computed.
+ *
+ * Rigid transformations of mesh quantities, which keep those matrices
+ * consistent, are not counted, so values derived from these matrices
+ * (such as boundary cell terms in gradient computations) need only be
+ * rebuilt when this count changes.
+ *
+ * returns:
+ *   number of times cocg matrices have been computed
+ *----------------------------------------------------------------------------*/
+
+int
+cs_mesh_quantities_cocg_compute_count(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Determine local boundary thickness around each vertex.
@@ -0,0 +1,1454 @@
+/*============================================================================
+ * \file Direct distributed reading of Gmsh mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_read_gmsh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define CS_GMSH_LINE_SIZE  512
+
+/* Face record: number of vertices, 4 vertex numbers, cell number
+   (0 for a boundary element), group class id */
+
+#define CS_GMSH_FACE_STRIDE  7
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Metadata kept between header and data reads */
+
+typedef struct {
+
+  bool             swap_endian;      /* swap bytes when reading */
+
+  cs_gnum_t        n_g_nodes;        /* global number of nodes */
+  int              n_node_blocks;    /* number of node blocks */
+  cs_file_off_t   *node_block_pos;   /* position of node tags for
+                                        each block */
+  cs_gnum_t       *node_block_size;  /* number of nodes per block */
+
+  int              n_elt_blocks;     /* number of surface and volume
+                                        element blocks */
+  cs_file_off_t   *elt_block_pos;    /* position of element data */
+  cs_gnum_t       *elt_block_size;   /* number of elements per block */
+  int             *elt_block_type;   /* Gmsh element type per block */
+  int             *elt_block_gc_id;  /* group class id per block
+                                        (1 if no group) */
+
+  cs_gnum_t        n_g_cells;        /* global number of volume elements */
+  cs_gnum_t        n_g_b_elts;       /* global number of surface elements */
+
+} _gmsh_info_t;
+
+/* Faces of linear volume elements, with outwards-pointing normals
+   (Gmsh uses the same local vertex numbering as the Preprocessor) */
+
+typedef struct {
+
+  int  n_faces;
+  int  n_face_vertices[6];
+  int  face_vertices[6][4];
+
+} _cell_faces_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Number of nodes per Gmsh element type (0: unknown) */
+
+static const int _gmsh_n_nodes[] = {0, 2, 3, 4, 4, 8, 6, 5,
+                                    3, 6, 9, 10, 27, 18, 14, 1};
+
+/* Faces of Gmsh types 4 (tetrahedron), 5 (hexahedron),
+   6 (prism) and 7 (pyramid) */
+
+static const _cell_faces_t _cell_faces[4] = {
+  {4, {3, 3, 3, 3, 0, 0},
+   {{0, 2, 1, 0}, {0, 1, 3, 0}, {0, 3, 2, 0}, {1, 2, 3, 0}}},
+  {6, {4, 4, 4, 4, 4, 4},
+   {{0, 3, 2, 1}, {0, 1, 5, 4}, {0, 4, 7, 3},
+    {1, 2, 6, 5}, {2, 3, 7, 6}, {4, 5, 6, 7}}},
+  {5, {3, 3, 4, 4, 4, 0},
+   {{0, 2, 1, 0}, {3, 4, 5, 0}, {0, 1, 4, 3}, {0, 3, 5, 2}, {1, 2, 5, 4}}},
+  {5, {3, 3, 3, 3, 4, 0},
+   {{0, 1, 4, 0}, {0, 4, 3, 0}, {1, 2, 4, 0}, {2, 3, 4, 0}, {0, 3, 2, 1}}}
+};
+
+static _gmsh_info_t  *_gmsh_info = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Destroy Gmsh metadata structure.
+ *
+ * parameters:
+ *   gi <-> pointer to metadata structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_gmsh_info_destroy(_gmsh_info_t  **gi)
+{
+  _gmsh_info_t  *_gi = *gi;
+
+  if (_gi == NULL)
+    return;
+
+  BFT_FREE(_gi->node_block_pos);
+  BFT_FREE(_gi->node_block_size);
+  BFT_FREE(_gi->elt_block_pos);
+  BFT_FREE(_gi->elt_block_size);
+  BFT_FREE(_gi->elt_block_type);
+  BFT_FREE(_gi->elt_block_gc_id);
+
+  BFT_FREE(*gi);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a text line from a file opened in serial mode.
+ *
+ * Lines longer than the buffer are returned in several parts;
+ * trailing whitespace is removed.
+ *
+ * parameters:
+ *   f      <-- pointer to file
+ *   f_size <-- file size
+ *   line   --> line buffer
+ *
+ * returns:
+ *   true if a line was read, false at end of file
+ *----------------------------------------------------------------------------*/
+
+static bool
+_read_line(cs_file_t      *f,
+           cs_file_off_t   f_size,
+           char            line[CS_GMSH_LINE_SIZE])
+{
+  cs_file_off_t pos = cs_file_tell(f);
+
+  line[0] = '\0';
+
+  if (pos >= f_size)
+    return false;
+
+  size_t n = CS_GMSH_LINE_SIZE - 1;
+  if ((cs_file_off_t)n > f_size - pos)
+    n = f_size - pos;
+
+  cs_file_read_global(f, line, 1, n);
+
+  size_t l = 0;
+  while (l < n && line[l] != '\n')
+    l++;
+
+  cs_file_seek(f, pos + ((l < n) ? l + 1 : l), CS_FILE_SEEK_SET);
+
+  while (l > 0 && (line[l-1] == '\r' || line[l-1] == ' '))
+    l--;
+  line[l] = '\0';
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Skip a given number of bytes in a file.
+ *
+ * parameters:
+ *   f <-- pointer to file
+ *   n <-- number of bytes to skip
+ *----------------------------------------------------------------------------*/
+
+static void
+_skip_bytes(cs_file_t      *f,
+            cs_file_off_t   n)
+{
+  cs_file_seek(f, cs_file_tell(f) + n, CS_FILE_SEEK_SET);
+}
+
+/*----------------------------------------------------------------------------
+ * Read binary integer and size values.
+ *----------------------------------------------------------------------------*/
+
+static int
+_read_int(cs_file_t  *f)
+{
+  int32_t v;
+  cs_file_read_global(f, &v, 4, 1);
+  return v;
+}
+
+static cs_gnum_t
+_read_size(cs_file_t  *f)
+{
+  uint64_t v;
+  cs_file_read_global(f, &v, 8, 1);
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Skip lines up to the end of the current section.
+ *
+ * parameters:
+ *   f      <-- pointer to file
+ *   f_size <-- file size
+ *   name   <-- section name (without '$')
+ *----------------------------------------------------------------------------*/
+
+static void
+_end_section(cs_file_t      *f,
+             cs_file_off_t   f_size,
+             const char     *name)
+{
+  char line[CS_GMSH_LINE_SIZE];
+
+  while (_read_line(f, f_size, line)) {
+    if (strncmp(line, "$End", 4) == 0 && strcmp(line + 4, name) == 0)
+      return;
+  }
+
+  bft_error(__FILE__, __LINE__, 0,
+            _("Gmsh file \"%s\":\n"
+              "  end of section \"$%s\" not found."),
+            cs_file_get_name(f), name);
+}
+
+/*----------------------------------------------------------------------------
+ * Return number of nodes for a Gmsh element type.
+ *
+ * parameters:
+ *   f    <-- pointer to file
+ *   type <-- Gmsh element type
+ *----------------------------------------------------------------------------*/
+
+static int
+_n_type_nodes(cs_file_t  *f,
+              int         type)
+{
+  int n_types = sizeof(_gmsh_n_nodes) / sizeof(_gmsh_n_nodes[0]);
+
+  if (type < 1 || type >= n_types)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\":\n"
+                "  element type %d is not handled."),
+              cs_file_get_name(f), type);
+
+  return _gmsh_n_nodes[type];
+}
+
+/*----------------------------------------------------------------------------
+ * Define groups and families from physical tags of surface and volume
+ * entities.
+ *
+ * Each distinct (dimension, physical tag) pair defines a group, named
+ * using the matching physical name if present, and each entity with
+ * physical tags defines a family, the first family (with no groups)
+ * being used for elements with no physical tags.
+ *
+ * parameters:
+ *   mesh         <-> pointer to mesh structure
+ *   n_ents       <-- number of entities with physical tags
+ *   ent_dim      <-- entity dimension
+ *   ent_phys_idx <-- index of physical tags per entity
+ *   ent_phys     <-- physical tags
+ *   n_names      <-- number of physical names
+ *   name_dim     <-- physical name dimension
+ *   name_tag     <-- physical name tag
+ *   names        <-- physical names
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_groups(cs_mesh_t          *mesh,
+               int                 n_ents,
+               const int           ent_dim[],
+               const int           ent_phys_idx[],
+               const int           ent_phys[],
+               int                 n_names,
+               const int           name_dim[],
+               const int           name_tag[],
+               char              **names)
+{
+  int n_groups = 0, n_max_items = 0;
+  int *grp_dim = NULL, *grp_tag = NULL;
+
+  const int n_phys = ent_phys_idx[n_ents];
+
+  BFT_MALLOC(grp_dim, n_phys, int);
+  BFT_MALLOC(grp_tag, n_phys, int);
+
+  /* Group ids, in order of first appearance */
+
+  int *ent_grp = NULL;
+  BFT_MALLOC(ent_grp, n_phys, int);
+
+  for (int i = 0; i < n_ents; i++) {
+    int n_items = 0;
+    for (int j = ent_phys_idx[i]; j < ent_phys_idx[i+1]; j++) {
+      int g_id = 0;
+      while (   g_id < n_groups
+             && (grp_dim[g_id] != ent_dim[i] || grp_tag[g_id] != ent_phys[j]))
+        g_id++;
+      if (g_id == n_groups) {
+        grp_dim[n_groups] = ent_dim[i];
+        grp_tag[n_groups] = ent_phys[j];
+        n_groups++;
+      }
+      int k = ent_phys_idx[i];
+      while (k < ent_phys_idx[i] + n_items && ent_grp[k] != g_id)
+        k++;
+      if (k == ent_phys_idx[i] + n_items) {
+        ent_grp[k] = g_id;
+        n_items++;
+      }
+    }
+    for (int k = ent_phys_idx[i] + n_items; k < ent_phys_idx[i+1]; k++)
+      ent_grp[k] = -1;
+    n_max_items = CS_MAX(n_max_items, n_items);
+  }
+
+  /* Group names */
+
+  mesh->n_groups = n_groups;
+  BFT_MALLOC(mesh->group_idx, n_groups + 1, int);
+  mesh->group_idx[0] = 0;
+
+  const char **grp_name = NULL;
+  char *num_name = NULL;
+  BFT_MALLOC(grp_name, n_groups, const char *);
+  BFT_MALLOC(num_name, n_groups*16, char);
+
+  for (int g_id = 0; g_id < n_groups; g_id++) {
+    grp_name[g_id] = NULL;
+    for (int j = 0; j < n_names; j++) {
+      if (name_dim[j] == grp_dim[g_id] && name_tag[j] == grp_tag[g_id])
+        grp_name[g_id] = names[j];
+    }
+    if (grp_name[g_id] == NULL) {
+      snprintf(num_name + g_id*16, 16, "%d", grp_tag[g_id]);
+      grp_name[g_id] = num_name + g_id*16;
+    }
+    mesh->group_idx[g_id + 1]
+      = mesh->group_idx[g_id] + strlen(grp_name[g_id]) + 1;
+  }
+
+  BFT_MALLOC(mesh->group, mesh->group_idx[n_groups], char);
+  for (int g_id = 0; g_id < n_groups; g_id++)
+    strcpy(mesh->group + mesh->group_idx[g_id], grp_name[g_id]);
+
+  BFT_FREE(num_name);
+  BFT_FREE(grp_name);
+  BFT_FREE(grp_tag);
+  BFT_FREE(grp_dim);
+
+  /* Families */
+
+  const int n_fams = n_ents + 1;
+
+  mesh->n_families = n_fams;
+  mesh->n_max_family_items = n_max_items;
+  BFT_MALLOC(mesh->family_item, n_fams*n_max_items, int);
+
+  for (int j = 0; j < n_max_items; j++)
+    mesh->family_item[n_fams*j] = 0;
+
+  for (int i = 0; i < n_ents; i++) {
+    int n_items = 0;
+    for (int j = ent_phys_idx[i]; j < ent_phys_idx[i+1]; j++) {
+      if (ent_grp[j] > -1)
+        mesh->family_item[n_fams*(n_items++) + i+1] = -(ent_grp[j] + 1);
+    }
+    for (int j = n_items; j < n_max_items; j++)
+      mesh->family_item[n_fams*j + i+1] = 0;
+  }
+
+  BFT_FREE(ent_grp);
+}
+
+/*----------------------------------------------------------------------------
+ * Read Gmsh file metadata.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *
+ * returns:
+ *   pointer to metadata structure
+ *----------------------------------------------------------------------------*/
+
+static _gmsh_info_t *
+_read_headers(const char  *path,
+              cs_mesh_t   *mesh)
+{
+  char line[CS_GMSH_LINE_SIZE];
+
+  bool format_read = false, entities_read = false;
+
+  int n_ents = 0, n_ents_max = 0;
+  int *ent_dim = NULL, *ent_tag = NULL, *ent_phys_idx = NULL;
+  int *ent_phys = NULL, *ent_gc_id = NULL;
+
+  int n_names = 0;
+  int *name_dim = NULL, *name_tag = NULL;
+  char **names = NULL;
+
+  int n_elt_blocks_max = 0;
+
+  _gmsh_info_t *gi = NULL;
+  BFT_MALLOC(gi, 1, _gmsh_info_t);
+  memset(gi, 0, sizeof(_gmsh_info_t));
+
+  cs_file_off_t f_size = cs_file_size(path);
+  cs_file_t *f = cs_file_open_serial(path, CS_FILE_MODE_READ);
+
+  BFT_MALLOC(ent_phys_idx, 1, int);
+  ent_phys_idx[0] = 0;
+
+  while (_read_line(f, f_size, line)) {
+
+    if (line[0] != '$')
+      continue;
+
+    char sec_name[CS_GMSH_LINE_SIZE];
+    strcpy(sec_name, line + 1);
+
+    if (strcmp(sec_name, "MeshFormat") == 0) {
+
+      double version = 0;
+      int file_type = -1, data_size = 0;
+
+      _read_line(f, f_size, line);
+      if (sscanf(line, "%lf %d %d", &version, &file_type, &data_size) != 3)
+        file_type = -1;
+
+      if (version < 4.1 - 1e-6 || version >= 5)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  format version %g is not handled (4.1 required);\n"
+                    "  use the Preprocessor for older versions."),
+                  path, version);
+      if (file_type != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  only binary files may be read directly;\n"
+                    "  use the Preprocessor for text files."),
+                  path);
+      if (data_size != 8)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  data size %d is not handled (8 required)."),
+                  path, data_size);
+
+      if (_read_int(f) != 1) {
+        gi->swap_endian = true;
+        cs_file_set_swap_endian(f, 1);
+      }
+
+      format_read = true;
+      _end_section(f, f_size, sec_name);
+
+    }
+    else if (strcmp(sec_name, "PhysicalNames") == 0) {
+
+      _read_line(f, f_size, line);
+      n_names = atoi(line);
+
+      BFT_MALLOC(name_dim, n_names, int);
+      BFT_MALLOC(name_tag, n_names, int);
+      BFT_MALLOC(names, n_names, char *);
+
+      for (int i = 0; i < n_names; i++) {
+        _read_line(f, f_size, line);
+        char *s = strchr(line, '"');
+        char *e = (s != NULL) ? strrchr(s + 1, '"') : NULL;
+        if (   e == NULL
+            || sscanf(line, "%d %d", name_dim + i, name_tag + i) != 2)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Gmsh file \"%s\":\n"
+                      "  error reading physical name:\n"
+                      "  %s"),
+                    path, line);
+        *e = '\0';
+        BFT_MALLOC(names[i], strlen(s + 1) + 1, char);
+        strcpy(names[i], s + 1);
+      }
+
+      _end_section(f, f_size, sec_name);
+
+    }
+    else if (strcmp(sec_name, "Entities") == 0) {
+
+      cs_gnum_t n_dim_ents[4];
+      for (int dim = 0; dim < 4; dim++)
+        n_dim_ents[dim] = _read_size(f);
+
+      for (int dim = 0; dim < 4; dim++) {
+        for (cs_gnum_t i = 0; i < n_dim_ents[dim]; i++) {
+
+          int tag = _read_int(f);
+          _skip_bytes(f, (dim == 0) ? 3*8 : 6*8);
+
+          int n_phys = _read_size(f);
+          if (dim > 1 && n_phys > 0) {
+            if (n_ents >= n_ents_max) {
+              n_ents_max = CS_MAX(16, n_ents_max*2);
+              BFT_REALLOC(ent_dim, n_ents_max, int);
+              BFT_REALLOC(ent_tag, n_ents_max, int);
+              BFT_REALLOC(ent_phys_idx, n_ents_max + 1, int);
+            }
+            ent_dim[n_ents] = dim;
+            ent_tag[n_ents] = tag;
+            ent_phys_idx[n_ents+1] = ent_phys_idx[n_ents] + n_phys;
+            BFT_REALLOC(ent_phys, ent_phys_idx[n_ents+1], int);
+            cs_file_read_global(f, ent_phys + ent_phys_idx[n_ents],
+                                4, n_phys);
+            n_ents++;
+          }
+          else
+            _skip_bytes(f, n_phys*4);
+
+          if (dim > 0) {
+            cs_gnum_t n_bounding = _read_size(f);
+            _skip_bytes(f, n_bounding*4);
+          }
+
+        }
+      }
+
+      entities_read = true;
+      _end_section(f, f_size, sec_name);
+
+    }
+    else if (strcmp(sec_name, "PartitionedEntities") == 0)
+
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\":\n"
+                  "  partitioned meshes are not handled."),
+                path);
+
+    else if (strcmp(sec_name, "Nodes") == 0) {
+
+      cs_gnum_t n_blocks = _read_size(f);
+      gi->n_g_nodes = _read_size(f);
+      cs_gnum_t min_tag = _read_size(f);
+      cs_gnum_t max_tag = _read_size(f);
+
+      if (gi->n_g_nodes > 0 && (min_tag != 1 || max_tag != gi->n_g_nodes))
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  node tags must be numbered contiguously from 1."),
+                  path);
+
+      gi->n_node_blocks = n_blocks;
+      BFT_MALLOC(gi->node_block_pos, n_blocks, cs_file_off_t);
+      BFT_MALLOC(gi->node_block_size, n_blocks, cs_gnum_t);
+
+      for (cs_gnum_t i = 0; i < n_blocks; i++) {
+        _skip_bytes(f, 2*4);
+        int parametric = _read_int(f);
+        cs_gnum_t n = _read_size(f);
+        if (parametric)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Gmsh file \"%s\":\n"
+                      "  parametric node coordinates are not handled."),
+                    path);
+        gi->node_block_pos[i] = cs_file_tell(f);
+        gi->node_block_size[i] = n;
+        _skip_bytes(f, n*4*8);
+      }
+
+      _end_section(f, f_size, sec_name);
+
+    }
+    else if (strcmp(sec_name, "Elements") == 0) {
+
+      if (entities_read == false)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Gmsh file \"%s\":\n"
+                    "  section \"$Entities\" missing before \"$Elements\"."),
+                  path);
+
+      /* Group class ids of entities */
+
+      BFT_MALLOC(ent_gc_id, n_ents, int);
+      for (int i = 0; i < n_ents; i++)
+        ent_gc_id[i] = i+2;
+
+      cs_gnum_t n_blocks = _read_size(f);
+      _skip_bytes(f, 3*8);
+
+      for (cs_gnum_t i = 0; i < n_blocks; i++) {
+
+        int dim = _read_int(f);
+        int tag = _read_int(f);
+        int type = _read_int(f);
+        cs_gnum_t n = _read_size(f);
+
+        int n_nodes = _n_type_nodes(f, type);
+
+        if (dim > 1) {
+
+          if (   (dim == 2 && type != 2 && type != 3)
+              || (dim == 3 && (type < 4 || type > 7)))
+            bft_error(__FILE__, __LINE__, 0,
+                      _("Gmsh file \"%s\":\n"
+                        "  element type %d is not handled in dimension %d\n"
+                        "  (only linear elements may be read directly)."),
+                      path, type, dim);
+
+          if (gi->n_elt_blocks >= n_elt_blocks_max) {
+            n_elt_blocks_max = CS_MAX(16, n_elt_blocks_max*2);
+            BFT_REALLOC(gi->elt_block_pos, n_elt_blocks_max, cs_file_off_t);
+            BFT_REALLOC(gi->elt_block_size, n_elt_blocks_max, cs_gnum_t);
+            BFT_REALLOC(gi->elt_block_type, n_elt_blocks_max, int);
+            BFT_REALLOC(gi->elt_block_gc_id, n_elt_blocks_max, int);
+          }
+
+          int gc_id = 1;
+          for (int j = 0; j < n_ents; j++) {
+            if (ent_dim[j] == dim && ent_tag[j] == tag)
+              gc_id = ent_gc_id[j];
+          }
+
+          int b_id = gi->n_elt_blocks;
+          gi->elt_block_pos[b_id] = cs_file_tell(f);
+          gi->elt_block_size[b_id] = n;
+          gi->elt_block_type[b_id] = type;
+          gi->elt_block_gc_id[b_id] = gc_id;
+          gi->n_elt_blocks += 1;
+
+          if (dim == 3)
+            gi->n_g_cells += n;
+          else
+            gi->n_g_b_elts += n;
+
+        }
+
+        _skip_bytes(f, n*(n_nodes + 1)*8);
+
+      }
+
+      _end_section(f, f_size, sec_name);
+
+    }
+    else if (strncmp(sec_name, "End", 3) != 0)
+      _end_section(f, f_size, sec_name);
+
+  }
+
+  cs_file_free(f);
+
+  if (format_read == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\":\n"
+                "  section \"$MeshFormat\" not found."),
+              path);
+
+  /* Define groups and families */
+
+  _define_groups(mesh,
+                 n_ents,
+                 ent_dim,
+                 ent_phys_idx,
+                 ent_phys,
+                 n_names,
+                 name_dim,
+                 name_tag,
+                 names);
+
+  for (int i = 0; i < n_names; i++)
+    BFT_FREE(names[i]);
+  BFT_FREE(names);
+  BFT_FREE(name_tag);
+  BFT_FREE(name_dim);
+
+  BFT_FREE(ent_gc_id);
+  BFT_FREE(ent_phys);
+  BFT_FREE(ent_phys_idx);
+  BFT_FREE(ent_tag);
+  BFT_FREE(ent_dim);
+
+  return gi;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the part of a global range [range[0], range[1][ belonging to
+ * a file block whose first element has global number shift + 1.
+ *
+ * parameters:
+ *   range     <-- global range (1 to n)
+ *   shift     <-- global number of elements preceding the block
+ *   n         <-- number of elements in block
+ *   sub_range --> matching range in block (1 to n)
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_block_sub_range(const cs_gnum_t  range[2],
+                 cs_gnum_t        shift,
+                 cs_gnum_t        n,
+                 cs_gnum_t        sub_range[2])
+{
+  for (int i = 0; i < 2; i++) {
+    if (range[i] <= shift)
+      sub_range[i] = 1;
+    else if (range[i] - shift > n + 1)
+      sub_range[i] = n + 1;
+    else
+      sub_range[i] = range[i] - shift;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read vertex coordinates into mesh builder.
+ *
+ * Nodes are read in file order, then distributed to the vertex blocks
+ * based on their tags.
+ *
+ * parameters:
+ *   f  <-- pointer to file
+ *   gi <-- pointer to metadata structure
+ *   mb <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_vertices(cs_file_t           *f,
+               const _gmsh_info_t  *gi,
+               cs_mesh_builder_t   *mb)
+{
+  const cs_gnum_t *range = mb->vertex_bi.gnum_range;
+  const cs_lnum_t n_vertices = range[1] - range[0];
+
+  uint64_t *tags = NULL;
+  cs_gnum_t *vtx_gnum = NULL;
+  cs_real_t *coords = NULL;
+
+  BFT_MALLOC(tags, n_vertices, uint64_t);
+  BFT_MALLOC(vtx_gnum, n_vertices, cs_gnum_t);
+  BFT_MALLOC(coords, n_vertices*3, cs_real_t);
+
+  cs_gnum_t shift = 0;
+  cs_lnum_t n_read = 0;
+
+  for (int b_id = 0; b_id < gi->n_node_blocks; b_id++) {
+
+    cs_gnum_t n = gi->node_block_size[b_id];
+    cs_gnum_t sub_range[2];
+    _block_sub_range(range, shift, n, sub_range);
+
+    cs_file_seek(f, gi->node_block_pos[b_id], CS_FILE_SEEK_SET);
+    cs_file_read_block(f, tags + n_read, 8, 1, sub_range[0], sub_range[1]);
+
+    cs_file_seek(f, gi->node_block_pos[b_id] + n*8, CS_FILE_SEEK_SET);
+    cs_file_read_block(f, coords + n_read*3, sizeof(cs_real_t), 3,
+                       sub_range[0], sub_range[1]);
+
+    n_read += sub_range[1] - sub_range[0];
+    shift += n;
+
+  }
+
+  assert(n_read == n_vertices);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    vtx_gnum[i] = tags[i];
+    if (tags[i] < 1 || tags[i] > gi->n_g_nodes)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh file \"%s\":\n"
+                  "  node tag %llu out of range."),
+                cs_file_get_name(f), (unsigned long long)tags[i]);
+  }
+
+  BFT_FREE(tags);
+
+  if (cs_glob_n_ranks == 1) {
+    BFT_MALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      cs_lnum_t j = vtx_gnum[i] - 1;
+      for (int k = 0; k < 3; k++)
+        mb->vertex_coords[j*3 + k] = coords[i*3 + k];
+    }
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_vertices,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        vtx_gnum,
+                                        mb->vertex_bi,
+                                        cs_glob_mpi_comm);
+
+    mb->vertex_coords = cs_all_to_all_copy_array(d,
+                                                 CS_REAL_TYPE,
+                                                 3,
+                                                 false,
+                                                 coords,
+                                                 NULL);
+
+    cs_all_to_all_destroy(&d);
+
+  }
+
+#endif
+
+  BFT_FREE(coords);
+  BFT_FREE(vtx_gnum);
+}
+
+/*----------------------------------------------------------------------------
+ * Read elements of a given dimension and append matching face records.
+ *
+ * Volume elements generate one record per face, with their global
+ * number, and surface elements generate one record with their group
+ * class id.
+ *
+ * parameters:
+ *   f          <-- pointer to file
+ *   gi         <-- pointer to metadata structure
+ *   dim        <-- element dimension (2 or 3)
+ *   range      <-- global range of elements to read
+ *   elt_gc_id  --> element group class id, or NULL
+ *   n_recs     <-> number of face records
+ *   n_recs_max <-> allocated number of face records
+ *   recs       <-> face records
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_elements(cs_file_t           *f,
+               const _gmsh_info_t  *gi,
+               int                  dim,
+               const cs_gnum_t      range[2],
+               cs_int_t            *elt_gc_id,
+               cs_lnum_t           *n_recs,
+               cs_lnum_t           *n_recs_max,
+               cs_gnum_t          **recs)
+{
+  uint64_t *buf = NULL;
+  cs_gnum_t shift = 0;
+
+  cs_lnum_t _n_recs = *n_recs;
+  cs_lnum_t _n_recs_max = *n_recs_max;
+  cs_gnum_t *_recs = *recs;
+
+  for (int b_id = 0; b_id < gi->n_elt_blocks; b_id++) {
+
+    const int type = gi->elt_block_type[b_id];
+    if ((type < 4 && dim == 3) || (type >= 4 && dim == 2))
+      continue;
+
+    const int stride = _gmsh_n_nodes[type] + 1;
+    const int gc_id = gi->elt_block_gc_id[b_id];
+    const _cell_faces_t *cf = (dim == 3) ? _cell_faces + (type - 4) : NULL;
+    const int n_elt_faces = (dim == 3) ? cf->n_faces : 1;
+
+    cs_gnum_t n = gi->elt_block_size[b_id];
+    cs_gnum_t sub_range[2];
+    _block_sub_range(range, shift, n, sub_range);
+
+    cs_lnum_t n_elts = sub_range[1] - sub_range[0];
+
+    BFT_REALLOC(buf, n_elts*stride, uint64_t);
+    cs_file_seek(f, gi->elt_block_pos[b_id], CS_FILE_SEEK_SET);
+    cs_file_read_block(f, buf, 8, stride, sub_range[0], sub_range[1]);
+
+    if (_n_recs + n_elts*n_elt_faces > _n_recs_max) {
+      _n_recs_max = CS_MAX(_n_recs + n_elts*n_elt_faces, _n_recs_max*2);
+      BFT_REALLOC(_recs, _n_recs_max*CS_GMSH_FACE_STRIDE, cs_gnum_t);
+    }
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+
+      const uint64_t *e_vtx = buf + i*stride + 1;
+      cs_gnum_t g_num = shift + sub_range[0] + i;
+
+      if (dim == 3) {
+        if (elt_gc_id != NULL)
+          elt_gc_id[g_num - range[0]] = gc_id;
+        for (int j = 0; j < cf->n_faces; j++) {
+          cs_gnum_t *r = _recs + (_n_recs++)*CS_GMSH_FACE_STRIDE;
+          r[0] = cf->n_face_vertices[j];
+          for (int k = 0; k < 4; k++)
+            r[1+k] = (k < cf->n_face_vertices[j]) ?
+              e_vtx[cf->face_vertices[j][k]] : 0;
+          r[5] = g_num;
+          r[6] = 0;
+        }
+      }
+      else {
+        cs_gnum_t *r = _recs + (_n_recs++)*CS_GMSH_FACE_STRIDE;
+        r[0] = stride - 1;
+        for (int k = 0; k < 4; k++)
+          r[1+k] = (k < stride - 1) ? e_vtx[k] : 0;
+        r[5] = 0;
+        r[6] = gc_id;
+      }
+
+    }
+
+    shift += n;
+
+  }
+
+  BFT_FREE(buf);
+
+  *n_recs = _n_recs;
+  *n_recs_max = _n_recs_max;
+  *recs = _recs;
+}
+
+/*----------------------------------------------------------------------------
+ * Build faces from face records.
+ *
+ * Records sharing the same vertex set are grouped; a face adjacent to
+ * 2 cells is interior, oriented from the cell with the lowest global
+ * number, and a face adjacent to 1 cell is a boundary face. Surface
+ * element records only provide group class ids (the highest one is used
+ * if several surface elements match a face).
+ *
+ * parameters:
+ *   n_recs       <-- number of face records
+ *   recs         <-- face records
+ *   n_faces      --> number of faces
+ *   face_cells   --> face -> cells connectivity (global numbers)
+ *   face_gc_id   --> face group class id
+ *   face_vtx_idx --> face -> vertices index
+ *   face_vtx     --> face -> vertices connectivity (global numbers)
+ *
+ * returns:
+ *   number of surface elements not matching a cell face
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_build_faces(cs_lnum_t          n_recs,
+             const cs_gnum_t    recs[],
+             cs_lnum_t         *n_faces,
+             cs_gnum_t        **face_cells,
+             cs_int_t         **face_gc_id,
+             cs_lnum_t        **face_vtx_idx,
+             cs_gnum_t        **face_vtx)
+{
+  cs_gnum_t n_unmatched = 0;
+
+  /* Ordering keys: sorted vertex numbers (0-padded), then number of
+     vertices; as records are gathered on ranks by lowest vertex, this is
+     also the global order of faces, independently of the number of ranks */
+
+  cs_gnum_t *keys = NULL;
+  cs_lnum_t *order = NULL;
+  BFT_MALLOC(keys, n_recs*5, cs_gnum_t);
+  BFT_MALLOC(order, n_recs, cs_lnum_t);
+
+# pragma omp parallel for if (n_recs > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_recs; i++) {
+    const cs_gnum_t *r = recs + i*CS_GMSH_FACE_STRIDE;
+    cs_gnum_t *k = keys + i*5;
+    int n_vtx = r[0];
+    for (int j = 0; j < 4; j++)
+      k[j] = r[j+1];
+    k[4] = n_vtx;
+    for (int j = 1; j < n_vtx; j++) {
+      cs_gnum_t v = k[j];
+      int l = j;
+      while (l > 0 && k[l-1] > v) {
+        k[l] = k[l-1];
+        l--;
+      }
+      k[l] = v;
+    }
+  }
+
+  cs_order_gnum_allocated_s(NULL, keys, 5, order, n_recs);
+
+  cs_lnum_t _n_faces = 0, _n_face_vtx = 0;
+  cs_gnum_t *_face_cells = NULL, *_face_vtx = NULL;
+  cs_int_t *_face_gc_id = NULL;
+  cs_lnum_t *_face_vtx_idx = NULL;
+
+  BFT_MALLOC(_face_cells, n_recs*2, cs_gnum_t);
+  BFT_MALLOC(_face_gc_id, n_recs, cs_int_t);
+  BFT_MALLOC(_face_vtx_idx, n_recs + 1, cs_lnum_t);
+  BFT_MALLOC(_face_vtx, n_recs*4, cs_gnum_t);
+
+  _face_vtx_idx[0] = 0;
+
+  cs_lnum_t s_id = 0;
+  while (s_id < n_recs) {
+
+    const cs_gnum_t *k0 = keys + order[s_id]*5;
+    cs_lnum_t e_id = s_id + 1;
+    while (   e_id < n_recs
+           && memcmp(keys + order[e_id]*5, k0, 5*sizeof(cs_gnum_t)) == 0)
+      e_id++;
+
+    int n_cells = 0, gc_id = 1;
+    cs_lnum_t c_rec[2] = {-1, -1};
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      const cs_gnum_t *r = recs + order[i]*CS_GMSH_FACE_STRIDE;
+      if (r[5] > 0) {
+        if (n_cells < 2)
+          c_rec[n_cells] = order[i];
+        n_cells++;
+      }
+      else /* highest id, independent of record order */
+        gc_id = CS_MAX(gc_id, (int)r[6]);
+    }
+
+    if (n_cells > 2)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Gmsh mesh: face with first vertex %llu is shared\n"
+                  "by %d cells (non-conforming mesh)."),
+                (unsigned long long)k0[0], n_cells);
+
+    if (n_cells == 0)
+      n_unmatched += e_id - s_id;
+
+    else {
+      const cs_gnum_t *r0 = recs + c_rec[0]*CS_GMSH_FACE_STRIDE;
+      cs_gnum_t c_num[2] = {r0[5], 0};
+      if (n_cells == 2) {
+        const cs_gnum_t *r1 = recs + c_rec[1]*CS_GMSH_FACE_STRIDE;
+        c_num[1] = r1[5];
+        if (r1[5] < r0[5]) {
+          r0 = r1;
+          c_num[1] = c_num[0];
+          c_num[0] = r0[5];
+        }
+      }
+      _face_cells[_n_faces*2] = c_num[0];
+      _face_cells[_n_faces*2 + 1] = c_num[1];
+      _face_gc_id[_n_faces] = gc_id;
+      for (cs_gnum_t j = 0; j < r0[0]; j++)
+        _face_vtx[_n_face_vtx++] = r0[1+j];
+      _n_faces++;
+      _face_vtx_idx[_n_faces] = _n_face_vtx;
+    }
+
+    s_id = e_id;
+
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(keys);
+
+  BFT_REALLOC(_face_cells, _n_faces*2, cs_gnum_t);
+  BFT_REALLOC(_face_gc_id, _n_faces, cs_int_t);
+  BFT_REALLOC(_face_vtx_idx, _n_faces + 1, cs_lnum_t);
+  BFT_REALLOC(_face_vtx, _n_face_vtx, cs_gnum_t);
+
+  *n_faces = _n_faces;
+  *face_cells = _face_cells;
+  *face_gc_id = _face_gc_id;
+  *face_vtx_idx = _face_vtx_idx;
+  *face_vtx = _face_vtx;
+
+  return n_unmatched;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a given file is a Gmsh mesh file.
+ *
+ * This function is collective: the file's signature is read by the
+ * first rank only, and the result is broadcast to all ranks.
+ *
+ * parameters:
+ *   path <-- file path
+ *
+ * returns:
+ *   true if the file starts with a Gmsh "$MeshFormat" section,
+ *   false otherwise.
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_read_gmsh_check(const char  *path)
+{
+  int retval = 0;
+
+  if (cs_glob_rank_id < 1) {
+    FILE *f = fopen(path, "rb");
+    if (f != NULL) {
+      char buf[12];
+      size_t n = fread(buf, 1, 11, f);
+      buf[n] = '\0';
+      if (strcmp(buf, "$MeshFormat") == 0)
+        retval = 1;
+      fclose(f);
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&retval, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  return (retval) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read mesh metadata from a Gmsh file.
+ *
+ * Only the Gmsh 4.1 binary format is handled. Section headers and block
+ * descriptors are scanned (data arrays are skipped), so that global
+ * dimensions, groups and families may be defined in the mesh structure,
+ * and the positions of node and element blocks are kept for the
+ * distributed read by cs_mesh_read_gmsh_data().
+ *
+ * Each physical group of a surface or volume entity defines a group,
+ * and each such entity with physical groups defines a family.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_gmsh_headers(const char         *path,
+                          cs_mesh_t          *mesh,
+                          cs_mesh_builder_t  *mb)
+{
+  bft_printf(_(" Reading metadata from Gmsh file: \"%s\"\n"), path);
+
+  if (mesh->n_families > 0 || mesh->n_g_cells > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\":\n"
+                "  direct reading may not be combined with other inputs."),
+              path);
+
+  _gmsh_info_destroy(&_gmsh_info);
+  _gmsh_info = _read_headers(path, mesh);
+
+  mesh->n_g_cells = _gmsh_info->n_g_cells;
+  mesh->n_g_vertices = _gmsh_info->n_g_nodes;
+
+  /* Faces are only known once built */
+
+  mb->n_g_faces = 0;
+  mb->n_g_face_connect_size = 0;
+
+  if (mesh->n_g_cells == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\":\n"
+                "  no volume elements found."),
+              path);
+}
+
+/*----------------------------------------------------------------------------
+ * Read mesh data from a Gmsh file into the mesh builder.
+ *
+ * Vertices and cells are read by blocks based on the builder's block
+ * distribution, and faces are built in parallel by matching the faces
+ * of each cell on the rank associated with their lowest vertex number.
+ * Faces are numbered in lexicographical order of their sorted vertex
+ * numbers, so face global numbers do not depend on the number of ranks
+ * used for reading.
+ *
+ * cs_mesh_read_gmsh_headers() must have been called first, and the
+ * builder's cell and vertex block distributions must have been set.
+ * The face block distribution is defined here.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_gmsh_data(const char         *path,
+                       cs_mesh_t          *mesh,
+                       cs_mesh_builder_t  *mb)
+{
+  const _gmsh_info_t *gi = _gmsh_info;
+
+  const int rank_id = cs_glob_rank_id;
+  const int n_ranks = cs_glob_n_ranks;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  if (gi == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Gmsh file \"%s\":\n"
+                "  metadata must be read before data."),
+              path);
+
+  bft_printf(_(" Reading mesh from Gmsh file: \"%s\"\n"), path);
+
+  cs_file_t *f = cs_file_open_default(path, CS_FILE_MODE_READ);
+  cs_file_set_swap_endian(f, gi->swap_endian);
+
+  /* Vertices */
+
+  _read_vertices(f, gi, mb);
+
+  /* Cells and surface elements, as face records */
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+  cs_lnum_t n_recs = 0, n_recs_max = 0;
+  cs_gnum_t *recs = NULL;
+
+  BFT_MALLOC(mb->cell_gc_id, n_cells, cs_int_t);
+
+  _read_elements(f, gi, 3, mb->cell_bi.gnum_range, mb->cell_gc_id,
+                 &n_recs, &n_recs_max, &recs);
+
+  cs_block_dist_info_t b_elt_bi
+    = cs_block_dist_compute_sizes(rank_id,
+                                  n_ranks,
+                                  mb->min_rank_step,
+                                  0,
+                                  gi->n_g_b_elts);
+
+  _read_elements(f, gi, 2, b_elt_bi.gnum_range, NULL,
+                 &n_recs, &n_recs_max, &recs);
+
+  cs_file_free(f);
+
+  /* Gather records of a given face on the rank of its lowest vertex */
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+
+    cs_gnum_t *min_vtx = NULL;
+    BFT_MALLOC(min_vtx, n_recs, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < n_recs; i++) {
+      const cs_gnum_t *r = recs + i*CS_GMSH_FACE_STRIDE;
+      min_vtx[i] = r[1];
+      for (cs_gnum_t j = 1; j < r[0]; j++)
+        min_vtx[i] = CS_MIN(min_vtx[i], r[1+j]);
+    }
+
+    cs_block_dist_info_t vtx_key_bi
+      = cs_block_dist_compute_sizes(rank_id,
+                                    n_ranks,
+                                    1,
+                                    0,
+                                    mesh->n_g_vertices);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_recs,
+                                        0,
+                                        min_vtx,
+                                        vtx_key_bi,
+                                        cs_glob_mpi_comm);
+
+    cs_gnum_t *_recs = cs_all_to_all_copy_array(d,
+                                                CS_GNUM_TYPE,
+                                                CS_GMSH_FACE_STRIDE,
+                                                false,
+                                                recs,
+                                                NULL);
+
+    n_recs = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(min_vtx);
+    BFT_FREE(recs);
+    recs = _recs;
+
+  }
+
+#endif
+
+  /* Build faces */
+
+  cs_lnum_t n_faces = 0;
+  cs_gnum_t *face_cells = NULL, *face_vtx = NULL;
+  cs_int_t *face_gc_id = NULL;
+  cs_lnum_t *face_vtx_idx = NULL;
+
+  cs_gnum_t n_unmatched = _build_faces(n_recs,
+                                       recs,
+                                       &n_faces,
+                                       &face_cells,
+                                       &face_gc_id,
+                                       &face_vtx_idx,
+                                       &face_vtx);
+
+  BFT_FREE(recs);
+
+  cs_gnum_t n_g_counts[3] = {n_faces, face_vtx_idx[n_faces], n_unmatched};
+  cs_parall_counter(n_g_counts, 3);
+
+  mb->n_g_faces = n_g_counts[0];
+  mb->n_g_face_connect_size = n_g_counts[1];
+
+  int min_block_size = 0;
+#if defined(HAVE_MPI)
+  cs_file_get_default_comm(NULL, &min_block_size, NULL, NULL);
+#endif
+
+  mb->face_bi
+    = cs_block_dist_compute_sizes(rank_id,
+                                  n_ranks,
+                                  mb->min_rank_step,
+                                  min_block_size/(sizeof(cs_gnum_t)*2),
+                                  mb->n_g_faces);
+
+  /* Distribute faces to blocks */
+
+  if (n_ranks == 1) {
+    mb->face_cells = face_cells;
+    mb->face_gc_id = face_gc_id;
+    mb->face_vertices_idx = face_vtx_idx;
+    mb->face_vertices = face_vtx;
+  }
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+
+    cs_gnum_t face_shift = 0, _n_faces = n_faces;
+    MPI_Scan(&_n_faces, &face_shift, 1, CS_MPI_GNUM, MPI_SUM,
+             cs_glob_mpi_comm);
+    face_shift -= _n_faces;
+
+    cs_gnum_t *face_gnum = NULL;
+    BFT_MALLOC(face_gnum, n_faces, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      face_gnum[i] = face_shift + i + 1;
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_faces,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        face_gnum,
+                                        mb->face_bi,
+                                        cs_glob_mpi_comm);
+
+    mb->face_cells = cs_all_to_all_copy_array(d,
+                                              CS_GNUM_TYPE,
+                                              2,
+                                              false,
+                                              face_cells,
+                                              NULL);
+
+    mb->face_gc_id = cs_all_to_all_copy_array(d,
+                                              CS_INT_TYPE,
+                                              1,
+                                              false,
+                                              face_gc_id,
+                                              NULL);
+
+    mb->face_vertices_idx = cs_all_to_all_copy_index(d,
+                                                     false,
+                                                     face_vtx_idx,
+                                                     NULL);
+
+    mb->face_vertices = cs_all_to_all_copy_indexed(d,
+                                                   CS_GNUM_TYPE,
+                                                   false,
+                                                   face_vtx_idx,
+                                                   face_vtx,
+                                                   mb->face_vertices_idx,
+                                                   NULL);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(face_gnum);
+    BFT_FREE(face_vtx);
+    BFT_FREE(face_vtx_idx);
+    BFT_FREE(face_gc_id);
+    BFT_FREE(face_cells);
+
+  }
+
+#endif
+
+  _gmsh_info_destroy(&_gmsh_info);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt;
+  CS_TIMER_COUNTER_INIT(dt);
+  cs_timer_counter_add_diff(&dt, &t0, &t1);
+
+  bft_printf(_("   %llu cells, %llu faces and %llu vertices read or built"
+               " in %.3g s\n"),
+             (unsigned long long)mesh->n_g_cells,
+             (unsigned long long)mb->n_g_faces,
+             (unsigned long long)mesh->n_g_vertices,
+             dt.wall_nsec*1e-9);
+
+  if (n_g_counts[2] > 0)
+    bft_printf(_("\n Warning: %llu surface elements of Gmsh file \"%s\"\n"
+                 "          do not match a cell face and are ignored.\n"),
+               (unsigned long long)n_g_counts[2], path);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,129 @@
+#ifndef __CS_MESH_READ_GMSH_H__
+#define __CS_MESH_READ_GMSH_H__
+
+/*============================================================================
+ * Direct distributed reading of Gmsh mesh files.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_base.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check if a given file is a Gmsh mesh file.
+ *
+ * This function is collective: the file's signature is read by the
+ * first rank only, and the result is broadcast to all ranks.
+ *
+ * parameters:
+ *   path <-- file path
+ *
+ * returns:
+ *   true if the file starts with a Gmsh "$MeshFormat" section,
+ *   false otherwise.
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_read_gmsh_check(const char  *path);
+
+/*----------------------------------------------------------------------------
+ * Read mesh metadata from a Gmsh file.
+ *
+ * Only the Gmsh 4.1 binary format is handled. Section headers and block
+ * descriptors are scanned (data arrays are skipped), so that global
+ * dimensions, groups and families may be defined in the mesh structure,
+ * and the positions of node and element blocks are kept for the
+ * distributed read by cs_mesh_read_gmsh_data().
+ *
+ * Each physical group of a surface or volume entity defines a group,
+ * and each such entity with physical groups defines a family.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_gmsh_headers(const char         *path,
+                          cs_mesh_t          *mesh,
+                          cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------
+ * Read mesh data from a Gmsh file into the mesh builder.
+ *
+ * Vertices and cells are read by blocks based on the builder's block
+ * distribution, and faces are built in parallel by matching the faces
+ * of each cell on the rank associated with their lowest vertex number.
+ * Faces are numbered in lexicographical order of their sorted vertex
+ * numbers, so face global numbers do not depend on the number of ranks
+ * used for reading.
+ *
+ * cs_mesh_read_gmsh_headers() must have been called first, and the
+ * builder's cell and vertex block distributions must have been set.
+ * The face block distribution is defined here.
+ *
+ * parameters:
+ *   path <-- file path
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_read_gmsh_data(const char         *path,
+                       cs_mesh_t          *mesh,
+                       cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_READ_GMSH_H__ */
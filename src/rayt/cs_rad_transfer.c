@@ -60,6 +60,8 @@
 
 #include "cs_prototypes.h"
 
+#include "cs_rad_transfer_solve.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -244,7 +246,8 @@ cs_rad_transfer_params_t _rt_params = {.type = CS_RAD_TRANSFER_NONE,
                                        .ifgrno = 31,
                                        .ifrefl = 32,
                                        .itpt1d = 4,
-                                       .atmo_ir_absorption = false};
+                                       .atmo_ir_absorption = false,
+                                       .dom_sweep = false};
 
 cs_rad_transfer_params_t *cs_glob_rad_transfer_params = &_rt_params;
 
@@ -295,6 +298,8 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_solve_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
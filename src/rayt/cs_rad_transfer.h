@@ -112,6 +112,11 @@ typedef struct {
 
   bool          atmo_ir_absorption; /*!< infrared absorption model */
 
+  bool          dom_sweep;          /*!< use a dedicated upwind sweep
+                                         solver for the DOM radiance
+                                         (instead of a generic linear
+                                         solver) */
+
 } cs_rad_transfer_params_t;
 
 extern cs_rad_transfer_params_t *cs_glob_rad_transfer_params;
@@ -192,6 +192,13 @@ cs_rad_transfer_options(void)
 
   rt_params->nwsgg = 1;
 
+  /* -> Use the dedicated upwind sweep solver for the DOM radiance
+   *    (opt-in, as results differ from those of the linear solver
+   *    up to the solver tolerance; not used with the atmospheric
+   *    infrared absorption model) */
+
+  rt_params->dom_sweep = false;
+
   /* User parameters  */
 
   cs_gui_radiative_transfer_parameters();
@@ -341,6 +348,10 @@ cs_rad_transfer_log_setup(void)
         (CS_LOG_SETUP,
          _("    ndirec:                 %3d\n"),
          cs_glob_rad_transfer_params->ndirec);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    dom_sweep:              %3d  (0: linear solver, 1: sweep)\n"),
+       (int)(cs_glob_rad_transfer_params->dom_sweep));
   }
 
   cs_log_printf
@@ -54,8 +54,11 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_parameters_check.h"
@@ -99,10 +102,54 @@ static int ipadom = 0;
  * Local Macro Definitions
  *============================================================================*/
 
+/* Upwind sweep solver convergence parameters */
+
+#define _SWEEP_EPSILON     1.e-10
+#define _SWEEP_N_MAX_ITER  1000
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
 
+/* Upwind sweep solver structure for the DOM radiance */
+
+typedef struct {
+
+  cs_lnum_t      n_cells;       /* number of cells for which it was built */
+  cs_lnum_t      n_cells_ext;   /* number of cells with ghosts */
+  cs_lnum_t      n_i_faces;     /* number of interior faces */
+  int            fvq_count;     /* mesh quantities computation count */
+
+  const cs_mesh_t             *mesh;           /* associated mesh */
+  const cs_mesh_quantities_t  *mq;             /* associated quantities */
+  const cs_real_t             *cell_cen;       /* cell centers array */
+  const cs_real_t             *i_face_normal;  /* face normals array */
+
+  int            n_dirs;        /* total number of directions */
+  int            n_batch;       /* number of directions solved together */
+
+  cs_real_3_t   *dirs;          /* direction vectors (n_dirs) */
+
+  cs_lnum_t     *c2f_idx;       /* cell -> interior faces index */
+  cs_lnum_t     *c2f;           /* cell -> interior faces adjacency */
+
+  cs_lnum_t     *order;         /* upwind cell ordering for each direction
+                                   (n_cells * n_dirs) */
+  bool          *exact;         /* true if the ordering of a given direction
+                                   is consistent with all local face fluxes,
+                                   so that a single pass solves it */
+
+  cs_real_t     *radiance;      /* radiance for directions of a batch
+                                   (n_cells_ext * n_batch) */
+
+} cs_rad_transfer_sweep_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_rad_transfer_sweep_t  *_sweep = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -299,6 +346,437 @@ _order_by_direction(void)
   BFT_FREE(s);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy the upwind sweep solver structure.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sweep_destroy(void)
+{
+  if (_sweep == NULL)
+    return;
+
+  BFT_FREE(_sweep->dirs);
+  BFT_FREE(_sweep->c2f_idx);
+  BFT_FREE(_sweep->c2f);
+  BFT_FREE(_sweep->order);
+  BFT_FREE(_sweep->exact);
+  BFT_FREE(_sweep->radiance);
+
+  BFT_FREE(_sweep);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build (or rebuild) the upwind sweep solver structure.
+ *
+ * For each direction, cells are ordered by their projection on the
+ * direction (as for the ordered Gauss-Seidel solver), and we check whether
+ * this ordering is consistent with the upwind direction of each local
+ * interior face, in which case a single pass solves the local system.
+ *
+ * The structure is rebuilt only when the mesh or its quantities change.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sweep_update(void)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  const cs_rad_transfer_params_t  *rt_params = cs_glob_rad_transfer_params;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+
+  const int fvq_count = cs_mesh_quantities_compute_count();
+
+  /* The computation count is not incremented by all geometry updates,
+     so also check the identity of the mesh and of its quantity arrays */
+
+  if (_sweep != NULL) {
+    if (   _sweep->n_cells == n_cells
+        && _sweep->n_cells_ext == m->n_cells_with_ghosts
+        && _sweep->n_i_faces == n_i_faces
+        && _sweep->fvq_count == fvq_count
+        && _sweep->mesh == m
+        && _sweep->mq == fvq
+        && _sweep->cell_cen == fvq->cell_cen
+        && _sweep->i_face_normal == fvq->i_face_normal
+        && _sweep->n_dirs == 8*rt_params->ndirs)
+      return;
+    _sweep_destroy();
+  }
+
+  BFT_MALLOC(_sweep, 1, cs_rad_transfer_sweep_t);
+
+  cs_rad_transfer_sweep_t *sw = _sweep;
+
+  sw->n_cells = n_cells;
+  sw->n_cells_ext = m->n_cells_with_ghosts;
+  sw->n_i_faces = n_i_faces;
+  sw->fvq_count = fvq_count;
+
+  sw->mesh = m;
+  sw->mq = fvq;
+  sw->cell_cen = fvq->cell_cen;
+  sw->i_face_normal = fvq->i_face_normal;
+
+  sw->n_dirs = 8*rt_params->ndirs;
+  sw->n_batch = CS_MAX(CS_MIN(cs_glob_n_threads, sw->n_dirs), 1);
+
+  /* Directions, in the same order as in the main solver loop */
+
+  BFT_MALLOC(sw->dirs, sw->n_dirs, cs_real_3_t);
+
+  int kdir = 0;
+  for (int ii = -1; ii < 2; ii+=2) {
+    for (int jj = -1; jj < 2; jj+=2) {
+      for (int kk = -1; kk < 2; kk+=2) {
+        for (int dir_id = 0; dir_id < rt_params->ndirs; dir_id++) {
+          sw->dirs[kdir][0] = ii*rt_params->vect_s[dir_id][0];
+          sw->dirs[kdir][1] = jj*rt_params->vect_s[dir_id][1];
+          sw->dirs[kdir][2] = kk*rt_params->vect_s[dir_id][2];
+          kdir++;
+        }
+      }
+    }
+  }
+
+  /* Cell -> interior faces adjacency */
+
+  BFT_MALLOC(sw->c2f_idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++)
+    sw->c2f_idx[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int i = 0; i < 2; i++) {
+      cs_lnum_t c_id = i_face_cells[f_id][i];
+      if (c_id < n_cells)
+        sw->c2f_idx[c_id + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    sw->c2f_idx[c_id + 1] += sw->c2f_idx[c_id];
+
+  BFT_MALLOC(sw->c2f, sw->c2f_idx[n_cells], cs_lnum_t);
+
+  cs_lnum_t *c2f_count;
+  BFT_MALLOC(c2f_count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    c2f_count[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int i = 0; i < 2; i++) {
+      cs_lnum_t c_id = i_face_cells[f_id][i];
+      if (c_id < n_cells) {
+        sw->c2f[sw->c2f_idx[c_id] + c2f_count[c_id]] = f_id;
+        c2f_count[c_id] += 1;
+      }
+    }
+  }
+
+  BFT_FREE(c2f_count);
+
+  /* Upwind ordering for each direction */
+
+  BFT_MALLOC(sw->order, (size_t)n_cells * (size_t)(sw->n_dirs), cs_lnum_t);
+  BFT_MALLOC(sw->exact, sw->n_dirs, bool);
+
+  cs_real_t *s;
+  cs_lnum_t *rank;
+  BFT_MALLOC(s, n_cells, cs_real_t);
+  BFT_MALLOC(rank, n_cells, cs_lnum_t);
+
+  for (int d_id = 0; d_id < sw->n_dirs; d_id++) {
+
+    const cs_real_t *v = sw->dirs[d_id];
+    cs_lnum_t *order = sw->order + (size_t)n_cells*d_id;
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      s[c_id] = cs_math_3_dot_product(v, cell_cen[c_id]);
+
+    _order_axis(s, order, n_cells);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      rank[order[i]] = i;
+
+    bool exact = true;
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces && exact; f_id++) {
+      cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+      cs_lnum_t c_id_1 = i_face_cells[f_id][1];
+      if (c_id_0 >= n_cells || c_id_1 >= n_cells)
+        continue;
+      cs_real_t flux = cs_math_3_dot_product(v, i_face_normal[f_id]);
+      if (flux > 0 && rank[c_id_0] > rank[c_id_1])
+        exact = false;
+      else if (flux < 0 && rank[c_id_1] > rank[c_id_0])
+        exact = false;
+    }
+
+    sw->exact[d_id] = exact;
+
+  }
+
+  BFT_FREE(rank);
+  BFT_FREE(s);
+
+  BFT_MALLOC(sw->radiance,
+             (size_t)(sw->n_cells_ext) * (size_t)(sw->n_batch),
+             cs_real_t);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Perform one upwind sweep for a given direction.
+ *
+ * This solves (or, for a non-exact ordering, does one ordered Gauss-Seidel
+ * pass on) the same first-order upwind system as the generic convection
+ * operator: for each cell, the radiance is obtained from the radiance of
+ * its upwind neighbors (ghost cells included) and the inflow boundary
+ * conditions.
+ *
+ * \param[in]       sw        pointer to sweep structure
+ * \param[in]       v         direction vector
+ * \param[in]       order     upwind cell ordering for this direction
+ * \param[in]       rovsdt    implicit source term
+ * \param[in]       rhs       explicit source term
+ * \param[in]       coefap    boundary condition coefficients (explicit)
+ * \param[in]       coefbp    boundary condition coefficients (implicit)
+ * \param[in, out]  radiance  radiance
+ *
+ * \return  maximum absolute change of the radiance on local cells
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t
+_sweep_direction(const cs_rad_transfer_sweep_t  *sw,
+                 const cs_real_t                 v[3],
+                 const cs_lnum_t                 order[],
+                 const cs_real_t                 rovsdt[],
+                 const cs_real_t                 rhs[],
+                 const cs_real_t                 coefap[],
+                 const cs_real_t                 coefbp[],
+                 cs_real_t             *restrict radiance)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_adjacencies_t  *ma = cs_glob_mesh_adjacencies;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_lnum_t *restrict c2f_idx = sw->c2f_idx;
+  const cs_lnum_t *restrict c2f = sw->c2f;
+  const cs_lnum_t *restrict c2b_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *restrict c2b = ma->cell_b_faces;
+
+  cs_real_t delta = 0.;
+
+  for (cs_lnum_t i = 0; i < sw->n_cells; i++) {
+
+    cs_lnum_t c_id = order[i];
+
+    cs_real_t num = rhs[c_id];
+    cs_real_t den = rovsdt[c_id];
+
+    /* Inflow from upwind neighbors */
+
+    for (cs_lnum_t j = c2f_idx[c_id]; j < c2f_idx[c_id+1]; j++) {
+      cs_lnum_t f_id = c2f[j];
+      cs_real_t flux = cs_math_3_dot_product(v, i_face_normal[f_id]);
+      if (i_face_cells[f_id][0] == c_id) {
+        if (flux < 0) {
+          num -= flux*radiance[i_face_cells[f_id][1]];
+          den -= flux;
+        }
+      }
+      else {
+        if (flux > 0) {
+          num += flux*radiance[i_face_cells[f_id][0]];
+          den += flux;
+        }
+      }
+    }
+
+    /* Inflow from boundary */
+
+    for (cs_lnum_t j = c2b_idx[c_id]; j < c2b_idx[c_id+1]; j++) {
+      cs_lnum_t f_id = c2b[j];
+      cs_real_t flux = cs_math_3_dot_product(v, b_face_normal[f_id]);
+      if (flux < 0) {
+        num -= flux*coefap[f_id];
+        den -= flux*(1. - coefbp[f_id]);
+      }
+    }
+
+    cs_real_t r = (den > 0) ? num/den : 0.;
+
+    delta = CS_MAX(delta, CS_ABS(r - radiance[c_id]));
+    radiance[c_id] = r;
+
+  }
+
+  return delta;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the radiance for a batch of directions using upwind sweeps.
+ *
+ * Directions of a batch are swept in parallel by different threads.
+ * Coupling across ranks is handled by block-Jacobi iterations: after each
+ * sweep, ghost cell values are updated, and sweeps are repeated until
+ * ghost values (and local values for non-exact orderings) do not change.
+ *
+ * \param[in, out]  sw         pointer to sweep structure
+ * \param[in]       d_start    id of first direction of batch
+ * \param[in]       rovsdt     implicit source term
+ * \param[in]       rhs        explicit source term
+ * \param[in]       coefap     boundary condition coefficients (explicit)
+ * \param[in]       coefbp     boundary condition coefficients (implicit)
+ * \param[in]       verbosity  verbosity level
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sweep_solve_batch(cs_rad_transfer_sweep_t  *sw,
+                   int                       d_start,
+                   const cs_real_t           rovsdt[],
+                   const cs_real_t           rhs[],
+                   const cs_real_t           coefap[],
+                   const cs_real_t           coefbp[],
+                   int                       verbosity)
+{
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+
+  const cs_lnum_t n_cells = sw->n_cells;
+  const cs_lnum_t n_cells_ext = sw->n_cells_ext;
+  const cs_lnum_t n_ghosts = n_cells_ext - n_cells;
+  const int n_b = CS_MIN(sw->n_batch, sw->n_dirs - d_start);
+
+  int *n_iter;
+  bool *converged;
+  cs_real_t *delta, *r_max, *res;
+  BFT_MALLOC(n_iter, n_b, int);
+  BFT_MALLOC(converged, n_b, bool);
+  BFT_MALLOC(delta, n_b, cs_real_t);
+  BFT_MALLOC(r_max, n_b, cs_real_t);
+  BFT_MALLOC(res, 2*n_b, cs_real_t);
+
+  cs_real_t *g_prev = NULL;
+  if (halo != NULL)
+    BFT_MALLOC(g_prev, (size_t)n_ghosts * (size_t)n_b, cs_real_t);
+
+  for (int b_id = 0; b_id < n_b; b_id++) {
+    cs_real_t *radiance = sw->radiance + (size_t)n_cells_ext*b_id;
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      radiance[c_id] = 0.;
+    n_iter[b_id] = 0;
+    converged[b_id] = false;
+  }
+
+  int n_active = n_b;
+
+  while (n_active > 0) {
+
+    /* Local sweeps for active directions */
+
+#   pragma omp parallel for schedule(dynamic, 1) if (n_b > 1)
+    for (int b_id = 0; b_id < n_b; b_id++) {
+      if (converged[b_id])
+        continue;
+      int d_id = d_start + b_id;
+      cs_real_t *radiance = sw->radiance + (size_t)n_cells_ext*b_id;
+      delta[b_id] = _sweep_direction(sw,
+                                     sw->dirs[d_id],
+                                     sw->order + (size_t)n_cells*d_id,
+                                     rovsdt,
+                                     rhs,
+                                     coefap,
+                                     coefbp,
+                                     radiance);
+      if (sw->exact[d_id])
+        delta[b_id] = 0.;
+      r_max[b_id] = 0.;
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        r_max[b_id] = CS_MAX(r_max[b_id], CS_ABS(radiance[c_id]));
+      n_iter[b_id] += 1;
+    }
+
+    /* Update ghost values; change in ghost values means that
+       upwind neighboring ranks have not converged yet */
+
+    for (int b_id = 0; b_id < n_b; b_id++) {
+      if (converged[b_id] || halo == NULL)
+        continue;
+      cs_real_t *radiance = sw->radiance + (size_t)n_cells_ext*b_id;
+      cs_real_t *_g_prev = g_prev + (size_t)n_ghosts*b_id;
+      for (cs_lnum_t i = 0; i < n_ghosts; i++)
+        _g_prev[i] = radiance[n_cells + i];
+      cs_halo_sync_var(halo, CS_HALO_STANDARD, radiance);
+      for (cs_lnum_t i = 0; i < n_ghosts; i++)
+        delta[b_id] = CS_MAX(delta[b_id],
+                             CS_ABS(radiance[n_cells + i] - _g_prev[i]));
+    }
+
+    /* Global convergence check */
+
+    for (int b_id = 0; b_id < n_b; b_id++) {
+      res[b_id*2] = (converged[b_id]) ? 0. : delta[b_id];
+      res[b_id*2 + 1] = (converged[b_id]) ? 0. : r_max[b_id];
+    }
+
+    cs_parall_max(2*n_b, CS_REAL_TYPE, res);
+
+    n_active = 0;
+
+    for (int b_id = 0; b_id < n_b; b_id++) {
+      if (converged[b_id])
+        continue;
+      if (   res[b_id*2] <= _SWEEP_EPSILON*res[b_id*2 + 1]
+          || n_iter[b_id] >= _SWEEP_N_MAX_ITER) {
+        converged[b_id] = true;
+        if (res[b_id*2] > _SWEEP_EPSILON*res[b_id*2 + 1])
+          cs_log_printf(CS_LOG_DEFAULT,
+                        _("   Radiance sweep for direction %d not converged "
+                          "after %d iterations (change: %12.5e)\n"),
+                        d_start + b_id + 1, n_iter[b_id], res[b_id*2]);
+        else if (verbosity > 0)
+          cs_log_printf(CS_LOG_DEFAULT,
+                        _("   Radiance sweep for direction %d: "
+                          "%d iteration(s)\n"),
+                        d_start + b_id + 1, n_iter[b_id]);
+      }
+      else
+        n_active++;
+    }
+
+  }
+
+  BFT_FREE(g_prev);
+  BFT_FREE(res);
+  BFT_FREE(r_max);
+  BFT_FREE(delta);
+  BFT_FREE(converged);
+  BFT_FREE(n_iter);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Radiative flux and source term computation
@@ -425,7 +903,18 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
   /* There are Dirichlet BCs */
   int ndirc1 = 1;
 
-  if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
+  /* Use the dedicated upwind sweep solver when possible
+     (the atmospheric model uses direction-dependent source terms
+     and boundary conditions) */
+
+  cs_rad_transfer_sweep_t *sw = NULL;
+
+  if (   cs_glob_rad_transfer_params->dom_sweep
+      && cs_glob_rad_transfer_params->atmo_ir_absorption == false) {
+    _sweep_update();
+    sw = _sweep;
+  }
+  else if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
     _order_by_direction();
 
   /*                              / -> ->
@@ -527,110 +1016,136 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
                                       gg_id);
 
 
-          char    cnom[80];
-          snprintf(cnom, 80, "%s%03d", "radiation_", kdir);
+          /* Solve using upwind sweeps (by batches of directions) */
 
-          /* Spatial discretization */
+          if (sw != NULL) {
 
-          /* Explicit source term */
+            int b_id = (kdir - 1) % sw->n_batch;
+            if (b_id == 0)
+              _sweep_solve_batch(sw,
+                                 kdir - 1,
+                                 rovsdt,
+                                 rhs0,
+                                 coefap,
+                                 coefbp,
+                                 cs_glob_rad_transfer_params->iimlum);
 
-          for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
-            rhs[cell_id] = rhs0[cell_id];
+            memcpy(radiance,
+                   sw->radiance + (size_t)n_cells_ext*b_id,
+                   n_cells_ext*sizeof(cs_real_t));
 
-          /* Implicit source term (rovsdt seen above) */
+          }
 
-          for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
-            viscf[face_id] = 0.0;
+          /* Solve using the generic convection operator and linear solver */
 
-          for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
-            viscb[face_id] = 0.0;
+          else {
 
-          for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
-            radiance[cell_id] = 0.0;
-            radiance_prev[cell_id] = 0.0;
-          }
+            char    cnom[80];
+            snprintf(cnom, 80, "%s%03d", "radiation_", kdir);
 
-          for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-            flurds[face_id] =  vect_s[0] * i_face_normal[face_id][0]
-                             + vect_s[1] * i_face_normal[face_id][1]
-                             + vect_s[2] * i_face_normal[face_id][2];
-            if (i_face_cells[face_id][0] > n_cells || i_face_cells[face_id][1] > n_cells)
-              flurds[face_id] = 0.;//HARD CODING
+            /* Spatial discretization */
 
-          }
+            /* Explicit source term */
 
-          for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
-            flurdb[face_id] =  vect_s[0] * b_face_normal[face_id][0]
-                             + vect_s[1] * b_face_normal[face_id][1]
-                             + vect_s[2] * b_face_normal[face_id][2];
+            for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+              rhs[cell_id] = rhs0[cell_id];
 
-          /* Upwards/Downwards atmospheric integration */
+            /* Implicit source term (rovsdt seen above) */
 
-          if (cs_glob_rad_transfer_params->atmo_ir_absorption) {
+            for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+              viscf[face_id] = 0.0;
 
-            cs_field_t *f_ck_u = cs_field_by_name("rad_absorption_coeff_up");
-            cs_field_t *f_ck_d = cs_field_by_name("rad_absorption_coeff_down");
-            const cs_real_t *ck_u = f_ck_u->val;
-            const cs_real_t *ck_d = f_ck_d->val;
+            for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+              viscb[face_id] = 0.0;
 
-            for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+            for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+              radiance[cell_id] = 0.0;
+              radiance_prev[cell_id] = 0.0;
+            }
 
-              if (cs_math_3_dot_product(cs_glob_physical_constants->gravity,
-                                        vect_s) < 0.0) {
-                ck_u_d[cell_id] =  ck_u[cell_id] * 3./5.;
-              }
-              else {
-                ck_u_d[cell_id] =  ck_d[cell_id] * 3./5.;
-              }
-              rovsdt[cell_id] =  ck_u_d[cell_id] * cell_vol[cell_id];
+            for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+              flurds[face_id] =  vect_s[0] * i_face_normal[face_id][0]
+                               + vect_s[1] * i_face_normal[face_id][1]
+                               + vect_s[2] * i_face_normal[face_id][2];
+              if (i_face_cells[face_id][0] > n_cells || i_face_cells[face_id][1] > n_cells)
+                flurds[face_id] = 0.;//HARD CODING
+
+            }
+
+            for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+              flurdb[face_id] =  vect_s[0] * b_face_normal[face_id][0]
+                               + vect_s[1] * b_face_normal[face_id][1]
+                               + vect_s[2] * b_face_normal[face_id][2];
+
+            /* Upwards/Downwards atmospheric integration */
 
-              rhs[cell_id]  =  ck_u_d[cell_id] * cell_vol[cell_id]
-                                 * stephn * _pow4(tempk[cell_id]) * onedpi;
+            if (cs_glob_rad_transfer_params->atmo_ir_absorption) {
+
+              cs_field_t *f_ck_u = cs_field_by_name("rad_absorption_coeff_up");
+              cs_field_t *f_ck_d = cs_field_by_name("rad_absorption_coeff_down");
+              const cs_real_t *ck_u = f_ck_u->val;
+              const cs_real_t *ck_d = f_ck_d->val;
+
+              for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+                if (cs_math_3_dot_product(cs_glob_physical_constants->gravity,
+                                          vect_s) < 0.0) {
+                  ck_u_d[cell_id] =  ck_u[cell_id] * 3./5.;
+                }
+                else {
+                  ck_u_d[cell_id] =  ck_d[cell_id] * 3./5.;
+                }
+                rovsdt[cell_id] =  ck_u_d[cell_id] * cell_vol[cell_id];
+
+                rhs[cell_id]  =  ck_u_d[cell_id] * cell_vol[cell_id]
+                                   * stephn * _pow4(tempk[cell_id]) * onedpi;
+
+              }
 
             }
 
-          }
+            /* Resolution
+               ---------- */
+
+            /* In case of a theta-scheme, set theta = 1;
+               no relaxation in steady case either */
+
+            /* All boundary convective fluxes with upwind */
+            int icvflb = 0;
+
+            cs_equation_iterative_solve_scalar(0,   /* idtvar */
+                                               1,   /* external sub-iteration */
+                                               -1,  /* f_id */
+                                               cnom,
+                                               ndirc1,
+                                               iescap,
+                                               imucpp,
+                                               &vcopt,
+                                               radiance_prev,
+                                               radiance,
+                                               coefap,
+                                               coefbp,
+                                               cofafp,
+                                               cofbfp,
+                                               flurds,
+                                               flurdb,
+                                               viscf,
+                                               viscb,
+                                               viscf,
+                                               viscb,
+                                               NULL,
+                                               NULL,
+                                               NULL,
+                                               icvflb,
+                                               NULL,
+                                               rovsdt,
+                                               rhs,
+                                               radiance,
+                                               dpvar,
+                                               NULL,
+                                               NULL);
 
-          /* Resolution
-             ---------- */
-
-          /* In case of a theta-scheme, set theta = 1;
-             no relaxation in steady case either */
-
-          /* All boundary convective fluxes with upwind */
-          int icvflb = 0;
-
-          cs_equation_iterative_solve_scalar(0,   /* idtvar */
-                                             1,   /* external sub-iteration */
-                                             -1,  /* f_id */
-                                             cnom,
-                                             ndirc1,
-                                             iescap,
-                                             imucpp,
-                                             &vcopt,
-                                             radiance_prev,
-                                             radiance,
-                                             coefap,
-                                             coefbp,
-                                             cofafp,
-                                             cofbfp,
-                                             flurds,
-                                             flurdb,
-                                             viscf,
-                                             viscb,
-                                             viscf,
-                                             viscb,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             icvflb,
-                                             NULL,
-                                             rovsdt,
-                                             rhs,
-                                             radiance,
-                                             dpvar,
-                                             NULL,
-                                             NULL);
+          }
 
           /* Integration of fluxes and source terms */
 
@@ -2103,6 +2618,18 @@ cs_rad_transfer_solve(int               bc_type[],
   BFT_FREE(iempimh2);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free structures used by the radiative transfer equation solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void)
+{
+  _sweep_destroy();
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
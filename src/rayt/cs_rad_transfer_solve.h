@@ -80,6 +80,15 @@ cs_rad_transfer_solve(int               bc_type[],
                       const cs_real_t   cp2ch[],
                       const int         ichcor[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free structures used by the radiative transfer equation solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -183,6 +183,21 @@ typedef struct _cs_inflow_sem_t {
 
 } cs_inflow_sem_t;
 
+/* Uniform grid binning of the SEM eddies over the virtual box */
+/*--------------------------------------------------------------*/
+
+typedef struct {
+
+  int            n_bins[3];           /* Number of bins in each direction     */
+  double         origin[3];           /* Lower corner of the grid             */
+  double         inv_bin_size[3];     /* Inverse of bin size in each dir.     */
+
+  cs_lnum_t     *bin_idx;             /* Index of eddies in each bin          */
+  double        *position;            /* Eddy positions, ordered by bin       */
+  double        *energy;              /* Eddy energies, ordered by bin        */
+
+} _sem_eddy_grid_t;
+
 typedef struct
 {
   double  val;
@@ -416,6 +431,153 @@ _batten_method(const cs_int_t       n_points,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Bin index of a coordinate in a given direction of an eddy grid.
+ *
+ * parameters:
+ *   g       --> pointer to eddy grid
+ *   coo_id  --> direction
+ *   x       --> coordinate
+ *
+ * returns:
+ *   bin index, clipped to the grid
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_sem_grid_bin(const _sem_eddy_grid_t  *g,
+              int                      coo_id,
+              double                   x)
+{
+  double r = (x - g->origin[coo_id]) * g->inv_bin_size[coo_id];
+  int b = 0;
+
+  if (r > 0.)
+    b = (r < (double)(g->n_bins[coo_id])) ? (int)r : g->n_bins[coo_id] - 1;
+
+  return b;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a uniform grid binning of the SEM eddies over the virtual box.
+ *
+ * The bin size in each direction is at least the largest local eddy
+ * length scale, so that a point only needs to visit the bins overlapping
+ * its own support. The total number of bins is limited to the order of
+ * the number of eddies.
+ *
+ * Eddy positions and energies are copied in bin order, so that the
+ * eddies of a given bin are contiguous in memory.
+ *
+ * parameters:
+ *   inflow        --> SEM structure
+ *   box_min_coord --> lower corner of the virtual box
+ *   box_length    --> dimensions of the virtual box
+ *   ls_max        --> local maximum length scale in each direction
+ *   g             <-> eddy grid
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_grid_build(const cs_inflow_sem_t  *inflow,
+                const double            box_min_coord[3],
+                const double            box_length[3],
+                const double            ls_max[3],
+                _sem_eddy_grid_t       *g)
+{
+  const cs_lnum_t n_structures = inflow->n_structures;
+
+  /* Grid dimensions */
+
+  cs_lnum_t n_bins_max = CS_MAX(n_structures, 1);
+  cs_lnum_t n_bins_tot = 1;
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    double n = 1.;
+    if (ls_max[coo_id] > 0. && box_length[coo_id] > 0.)
+      n = floor(box_length[coo_id] / ls_max[coo_id]);
+    n = CS_MIN(n, (double)n_bins_max);
+    g->n_bins[coo_id] = CS_MAX((int)n, 1);
+  }
+
+  /* Coarsen the largest dimensions until the number of bins is bounded */
+
+  while (true) {
+    n_bins_tot = (cs_lnum_t)g->n_bins[0]*g->n_bins[1]*g->n_bins[2];
+    if (n_bins_tot <= n_bins_max)
+      break;
+    int c_max = 0;
+    for (int coo_id = 1; coo_id < 3; coo_id++)
+      if (g->n_bins[coo_id] > g->n_bins[c_max])
+        c_max = coo_id;
+    g->n_bins[c_max] = CS_MAX(g->n_bins[c_max] / 2, 1);
+  }
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    g->origin[coo_id] = box_min_coord[coo_id];
+    g->inv_bin_size[coo_id] = 0.;
+    if (box_length[coo_id] > 0.)
+      g->inv_bin_size[coo_id] = g->n_bins[coo_id] / box_length[coo_id];
+  }
+
+  /* Count eddies per bin */
+
+  cs_lnum_t *eddy_bin;
+
+  BFT_MALLOC(eddy_bin, n_structures, cs_lnum_t);
+  BFT_MALLOC(g->bin_idx, n_bins_tot + 1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_bins_tot + 1; i++)
+    g->bin_idx[i] = 0;
+
+  for (cs_lnum_t struct_id = 0; struct_id < n_structures; struct_id++) {
+    const double *x = inflow->position + 3*struct_id;
+    int b[3];
+    for (int coo_id = 0; coo_id < 3; coo_id++)
+      b[coo_id] = _sem_grid_bin(g, coo_id, x[coo_id]);
+    eddy_bin[struct_id] = (  (cs_lnum_t)b[0]*g->n_bins[1]
+                           + b[1])*g->n_bins[2] + b[2];
+    g->bin_idx[eddy_bin[struct_id] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_bins_tot; i++)
+    g->bin_idx[i+1] += g->bin_idx[i];
+
+  /* Copy eddies in bin order (preserving their relative order) */
+
+  cs_lnum_t *bin_count;
+  BFT_MALLOC(bin_count, n_bins_tot, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_bins_tot; i++)
+    bin_count[i] = g->bin_idx[i];
+
+  BFT_MALLOC(g->position, 3*n_structures, double);
+  BFT_MALLOC(g->energy, 3*n_structures, double);
+
+  for (cs_lnum_t struct_id = 0; struct_id < n_structures; struct_id++) {
+    cs_lnum_t k = bin_count[eddy_bin[struct_id]]++;
+    for (int coo_id = 0; coo_id < 3; coo_id++) {
+      g->position[3*k + coo_id] = inflow->position[3*struct_id + coo_id];
+      g->energy[3*k + coo_id] = inflow->energy[3*struct_id + coo_id];
+    }
+  }
+
+  BFT_FREE(bin_count);
+  BFT_FREE(eddy_bin);
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of an SEM eddy grid.
+ *
+ * parameters:
+ *   g <-> eddy grid
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_grid_free(_sem_eddy_grid_t  *g)
+{
+  BFT_FREE(g->bin_idx);
+  BFT_FREE(g->position);
+  BFT_FREE(g->energy);
+}
+
 /*----------------------------------------------------------------------------
  * Generation of synthetic turbulence via the Synthetic Eddy Method (SEM).
  *
@@ -838,37 +1000,94 @@ _synthetic_eddy_method(const cs_int_t    n_points,
 
   alpha = sqrt(box_volume / (double) inflow->n_structures);
 
-  for (point_id = 0; point_id < n_points; point_id++) {
+  /* Eddies are binned on a uniform grid over the box, so that each point
+     only visits the eddies of the bins overlapping its support */
 
-    double distance[3];
+  if (n_points > 0) {
 
-    for (struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    double ls_max[3] = {0., 0., 0.};
 
+    for (point_id = 0; point_id < n_points; point_id++)
       for (coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id*3 + coo_id]
-                 - inflow->position[struct_id*3 + coo_id]);
+        ls_max[coo_id] = CS_MAX(ls_max[coo_id],
+                                length_scale[3*point_id + coo_id]);
 
-      if (distance[0] < length_scale[point_id*3 + 0] &&
-          distance[1] < length_scale[point_id*3 + 1] &&
-          distance[2] < length_scale[point_id*3 + 2]) {
+    _sem_eddy_grid_t  g;
 
-        double form_function = 1.;
-        for (coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id*3 + coo_id])
-            /sqrt(2./3.*length_scale[point_id*3 + coo_id]);
+    _sem_grid_build(inflow, box_min_coord, box_length, ls_max, &g);
 
-        for (coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id*3 + coo_id] +=
-            inflow->energy[struct_id*3 + coo_id]*form_function;
+    const double sqrt_3_by_2 = sqrt(1.5);
+
+#   pragma omp parallel for if (n_points > CS_THR_MIN)
+    for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+      const double *x = point_coordinates + 3*p_id;
+      const double *ls = length_scale + 3*p_id;
 
+      double inv_ls[3], b_min[3], b_max[3];
+      int bin_min[3], bin_max[3];
+
+      /* Normalization of the shape function is constant for a point */
+
+      double f_norm = 1.;
+
+      for (int c_id = 0; c_id < 3; c_id++) {
+        inv_ls[c_id] = 1./ls[c_id];
+        f_norm *= sqrt_3_by_2 / sqrt(ls[c_id]);
+        b_min[c_id] = x[c_id] - ls[c_id];
+        b_max[c_id] = x[c_id] + ls[c_id];
+        bin_min[c_id] = _sem_grid_bin(&g, c_id, b_min[c_id]);
+        bin_max[c_id] = _sem_grid_bin(&g, c_id, b_max[c_id]);
+      }
+
+      double fluct[3] = {0., 0., 0.};
+
+      for (int i = bin_min[0]; i <= bin_max[0]; i++) {
+        for (int j1 = bin_min[1]; j1 <= bin_max[1]; j1++) {
+
+          /* Bins along the last direction are contiguous */
+
+          cs_lnum_t b_id_0
+            = ((cs_lnum_t)i*g.n_bins[1] + j1)*g.n_bins[2] + bin_min[2];
+          cs_lnum_t b_id_1
+            = ((cs_lnum_t)i*g.n_bins[1] + j1)*g.n_bins[2] + bin_max[2];
+
+          const cs_lnum_t s_id = g.bin_idx[b_id_0];
+          const cs_lnum_t e_id = g.bin_idx[b_id_1 + 1];
+
+          for (cs_lnum_t k = s_id; k < e_id; k++) {
+
+            const double *e_x = g.position + 3*k;
+
+            double d0 = CS_ABS(x[0] - e_x[0]);
+            double d1 = CS_ABS(x[1] - e_x[1]);
+            double d2 = CS_ABS(x[2] - e_x[2]);
+
+            if (d0 < ls[0] && d1 < ls[1] && d2 < ls[2]) {
+
+              double form_function =   f_norm
+                                     * (1. - d0*inv_ls[0])
+                                     * (1. - d1*inv_ls[1])
+                                     * (1. - d2*inv_ls[2]);
+
+              fluct[0] += g.energy[3*k]    *form_function;
+              fluct[1] += g.energy[3*k + 1]*form_function;
+              fluct[2] += g.energy[3*k + 2]*form_function;
+
+            }
+
+          }
+
+        }
       }
 
+      for (int c_id = 0; c_id < 3; c_id++)
+        fluctuations[p_id*3 + c_id]
+          = (fluctuations[p_id*3 + c_id] + fluct[c_id])*alpha;
+
     }
 
-    for (coo_id = 0; coo_id < 3; coo_id++)
-      fluctuations[point_id*3 + coo_id] *= alpha;
+    _sem_grid_free(&g);
 
   }
 
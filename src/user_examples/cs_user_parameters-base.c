@@ -84,6 +84,7 @@
 #include "cs_thermal_model.h"
 #include "cs_time_moment.h"
 #include "cs_time_step.h"
+#include "cs_timer_stats.h"
 #include "cs_turbomachinery.h"
 #include "cs_turbulence_model.h"
 #include "cs_selector.h"
@@ -349,6 +350,18 @@ cs_user_parameters(void)
   cs_glob_post_util_flag[CS_POST_UTIL_Q_CRITERION] = 1;
 
   /*! [param_var_q_criterion] */
+
+  /* Example: trace timer statistics events for time steps 10 to 12 */
+  /*----------------------------------------------------------------*/
+
+  /* The trace is written to "timer_stats_trace.json", in the Chrome
+     trace event format. */
+
+  /*! [param_timer_stats_trace] */
+
+  cs_timer_stats_set_trace_options(10, 12);
+
+  /*! [param_timer_stats_trace] */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,425 @@
+/*============================================================================
+ * Unit test for cs_mesh_read_gmsh.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_read_gmsh.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Test mesh: 1 hexahedron and 2 prisms (splitting a second hexahedron)
+   along x, with a physical group on the x = 0 boundary quadrangle and one
+   on the volume; node tags are 1 + i + 3*j + 6*k for node (i, j, k) */
+
+static const char _file_name[] = "cs_mesh_read_gmsh_test.msh";
+
+/* Expected faces, in global numbering order (sorted vertex numbers, then
+   number of vertices), whatever the number of ranks: vertices (0 for
+   triangles) and adjacent cells */
+
+static const cs_gnum_t _ref_faces[14][6] = {{1, 2, 4, 5,    1, 0},
+                                            {1, 2, 7, 8,    1, 0},
+                                            {1, 4, 7, 10,   1, 0},
+                                            {2, 3, 6, 0,    2, 0},
+                                            {2, 3, 8, 9,    2, 0},
+                                            {2, 5, 6, 0,    3, 0},
+                                            {2, 5, 8, 11,   1, 3},
+                                            {2, 6, 8, 12,   2, 3},
+                                            {3, 6, 9, 12,   2, 0},
+                                            {4, 5, 10, 11,  1, 0},
+                                            {5, 6, 11, 12,  3, 0},
+                                            {7, 8, 10, 11,  1, 0},
+                                            {8, 9, 12, 0,   2, 0},
+                                            {8, 11, 12, 0,  3, 0}};
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_mesh_read_gmsh_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+static int
+_bft_printf_flush_proxy(void)
+{
+  return fflush(NULL);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_num,
+                   int          sys_err_code,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  CS_UNUSED(filename);
+  CS_UNUSED(line_num);
+
+  bft_printf_flush();
+
+  if (sys_err_code != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(sys_err_code));
+
+  vfprintf(stderr, format, arg_ptr);
+
+  exit(EXIT_FAILURE);
+}
+
+/*----------------------------------------------------------------------------
+ * Write binary values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_int(FILE     *f,
+           int32_t   v)
+{
+  fwrite(&v, 4, 1, f);
+}
+
+static void
+_write_size(FILE      *f,
+            uint64_t   v)
+{
+  fwrite(&v, 8, 1, f);
+}
+
+/*----------------------------------------------------------------------------
+ * Write test mesh in Gmsh 4.1 binary format
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_test_mesh(void)
+{
+  const double bbox[6] = {0, 0, 0, 2, 1, 1};
+
+  FILE *f = fopen(_file_name, "wb");
+  assert(f != NULL);
+
+  fprintf(f, "$MeshFormat\n4.1 1 8\n");
+  _write_int(f, 1);
+  fprintf(f, "\n$EndMeshFormat\n");
+
+  fprintf(f, "$PhysicalNames\n2\n2 20 \"inlet\"\n3 10 \"fluid\"\n"
+          "$EndPhysicalNames\n");
+
+  /* One surface and one volume entity, each with a physical tag */
+
+  fprintf(f, "$Entities\n");
+  _write_size(f, 0);
+  _write_size(f, 0);
+  _write_size(f, 1);
+  _write_size(f, 1);
+  for (int dim = 2; dim < 4; dim++) {
+    _write_int(f, 1);
+    fwrite(bbox, 8, 6, f);
+    _write_size(f, 1);
+    _write_int(f, (dim == 2) ? 20 : 10);
+    _write_size(f, 0);
+  }
+  fprintf(f, "\n$EndEntities\n");
+
+  /* Nodes, in a single block */
+
+  fprintf(f, "$Nodes\n");
+  _write_size(f, 1);
+  _write_size(f, 12);
+  _write_size(f, 1);
+  _write_size(f, 12);
+  _write_int(f, 3);
+  _write_int(f, 1);
+  _write_int(f, 0);
+  _write_size(f, 12);
+  for (int i = 0; i < 12; i++)
+    _write_size(f, i+1);
+  for (int i = 0; i < 12; i++) {
+    double coo[3] = {i%3, (i/3)%2, i/6};
+    fwrite(coo, 8, 3, f);
+  }
+  fprintf(f, "\n$EndNodes\n");
+
+  /* Elements: 1 boundary quadrangle, 1 hexahedron, 2 prisms */
+
+  const uint64_t quad[4] = {1, 4, 10, 7};
+  const uint64_t hexa[8] = {1, 2, 5, 4, 7, 8, 11, 10};
+  const uint64_t prism[2][6] = {{2, 3, 6, 8, 9, 12},
+                                {2, 6, 5, 8, 12, 11}};
+
+  fprintf(f, "$Elements\n");
+  _write_size(f, 3);
+  _write_size(f, 4);
+  _write_size(f, 1);
+  _write_size(f, 4);
+
+  _write_int(f, 2);
+  _write_int(f, 1);
+  _write_int(f, 3);
+  _write_size(f, 1);
+  _write_size(f, 1);
+  fwrite(quad, 8, 4, f);
+
+  _write_int(f, 3);
+  _write_int(f, 1);
+  _write_int(f, 5);
+  _write_size(f, 1);
+  _write_size(f, 2);
+  fwrite(hexa, 8, 8, f);
+
+  _write_int(f, 3);
+  _write_int(f, 1);
+  _write_int(f, 6);
+  _write_size(f, 2);
+  for (int i = 0; i < 2; i++) {
+    _write_size(f, i+3);
+    fwrite(prism[i], 8, 6, f);
+  }
+  fprintf(f, "\n$EndElements\n");
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Check faces of a block
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_faces(const cs_mesh_builder_t  *mb)
+{
+  int n_errors = 0;
+
+  const cs_lnum_t n_faces = mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0];
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+
+    cs_gnum_t g_num = mb->face_bi.gnum_range[0] + i;
+    cs_gnum_t vtx[4] = {0, 0, 0, 0};
+    cs_lnum_t s_id = mb->face_vertices_idx[i];
+    cs_lnum_t n_vtx = mb->face_vertices_idx[i+1] - s_id;
+
+    /* Sort face vertices */
+
+    for (cs_lnum_t j = 0; j < n_vtx && j < 4; j++) {
+      cs_gnum_t v = mb->face_vertices[s_id + j];
+      cs_lnum_t k = j;
+      while (k > 0 && vtx[k-1] > v) {
+        vtx[k] = vtx[k-1];
+        k--;
+      }
+      vtx[k] = v;
+    }
+
+    bft_printf("face %llu: vertices %llu %llu %llu %llu, cells %llu %llu,"
+               " group class %d\n",
+               (unsigned long long)g_num,
+               (unsigned long long)vtx[0], (unsigned long long)vtx[1],
+               (unsigned long long)vtx[2], (unsigned long long)vtx[3],
+               (unsigned long long)mb->face_cells[i*2],
+               (unsigned long long)mb->face_cells[i*2+1],
+               mb->face_gc_id[i]);
+
+    const cs_gnum_t *ref = _ref_faces[g_num-1];
+    const cs_lnum_t ref_n_vtx = (ref[3] > 0) ? 4 : 3;
+    const int ref_gc_id = (g_num == 3) ? 2 : 1; /* x = 0 face */
+
+    if (   n_vtx != ref_n_vtx
+        || memcmp(vtx, ref, 4*sizeof(cs_gnum_t)) != 0
+        || mb->face_cells[i*2] != ref[4]
+        || mb->face_cells[i*2+1] != ref[5]
+        || mb->face_gc_id[i] != ref_gc_id)
+      n_errors++;
+
+  }
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int size = 1;
+  int rank = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+    MPI_Comm_size(cs_glob_mpi_comm, &size);
+    cs_file_set_default_comm(0, -1, cs_glob_mpi_comm);
+  }
+
+#endif /* (HAVE_MPI) */
+
+  bft_error_handler_set(_bft_error_handler);
+  bft_printf_proxy_set(_bft_printf_proxy);
+  bft_printf_flush_proxy_set(_bft_printf_flush_proxy);
+
+  sprintf(mem_trace_name, "cs_mesh_read_gmsh_test_mem.%d", rank);
+  bft_mem_init(mem_trace_name);
+
+  if (rank == 0)
+    _write_test_mesh();
+
+#if defined(HAVE_MPI)
+  if (size > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  if (cs_mesh_read_gmsh_check(_file_name) == false)
+    bft_error(__FILE__, __LINE__, 0,
+              "File \"%s\" not recognized as a Gmsh file.", _file_name);
+
+  /* Minimal mesh and builder structures */
+
+  cs_mesh_t *mesh = NULL;
+  BFT_MALLOC(mesh, 1, cs_mesh_t);
+  memset(mesh, 0, sizeof(cs_mesh_t));
+
+  cs_mesh_builder_t *mb = NULL;
+  BFT_MALLOC(mb, 1, cs_mesh_builder_t);
+  memset(mb, 0, sizeof(cs_mesh_builder_t));
+  mb->min_rank_step = 1;
+
+  cs_mesh_read_gmsh_headers(_file_name, mesh, mb);
+
+  int n_errors = 0;
+
+  if (   mesh->n_g_cells != 3 || mesh->n_g_vertices != 12
+      || mesh->n_groups != 2 || mesh->n_families != 3)
+    n_errors++;
+
+  mb->cell_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                            cs_glob_n_ranks,
+                                            1,
+                                            0,
+                                            mesh->n_g_cells);
+  mb->vertex_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                              cs_glob_n_ranks,
+                                              1,
+                                              0,
+                                              mesh->n_g_vertices);
+
+  cs_mesh_read_gmsh_data(_file_name, mesh, mb);
+
+  if (mb->n_g_faces != 14 || mb->n_g_face_connect_size != 52)
+    n_errors++;
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    if (mb->cell_gc_id[i] != 3)
+      n_errors++;
+  }
+
+  n_errors += _check_faces(mb);
+
+  /* Free structures */
+
+  BFT_FREE(mb->face_cells);
+  BFT_FREE(mb->face_vertices_idx);
+  BFT_FREE(mb->face_vertices);
+  BFT_FREE(mb->cell_gc_id);
+  BFT_FREE(mb->face_gc_id);
+  BFT_FREE(mb->vertex_coords);
+  BFT_FREE(mb);
+
+  BFT_FREE(mesh->group_idx);
+  BFT_FREE(mesh->group);
+  BFT_FREE(mesh->family_item);
+  BFT_FREE(mesh);
+
+#if defined(HAVE_MPI)
+  if (size > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &n_errors, 1, MPI_INT, MPI_SUM,
+                  cs_glob_mpi_comm);
+#endif
+
+  if (rank == 0) {
+    remove(_file_name);
+    if (n_errors > 0)
+      fprintf(stderr, "cs_mesh_read_gmsh_test: %d errors\n", n_errors);
+  }
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  exit((n_errors > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}